@@ -0,0 +1,46 @@
+#!/usr/bin/env bash
+# Compares the time steps per second of alien-cli with pipelined and with sequential host stages.
+# The runs alternate between both modes and use the same seed, input and statistics interval.
+#
+# usage: compare-host-stages.sh <alien-cli> <world.sim> [timesteps] [runs] [statistics interval]
+
+set -euo pipefail
+
+if [ $# -lt 2 ]; then
+    echo "usage: $0 <alien-cli> <world.sim> [timesteps] [runs] [statistics interval]" >&2
+    exit 1
+fi
+
+cli=$1
+world=$2
+timesteps=${3:-20000}
+runs=${4:-5}
+statisticsInterval=${5:-10}
+
+tmpDir=$(mktemp -d)
+trap 'rm -rf "$tmpDir"' EXIT
+
+measure() {
+    "$cli" -q -i "$world" -t "$timesteps" --seed 1 \
+        --statistics "$tmpDir/statistics.csv" --statistics-interval "$statisticsInterval" "$@" \
+        | awk -F': ' '/^time steps per second/ { gsub(/,/, "", $2); print $2 }'
+}
+
+median() {
+    sort -g | awk '{ values[NR] = $1 }
+        END { print NR % 2 ? values[(NR + 1) / 2] : (values[NR / 2] + values[NR / 2 + 1]) / 2 }'
+}
+
+for ((i = 1; i <= runs; ++i)); do
+    pipelined=$(measure)
+    sequential=$(measure --sequential-host-stages)
+    echo "run $i: pipelined $pipelined tps, sequential $sequential tps"
+    echo "$pipelined" >> "$tmpDir/pipelined"
+    echo "$sequential" >> "$tmpDir/sequential"
+done
+
+pipelined=$(median < "$tmpDir/pipelined")
+sequential=$(median < "$tmpDir/sequential")
+awk -v p="$pipelined" -v s="$sequential" 'BEGIN {
+    printf "median: pipelined %.1f tps, sequential %.1f tps, speedup %.2fx\n", p, s, (s > 0 ? p / s : 0)
+}'
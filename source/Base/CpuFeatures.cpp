@@ -0,0 +1,53 @@
+#include "CpuFeatures.h"
+
+#include <algorithm>
+#include <atomic>
+
+#if defined(ALIEN_X86_SIMD) && defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace
+{
+    std::atomic<SimdLevel> simdLevelLimit{SimdLevel::Avx2};
+}
+
+SimdLevel CpuFeatures::getSimdLevel()
+{
+    static SimdLevel const detectedLevel = detectSimdLevel();
+    return std::min(detectedLevel, simdLevelLimit.load());
+}
+
+void CpuFeatures::setSimdLevelLimit(SimdLevel limit)
+{
+    simdLevelLimit = limit;
+}
+
+SimdLevel CpuFeatures::detectSimdLevel()
+{
+#if defined(ALIEN_X86_SIMD) && defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    auto maxFunction = info[0];
+    __cpuid(info, 1);
+    auto hasSse41 = (info[2] & (1 << 19)) != 0;
+    auto hasOsAvx = (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0 && (_xgetbv(0) & 6) == 6;
+    auto hasAvx2 = false;
+    if (hasOsAvx && maxFunction >= 7) {
+        __cpuidex(info, 7, 0);
+        hasAvx2 = (info[1] & (1 << 5)) != 0;
+    }
+    return hasAvx2 ? SimdLevel::Avx2 : hasSse41 ? SimdLevel::Sse41 : SimdLevel::Scalar;
+#elif defined(ALIEN_X86_SIMD)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+        return SimdLevel::Avx2;
+    }
+    if (__builtin_cpu_supports("sse4.1")) {
+        return SimdLevel::Sse41;
+    }
+    return SimdLevel::Scalar;
+#else
+    return SimdLevel::Scalar;
+#endif
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "DllExport.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define ALIEN_X86_SIMD
+#include <immintrin.h>
+#endif
+
+//function attributes for code paths which use instruction sets beyond the compiler's baseline
+#if defined(ALIEN_X86_SIMD) && (defined(__GNUC__) || defined(__clang__))
+#define ALIEN_TARGET_SSE41 __attribute__((target("sse4.1")))
+#define ALIEN_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define ALIEN_TARGET_SSE41
+#define ALIEN_TARGET_AVX2
+#endif
+
+enum class SimdLevel
+{
+    Scalar,
+    Sse41,
+    Avx2
+};
+
+class CpuFeatures
+{
+public:
+    //highest level supported by the processor and the operating system, capped by setSimdLevelLimit
+    BASE_EXPORT static SimdLevel getSimdLevel();
+
+    //allows comparing the vectorized paths with the scalar path
+    BASE_EXPORT static void setSimdLevelLimit(SimdLevel limit);
+
+private:
+    static SimdLevel detectSimdLevel();
+};
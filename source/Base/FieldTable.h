@@ -0,0 +1,161 @@
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+template <typename Struct, typename T>
+struct Field
+{
+    char const* name;
+    T Struct::*member;
+};
+
+template <typename Struct, typename T>
+constexpr Field<Struct, T> makeField(char const* name, T Struct::*member)
+{
+    return {name, member};
+}
+
+struct ByteRange
+{
+    size_t offset = 0;
+    size_t size = 0;
+
+    bool operator==(ByteRange const& other) const { return offset == other.offset && size == other.size; }
+};
+
+/**
+ * Operations on structs which list their members once in a constexpr tuple of Fields returned by a static getFields().
+ * Equality, diffs and (de)serialization are generated from this table, hence adding a member to the table suffices.
+ * Members with their own field table are descended into, their name becomes a path component unless it is empty.
+ * Elements of arrays are named by the field name followed by the index.
+ */
+class FieldTable
+{
+public:
+    template <typename T, typename = void>
+    struct HasFields : std::false_type
+    {};
+    template <typename T>
+    struct HasFields<T, std::void_t<decltype(T::getFields())>> : std::true_type
+    {};
+
+    template <typename Fields, typename Func>
+    static void forEach(Fields const& fields, Func const& func)
+    {
+        std::apply([&](auto const&... field) { (func(field), ...); }, fields);
+    }
+
+    template <typename Struct>
+    static bool equals(Struct const& lhs, Struct const& rhs)
+    {
+        auto result = true;
+        forEach(Struct::getFields(), [&](auto const& field) {
+            result = result && isEqual(lhs.*field.member, rhs.*field.member);
+        });
+        return result;
+    }
+
+    //calls func(path, value, otherValue) for all scalar members of object and the corresponding ones of other
+    template <typename Struct, typename Func>
+    static void forEachLeaf(
+        Struct& object,
+        std::remove_const_t<Struct> const& other,
+        std::string const& prefix,
+        Func const& func)
+    {
+        forEach(std::remove_const_t<Struct>::getFields(), [&](auto const& field) {
+            auto& value = object.*field.member;
+            auto const& otherValue = other.*field.member;
+            using T = std::remove_reference_t<decltype(value)>;
+            if constexpr (std::is_array_v<T>) {
+                for (size_t i = 0; i < std::extent_v<T>; ++i) {
+                    visitLeaf(value[i], otherValue[i], joinPath(prefix, field.name + std::to_string(i)), func);
+                }
+            } else {
+                visitLeaf(value, otherValue, joinPath(prefix, field.name), func);
+            }
+        });
+    }
+
+    //paths of all scalar members which differ
+    template <typename Struct>
+    static std::vector<std::string> diff(Struct const& lhs, Struct const& rhs, std::string const& prefix = "")
+    {
+        std::vector<std::string> result;
+        forEachLeaf(lhs, rhs, prefix, [&](std::string const& path, auto const& value, auto const& otherValue) {
+            if (!(value == otherValue)) {
+                result.emplace_back(path);
+            }
+        });
+        return result;
+    }
+
+    //memory of the scalar members which differ relative to the begin of the struct, sorted and merged where adjacent
+    template <typename Struct>
+    static std::vector<ByteRange> diffByteRanges(Struct const& lhs, Struct const& rhs)
+    {
+        std::vector<ByteRange> result;
+        auto begin = reinterpret_cast<char const*>(&lhs);
+        forEachLeaf(lhs, rhs, "", [&](std::string const&, auto const& value, auto const& otherValue) {
+            if (!(value == otherValue)) {
+                auto offset = static_cast<size_t>(reinterpret_cast<char const*>(&value) - begin);
+                result.emplace_back(ByteRange{offset, sizeof(value)});
+            }
+        });
+        std::sort(result.begin(), result.end(), [](auto const& range1, auto const& range2) {
+            return range1.offset < range2.offset;
+        });
+
+        auto mergedEnd = result.begin();
+        for (auto it = result.begin(); it != result.end(); ++it) {
+            if (it != result.begin() && std::prev(mergedEnd)->offset + std::prev(mergedEnd)->size == it->offset) {
+                std::prev(mergedEnd)->size += it->size;
+            } else {
+                *mergedEnd++ = *it;
+            }
+        }
+        result.erase(mergedEnd, result.end());
+        return result;
+    }
+
+private:
+    template <typename T>
+    static bool isEqual(T const& lhs, T const& rhs)
+    {
+        if constexpr (std::is_array_v<T>) {
+            for (size_t i = 0; i < std::extent_v<T>; ++i) {
+                if (!isEqual(lhs[i], rhs[i])) {
+                    return false;
+                }
+            }
+            return true;
+        } else if constexpr (HasFields<T>::value) {
+            return equals(lhs, rhs);
+        } else {
+            return lhs == rhs;
+        }
+    }
+
+    template <typename T, typename OtherT, typename Func>
+    static void visitLeaf(T& value, OtherT const& otherValue, std::string const& path, Func const& func)
+    {
+        if constexpr (HasFields<std::remove_const_t<T>>::value) {
+            forEachLeaf(value, otherValue, path, func);
+        } else {
+            func(path, value, otherValue);
+        }
+    }
+
+    static std::string joinPath(std::string const& prefix, std::string const& name)
+    {
+        if (prefix.empty()) {
+            return name;
+        }
+        return name.empty() ? prefix : prefix + "." + name;
+    }
+};
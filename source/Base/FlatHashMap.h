@@ -0,0 +1,152 @@
+#pragma once
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * Open-addressing hash map for 64 bit ids with linear probing. Keys and values are stored in flat arrays, so that
+ * building and querying large id maps do not allocate per entry. Erasing uses backward shifting, hence no tombstones
+ * accumulate on incremental updates.
+ */
+template <typename Value>
+class FlatHashMap
+{
+public:
+    FlatHashMap() = default;
+
+    int size() const { return _size; }
+    bool empty() const { return _size == 0; }
+
+    void clear()
+    {
+        _slots.clear();
+        _size = 0;
+    }
+
+    void reserve(int numEntries)
+    {
+        size_t capacity = MinCapacity;
+        while (capacity * MaxLoadNumerator < static_cast<size_t>(numEntries) * MaxLoadDenominator) {
+            capacity *= 2;
+        }
+        if (capacity > _slots.size()) {
+            rehash(capacity);
+        }
+    }
+
+    void insert_or_assign(uint64_t key, Value const& value)
+    {
+        if ((_size + 1) * MaxLoadDenominator > _slots.size() * MaxLoadNumerator) {
+            rehash(_slots.empty() ? MinCapacity : _slots.size() * 2);
+        }
+        auto& slot = _slots[findSlotIndex(key)];
+        if (!slot.occupied) {
+            slot.occupied = true;
+            slot.key = key;
+            ++_size;
+        }
+        slot.value = value;
+    }
+
+    Value const* find(uint64_t key) const
+    {
+        if (_slots.empty()) {
+            return nullptr;
+        }
+        auto const& slot = _slots[findSlotIndex(key)];
+        return slot.occupied ? &slot.value : nullptr;
+    }
+
+    bool contains(uint64_t key) const { return find(key) != nullptr; }
+
+    Value const& at(uint64_t key) const
+    {
+        if (auto result = find(key)) {
+            return *result;
+        }
+        throw std::out_of_range("FlatHashMap::at: key not found");
+    }
+
+    bool erase(uint64_t key)
+    {
+        if (_slots.empty()) {
+            return false;
+        }
+        auto mask = _slots.size() - 1;
+        auto index = findSlotIndex(key);
+        if (!_slots[index].occupied) {
+            return false;
+        }
+
+        //move subsequent entries of the probe sequence into the gap
+        auto gapIndex = index;
+        for (auto nextIndex = (gapIndex + 1) & mask; _slots[nextIndex].occupied; nextIndex = (nextIndex + 1) & mask) {
+            auto homeIndex = getHomeIndex(_slots[nextIndex].key);
+            if (((nextIndex - homeIndex) & mask) >= ((nextIndex - gapIndex) & mask)) {
+                _slots[gapIndex] = _slots[nextIndex];
+                gapIndex = nextIndex;
+            }
+        }
+        _slots[gapIndex].occupied = false;
+        --_size;
+        return true;
+    }
+
+    template <typename Func>
+    void forEach(Func const& func) const
+    {
+        for (auto const& slot : _slots) {
+            if (slot.occupied) {
+                func(slot.key, slot.value);
+            }
+        }
+    }
+
+private:
+    static size_t const MinCapacity = 16;
+    static size_t const MaxLoadNumerator = 7;
+    static size_t const MaxLoadDenominator = 10;
+
+    struct Slot
+    {
+        uint64_t key = 0;
+        Value value = Value();
+        bool occupied = false;
+    };
+
+    size_t getHomeIndex(uint64_t key) const
+    {
+        //ids are often consecutive => mix bits before masking
+        key ^= key >> 33;
+        key *= 0xff51afd7ed558ccdull;
+        key ^= key >> 33;
+        return static_cast<size_t>(key) & (_slots.size() - 1);
+    }
+
+    size_t findSlotIndex(uint64_t key) const
+    {
+        auto mask = _slots.size() - 1;
+        auto index = getHomeIndex(key);
+        while (_slots[index].occupied && _slots[index].key != key) {
+            index = (index + 1) & mask;
+        }
+        return index;
+    }
+
+    void rehash(size_t capacity)
+    {
+        std::vector<Slot> oldSlots(capacity);
+        std::swap(oldSlots, _slots);
+        _size = 0;
+        for (auto const& slot : oldSlots) {
+            if (slot.occupied) {
+                _slots[findSlotIndex(slot.key)] = slot;
+                ++_size;
+            }
+        }
+    }
+
+    std::vector<Slot> _slots;
+    int _size = 0;
+};
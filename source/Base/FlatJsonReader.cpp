@@ -0,0 +1,262 @@
+#include "FlatJsonReader.h"
+
+#include <cstdint>
+#include <stdexcept>
+
+namespace
+{
+    class Reader
+    {
+    public:
+        Reader(std::string_view text, FlatJsonEntries& entries)
+            : _text(text)
+            , _entries(entries)
+        {}
+
+        void readDocument()
+        {
+            std::string path;
+            readValue(path, true);
+            skipWhitespace();
+            if (_pos != _text.size()) {
+                throwError("unexpected trailing characters");
+            }
+        }
+
+    private:
+        void readValue(std::string& path, bool isStored)
+        {
+            skipWhitespace();
+            if (_pos == _text.size()) {
+                throwError("unexpected end of document");
+            }
+            auto c = _text[_pos];
+            if (c == '{') {
+                readObject(path, isStored);
+            } else if (c == '[') {
+                readArray(path);
+            } else if (c == '"') {
+                auto value = readString();
+                if (isStored) {
+                    _entries.emplace(path, std::move(value));
+                }
+            } else {
+                auto value = readLiteral();
+                if (isStored) {
+                    _entries.emplace(path, std::string(value));
+                }
+            }
+        }
+
+        void readObject(std::string& path, bool isStored)
+        {
+            ++_pos;
+            skipWhitespace();
+            if (consume('}')) {
+                return;
+            }
+            auto pathSize = path.size();
+            do {
+                skipWhitespace();
+                if (_pos == _text.size() || _text[_pos] != '"') {
+                    throwError("expected key");
+                }
+                auto key = readString();
+                skipWhitespace();
+                if (!consume(':')) {
+                    throwError("expected ':'");
+                }
+                if (pathSize > 0) {
+                    path += '.';
+                }
+                path += key;
+                readValue(path, isStored);
+                path.resize(pathSize);
+                skipWhitespace();
+            } while (consume(','));
+            if (!consume('}')) {
+                throwError("expected '}'");
+            }
+        }
+
+        void readArray(std::string& path)
+        {
+            ++_pos;
+            skipWhitespace();
+            if (consume(']')) {
+                return;
+            }
+            do {
+                readValue(path, false);
+                skipWhitespace();
+            } while (consume(','));
+            if (!consume(']')) {
+                throwError("expected ']'");
+            }
+        }
+
+        std::string readString()
+        {
+            ++_pos;
+            std::string result;
+            while (true) {
+                auto end = _text.find_first_of("\"\\", _pos);
+                if (end == std::string_view::npos) {
+                    throwError("unterminated string");
+                }
+                result.append(_text.data() + _pos, end - _pos);
+                _pos = end + 1;
+                if (_text[end] == '"') {
+                    return result;
+                }
+                readEscapeSequence(result);
+            }
+        }
+
+        void readEscapeSequence(std::string& result)
+        {
+            if (_pos == _text.size()) {
+                throwError("unterminated string");
+            }
+            auto c = _text[_pos++];
+            switch (c) {
+            case '"':
+            case '\\':
+            case '/':
+                result += c;
+                break;
+            case 'b':
+                result += '\b';
+                break;
+            case 'f':
+                result += '\f';
+                break;
+            case 'n':
+                result += '\n';
+                break;
+            case 'r':
+                result += '\r';
+                break;
+            case 't':
+                result += '\t';
+                break;
+            case 'u':
+                appendUtf8(result, readCodePoint());
+                break;
+            default:
+                throwError("invalid escape sequence");
+            }
+        }
+
+        uint32_t readCodePoint()
+        {
+            auto codePoint = readHex4();
+            if (codePoint >= 0xd800 && codePoint < 0xdc00 && _text.substr(_pos, 2) == "\\u") {
+                _pos += 2;
+                auto lowSurrogate = readHex4();
+                if (lowSurrogate < 0xdc00 || lowSurrogate >= 0xe000) {
+                    throwError("invalid surrogate pair");
+                }
+                codePoint = 0x10000 + ((codePoint - 0xd800) << 10) + (lowSurrogate - 0xdc00);
+            }
+            return codePoint;
+        }
+
+        uint32_t readHex4()
+        {
+            if (_pos + 4 > _text.size()) {
+                throwError("invalid unicode escape");
+            }
+            uint32_t result = 0;
+            for (int i = 0; i < 4; ++i) {
+                auto c = _text[_pos++];
+                result <<= 4;
+                if (c >= '0' && c <= '9') {
+                    result += c - '0';
+                } else if (c >= 'a' && c <= 'f') {
+                    result += c - 'a' + 10;
+                } else if (c >= 'A' && c <= 'F') {
+                    result += c - 'A' + 10;
+                } else {
+                    throwError("invalid unicode escape");
+                }
+            }
+            return result;
+        }
+
+        static void appendUtf8(std::string& result, uint32_t codePoint)
+        {
+            if (codePoint < 0x80) {
+                result += static_cast<char>(codePoint);
+            } else if (codePoint < 0x800) {
+                result += static_cast<char>(0xc0 | (codePoint >> 6));
+                result += static_cast<char>(0x80 | (codePoint & 0x3f));
+            } else if (codePoint < 0x10000) {
+                result += static_cast<char>(0xe0 | (codePoint >> 12));
+                result += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f));
+                result += static_cast<char>(0x80 | (codePoint & 0x3f));
+            } else {
+                result += static_cast<char>(0xf0 | (codePoint >> 18));
+                result += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3f));
+                result += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f));
+                result += static_cast<char>(0x80 | (codePoint & 0x3f));
+            }
+        }
+
+        //numbers, true, false and null
+        std::string_view readLiteral()
+        {
+            auto begin = _pos;
+            while (_pos < _text.size()) {
+                auto c = _text[_pos];
+                if (c == ',' || c == '}' || c == ']' || c == ' ' || c == '\t' || c == '\n' || c == '\r') {
+                    break;
+                }
+                ++_pos;
+            }
+            auto result = _text.substr(begin, _pos - begin);
+            auto isNumber = !result.empty() && (result[0] == '-' || (result[0] >= '0' && result[0] <= '9'));
+            if (!isNumber && result != "true" && result != "false" && result != "null") {
+                throwError("invalid literal");
+            }
+            return result;
+        }
+
+        void skipWhitespace()
+        {
+            while (_pos < _text.size()) {
+                auto c = _text[_pos];
+                if (c != ' ' && c != '\t' && c != '\n' && c != '\r') {
+                    break;
+                }
+                ++_pos;
+            }
+        }
+
+        bool consume(char c)
+        {
+            if (_pos < _text.size() && _text[_pos] == c) {
+                ++_pos;
+                return true;
+            }
+            return false;
+        }
+
+        [[noreturn]] void throwError(char const* message) const
+        {
+            throw std::runtime_error("JSON parse error at offset " + std::to_string(_pos) + ": " + message);
+        }
+
+        std::string_view _text;
+        size_t _pos = 0;
+        FlatJsonEntries& _entries;
+    };
+}
+
+FlatJsonEntries FlatJsonReader::read(std::string_view text)
+{
+    FlatJsonEntries result;
+    result.reserve(256);
+    Reader(text, result).readDocument();
+    return result;
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <charconv>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+
+#include "DllExport.h"
+
+using FlatJsonEntries = std::unordered_map<std::string, std::string>;
+
+/**
+ * Reads JSON documents consisting of nested objects into a map from dotted paths to leaf values in a single pass.
+ * The paths and values agree with the ones of boost::property_tree::read_json (literals are kept as text), but no
+ * tree of nodes is built, which makes reading many small settings files considerably faster. Arrays are skipped.
+ */
+class FlatJsonReader
+{
+public:
+    //throws std::runtime_error on malformed input
+    BASE_EXPORT static FlatJsonEntries read(std::string_view text);
+
+    //conversion as in boost::property_tree, returns false if text is not a valid representation of T
+    template <typename T>
+    static bool convert(std::string_view text, T& result);
+};
+
+/**
+ * Implementations
+ */
+template <typename T>
+bool FlatJsonReader::convert(std::string_view text, T& result)
+{
+    auto isWhitespace = [](char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r'; };
+    while (!text.empty() && isWhitespace(text.front())) {
+        text.remove_prefix(1);
+    }
+    while (!text.empty() && isWhitespace(text.back())) {
+        text.remove_suffix(1);
+    }
+
+    if constexpr (std::is_same<T, std::string>::value) {
+        result = std::string(text);
+        return true;
+    } else if constexpr (std::is_same<T, bool>::value) {
+        if (text == "true" || text == "1") {
+            result = true;
+            return true;
+        }
+        if (text == "false" || text == "0") {
+            result = false;
+            return true;
+        }
+        return false;
+    } else if constexpr (std::is_enum<T>::value) {
+        std::underlying_type_t<T> value;
+        if (!convert(text, value)) {
+            return false;
+        }
+        result = static_cast<T>(value);
+        return true;
+    } else {
+        if (text.size() > 1 && text.front() == '+') {
+            text.remove_prefix(1);
+        }
+        T value;
+        auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+        if (error != std::errc() || end != text.data() + text.size() || text.empty()) {
+            return false;
+        }
+        result = value;
+        return true;
+    }
+}
@@ -34,7 +34,12 @@ void JsonParser::encodeDecode(
     std::string const& node,
     ParserTask task)
 {
-    if (ParserTask::Encode == task) {
+    if constexpr (std::is_enum<T>::value) {
+        using Underlying = std::underlying_type_t<T>;
+        auto value = static_cast<Underlying>(parameter);
+        encodeDecode(tree, value, static_cast<Underlying>(defaultValue), node, task);
+        parameter = static_cast<T>(value);
+    } else if (ParserTask::Encode == task) {
         if constexpr (std::is_same<T, bool>::value) {
             tree.put(node, parameter ? "true" : "false");
         } else if constexpr (std::is_same<T, std::string>::value) {
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
+#include <vector>
 
 enum class Priority
 {
@@ -8,10 +10,24 @@ enum class Priority
     Important,
 };
 
+struct LogMessage
+{
+    Priority priority;
+    std::string message;
+};
+
 class LoggingCallBack
 {
 public:
     virtual void newLogMessage(Priority priority, std::string const& message) = 0;
+
+    //messages are delivered in batches, override for handling a batch at once
+    virtual void newLogMessages(std::vector<LogMessage> const& messages)
+    {
+        for (auto const& message : messages) {
+            newLogMessage(message.priority, message.message);
+        }
+    }
 };
 
 class LoggingService
@@ -21,6 +37,10 @@ public:
 
     virtual void logMessage(Priority priority, std::string const& message) = 0;
 
+    //delivers all pending messages to the callbacks before returning
+    virtual void flush() = 0;
+    virtual uint64_t getNumDroppedMessages() const = 0;
+
     virtual void registerCallBack(LoggingCallBack* callback) = 0;
     virtual void unregisterCallBack(LoggingCallBack* callback) = 0;
 };
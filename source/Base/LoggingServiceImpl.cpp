@@ -1,37 +1,233 @@
 #include "LoggingServiceImpl.h"
 
+#include <chrono>
 #include <iostream>
 #include <iomanip>
 #include <ctime>
+#include <exception>
 #include <sstream>
 #include <algorithm>
 
-void LoggingServiceImpl::logMessage(Priority priority, std::string const& message)
+namespace
+{
+    uint64_t const Capacity = 4096;  //power of 2
+    auto const DrainInterval = std::chrono::milliseconds(100);
+
+    LoggingServiceImpl* terminateInstance = nullptr;
+    std::terminate_handler prevTerminateHandler = nullptr;
+
+    thread_local bool isDraining = false;  //true while the current thread dequeues messages or invokes callbacks
+
+    class DrainScope
+    {
+    public:
+        DrainScope() { isDraining = true; }
+        ~DrainScope() { isDraining = false; }
+    };
+}
+
+LoggingServiceImpl::LoggingServiceImpl()
+    : _slots(new Slot[Capacity])
 {
-    std::lock_guard<std::mutex> lock(_mutex);
+    for (uint64_t i = 0; i < Capacity; ++i) {
+        _slots[i].sequence = i;
+    }
+    _drainThread = std::thread(&LoggingServiceImpl::drainThreadLoop, this);
 
-    auto t = std::time(nullptr);
-    auto tm = *std::localtime(&t);
+    terminateInstance = this;
+    prevTerminateHandler = std::set_terminate(&LoggingServiceImpl::onTerminate);
+}
+
+LoggingServiceImpl::~LoggingServiceImpl()
+{
+    if (terminateInstance == this) {
+        std::set_terminate(prevTerminateHandler);
+        terminateInstance = nullptr;
+    }
+    _shutdown = true;
+    wakeUpDrainThread();
+    _drainThread.join();
+}
 
-    std::stringstream stream;
-    stream << std::put_time(&tm, "%Y-%m-%d %H-%M-%S") << ": " << message;
+void LoggingServiceImpl::logMessage(Priority priority, std::string const& message)
+{
+    if (tryEnqueue(priority, message)) {
+        return;
+    }
 
-    auto enrichedMessage = stream.str();
-    for (auto const& callback : _callbacks) {
-        callback->newLogMessage(priority, enrichedMessage);
+    //buffer is full => drop unimportant messages, and messages from callbacks since waiting would deadlock
+    if (Priority::Unimportant == priority || std::this_thread::get_id() == _drainThread.get_id()) {
+        ++_numDroppedMessages;
+        return;
     }
+    do {
+        wakeUpDrainThread();
+        std::this_thread::yield();
+    } while (!tryEnqueue(priority, message));
+}
+
+void LoggingServiceImpl::flush()
+{
+    drain();
+}
+
+uint64_t LoggingServiceImpl::getNumDroppedMessages() const
+{
+    return _numDroppedMessages;
 }
 
 void LoggingServiceImpl::registerCallBack(LoggingCallBack* callback)
 {
+    std::lock_guard<std::mutex> lock(_callbacksMutex);
     _callbacks.emplace_back(callback);
 }
 
 void LoggingServiceImpl::unregisterCallBack(LoggingCallBack* callback)
 {
+    drain();
+
+    //a delivery on another thread may still use the callback
+    std::unique_lock<std::mutex> deliveryLock(_deliveryMutex, std::defer_lock);
+    if (!isDraining) {
+        deliveryLock.lock();
+    }
+    std::lock_guard<std::mutex> lock(_callbacksMutex);
     auto end = std::remove_if(_callbacks.begin(), _callbacks.end(), [&](auto const& callback_) {
         return callback_ == callback;
     });
 
     _callbacks.erase(end, _callbacks.end());
 }
+
+bool LoggingServiceImpl::tryEnqueue(Priority priority, std::string const& message)
+{
+    auto pos = _enqueuePos.load(std::memory_order_relaxed);
+    Slot* slot;
+    while (true) {
+        slot = &_slots[pos & (Capacity - 1)];
+        auto sequence = slot->sequence.load(std::memory_order_acquire);
+        auto diff = static_cast<int64_t>(sequence) - static_cast<int64_t>(pos);
+        if (diff == 0) {
+            if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            return false;
+        } else {
+            pos = _enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+    slot->priority = priority;
+    slot->time = std::time(nullptr);
+    slot->message = message;
+    slot->sequence.store(pos + 1, std::memory_order_release);
+
+    if ((pos & (Capacity / 2 - 1)) == 0) {
+        wakeUpDrainThread();
+    }
+    return true;
+}
+
+void LoggingServiceImpl::wakeUpDrainThread()
+{
+    _wakeUpRequested = true;
+    _wakeUpCondition.notify_one();
+}
+
+void LoggingServiceImpl::drainThreadLoop()
+{
+    while (!_shutdown) {
+        {
+            std::unique_lock<std::mutex> lock(_wakeUpMutex);
+            _wakeUpCondition.wait_for(lock, DrainInterval, [this] { return _wakeUpRequested.load(); });
+            _wakeUpRequested = false;
+        }
+        drain();
+    }
+    drain();
+}
+
+void LoggingServiceImpl::drain(bool wait)
+{
+    //called from a callback or on termination during drain: the pending messages are delivered by the next drain
+    if (isDraining) {
+        return;
+    }
+    DrainScope scope;
+
+    std::unique_lock<std::mutex> drainLock(_drainMutex, std::defer_lock);
+    if (wait) {
+        drainLock.lock();
+    } else if (!drainLock.try_lock()) {
+        return;
+    }
+    auto messages = dequeueMessages();
+
+    //also waits for batches which are dequeued by another thread but not delivered yet
+    std::unique_lock<std::mutex> deliveryLock(_deliveryMutex, std::defer_lock);
+    if (wait) {
+        deliveryLock.lock();
+    } else if (!deliveryLock.try_lock()) {
+        for (auto const& message : messages) {
+            std::cerr << message.message << std::endl;
+        }
+        return;
+    }
+    drainLock.unlock();
+
+    if (!messages.empty()) {
+        deliver(messages);
+    }
+}
+
+std::vector<LogMessage> LoggingServiceImpl::dequeueMessages()
+{
+    std::vector<LogMessage> result;
+    while (true) {
+        auto& slot = _slots[_dequeuePos & (Capacity - 1)];
+        if (slot.sequence.load(std::memory_order_acquire) != _dequeuePos + 1) {
+            break;
+        }
+        auto tm = *std::localtime(&slot.time);
+        std::stringstream stream;
+        stream << std::put_time(&tm, "%Y-%m-%d %H-%M-%S") << ": " << slot.message;
+        result.emplace_back(LogMessage{slot.priority, stream.str()});
+
+        slot.message.clear();
+        slot.sequence.store(_dequeuePos + Capacity, std::memory_order_release);
+        ++_dequeuePos;
+    }
+
+    auto numDroppedMessages = _numDroppedMessages.load();
+    if (numDroppedMessages != _numReportedDroppedMessages) {
+        result.emplace_back(LogMessage{
+            Priority::Important,
+            std::to_string(numDroppedMessages - _numReportedDroppedMessages) + " log messages have been dropped"});
+        _numReportedDroppedMessages = numDroppedMessages;
+    }
+    return result;
+}
+
+void LoggingServiceImpl::deliver(std::vector<LogMessage> const& messages)
+{
+    std::vector<LoggingCallBack*> callbacks;
+    {
+        std::lock_guard<std::mutex> callbacksLock(_callbacksMutex);
+        callbacks = _callbacks;
+    }
+    for (auto const& callback : callbacks) {
+        callback->newLogMessages(messages);
+    }
+}
+
+void LoggingServiceImpl::onTerminate()
+{
+    //another thread may hang while holding a lock
+    if (auto instance = terminateInstance) {
+        instance->drain(false);
+    }
+    if (prevTerminateHandler) {
+        prevTerminateHandler();
+    }
+    std::abort();
+}
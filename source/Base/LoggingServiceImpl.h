@@ -1,20 +1,68 @@
 #pragma once
-#include <vector>
+#include <atomic>
+#include <condition_variable>
+#include <ctime>
+#include <memory>
 #include <mutex>
+#include <thread>
+#include <vector>
 
 #include "LoggingService.h"
 
+/**
+ * Messages are put into a bounded lock-free ring buffer by any number of threads and delivered to the callbacks in
+ * batches by a background thread. If the buffer is full, unimportant messages are dropped and counted, whereas
+ * important messages wait until there is space. Pending messages are delivered on flush, on unregistering a
+ * callback, on destruction and on std::terminate.
+ * The callbacks are invoked without holding the locks for dequeuing and registering, hence they may log, flush and
+ * unregister themselves.
+ */
 class LoggingServiceImpl : public LoggingService
 {
 public:
-    virtual ~LoggingServiceImpl() = default;
+    LoggingServiceImpl();
+    virtual ~LoggingServiceImpl();
 
     void logMessage(Priority priority, std::string const& message) override;
 
+    void flush() override;
+    uint64_t getNumDroppedMessages() const override;
+
     void registerCallBack(LoggingCallBack* callback) override;
     void unregisterCallBack(LoggingCallBack* callback) override;
 
 private:
+    struct Slot
+    {
+        std::atomic<uint64_t> sequence;
+        Priority priority;
+        std::time_t time;
+        std::string message;
+    };
+
+    bool tryEnqueue(Priority priority, std::string const& message);
+    void wakeUpDrainThread();
+    void drainThreadLoop();
+    void drain(bool wait = true);  //returns without draining if a lock is not available and wait is false
+    std::vector<LogMessage> dequeueMessages();  //requires lock on _drainMutex
+    void deliver(std::vector<LogMessage> const& messages);  //requires lock on _deliveryMutex
+
+    static void onTerminate();
+
+    std::unique_ptr<Slot[]> _slots;
+    std::atomic<uint64_t> _enqueuePos{0};
+    uint64_t _dequeuePos = 0;  //guarded by _drainMutex
+    std::atomic<uint64_t> _numDroppedMessages{0};
+    uint64_t _numReportedDroppedMessages = 0;  //guarded by _drainMutex
+
+    std::mutex _drainMutex;
+    std::mutex _deliveryMutex;  //acquired before releasing _drainMutex so that batches are delivered in order
+    std::mutex _callbacksMutex;
     std::vector<LoggingCallBack*> _callbacks;
-    std::mutex _mutex;
+
+    std::mutex _wakeUpMutex;
+    std::condition_variable _wakeUpCondition;
+    std::atomic<bool> _wakeUpRequested{false};
+    std::atomic<bool> _shutdown{false};
+    std::thread _drainThread;
 };
@@ -2,9 +2,51 @@
 
 #include <cmath>
 
+#include "CpuFeatures.h"
+
+namespace
+{
+#ifdef ALIEN_X86_SIMD
+    ALIEN_TARGET_AVX2 int lengthsAvx2(RealVector2D const* vectors, float* result, int count)
+    {
+        int index = 0;
+        for (; index + 8 <= count; index += 8) {
+            auto v0 = _mm256_loadu_ps(&vectors[index].x);
+            auto v1 = _mm256_loadu_ps(&vectors[index + 4].x);
+
+            //hadd yields the order 0, 1, 4, 5, 2, 3, 6, 7 => swap the middle 64 bit blocks
+            auto squaredLengths = _mm256_hadd_ps(_mm256_mul_ps(v0, v0), _mm256_mul_ps(v1, v1));
+            squaredLengths = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(squaredLengths), 0xd8));
+            _mm256_storeu_ps(result + index, _mm256_sqrt_ps(squaredLengths));
+        }
+        return index;
+    }
+
+    ALIEN_TARGET_AVX2 int
+    rotateAvx2(RealVector2D* positions, int count, RealVector2D const& center, float cosAngle, float sinAngle)
+    {
+        auto centerV = _mm256_setr_ps(center.x, center.y, center.x, center.y, center.x, center.y, center.x, center.y);
+        auto cosV = _mm256_set1_ps(cosAngle);
+        auto sinV = _mm256_setr_ps(-sinAngle, sinAngle, -sinAngle, sinAngle, -sinAngle, sinAngle, -sinAngle, sinAngle);
+        int index = 0;
+        for (; index + 4 <= count; index += 4) {
+            auto d = _mm256_sub_ps(_mm256_loadu_ps(&positions[index].x), centerV);
+            auto swapped = _mm256_permute_ps(d, 0xb1);
+            auto rotated = _mm256_add_ps(_mm256_mul_ps(d, cosV), _mm256_mul_ps(swapped, sinV));
+            _mm256_storeu_ps(&positions[index].x, _mm256_add_ps(centerV, rotated));
+        }
+        return index;
+    }
+#else
+    int lengthsAvx2(RealVector2D const*, float*, int) { return 0; }
+    int rotateAvx2(RealVector2D*, int, RealVector2D const&, float, float) { return 0; }
+#endif
+}
+
 double Math::length(RealVector2D const& v)
 {
-    return sqrt(v.x * v.x + v.y * v.y);
+    //squares in double precision, otherwise asin in angleOfVector may get arguments beyond 1 for nearly vertical vectors
+    return sqrt(static_cast<double>(v.x) * v.x + static_cast<double>(v.y) * v.y);
 }
 
 double Math::angleOfVector(RealVector2D const& v)
@@ -17,4 +59,36 @@ double Math::angleOfVector(RealVector2D const& v)
         angle = angleSin + 270.0;
     }
     return angle;
-}
\ No newline at end of file
+}
+
+void Math::lengths(RealVector2D const* vectors, float* result, int count)
+{
+    int index = CpuFeatures::getSimdLevel() == SimdLevel::Avx2 ? lengthsAvx2(vectors, result, count) : 0;
+    for (; index < count; ++index) {
+        result[index] = std::sqrt(vectors[index].x * vectors[index].x + vectors[index].y * vectors[index].y);
+    }
+}
+
+void Math::anglesOfVectors(RealVector2D const* vectors, float* result, int count)
+{
+    //atan2 form of angleOfVector, which is also well-conditioned near the axes
+    for (int index = 0; index < count; ++index) {
+        auto angle = toFloat(std::atan2(static_cast<double>(vectors[index].x), -vectors[index].y) * radToDeg);
+        result[index] = angle < 0 ? angle + 360.0f : angle;
+    }
+}
+
+void Math::rotate(RealVector2D* positions, int count, RealVector2D const& center, double angle)
+{
+    auto cosAngle = toFloat(std::cos(angle * degToRad));
+    auto sinAngle = toFloat(std::sin(angle * degToRad));
+    int index = CpuFeatures::getSimdLevel() == SimdLevel::Avx2
+        ? rotateAvx2(positions, count, center, cosAngle, sinAngle)
+        : 0;
+    for (; index < count; ++index) {
+        auto dx = positions[index].x - center.x;
+        auto dy = positions[index].y - center.y;
+        positions[index].x = center.x + (dx * cosAngle + dy * -sinAngle);
+        positions[index].y = center.y + (dy * cosAngle + dx * sinAngle);
+    }
+}
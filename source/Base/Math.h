@@ -12,4 +12,11 @@ class Math
 public:
     BASE_EXPORT static double length(RealVector2D const& v);  //0 DEG corresponds to (0,-1)
     BASE_EXPORT static double angleOfVector(RealVector2D const& v);  //0 DEG corresponds to (0,-1)
+
+    //batch versions, vectorized according to CpuFeatures
+    BASE_EXPORT static void lengths(RealVector2D const* vectors, float* result, int count);
+    BASE_EXPORT static void anglesOfVectors(RealVector2D const* vectors, float* result, int count);
+
+    //rotates positions about center by angle in degrees (same orientation as angleOfVector)
+    BASE_EXPORT static void rotate(RealVector2D* positions, int count, RealVector2D const& center, double angle);
 };
@@ -1,5 +1,3 @@
-#include <sstream>
-#include <thread>
 #include <random>
 
 #include "NumberGenerator.h"
@@ -7,20 +5,39 @@
 namespace
 {
     double const RandMax = 4294967296.0;
+    int const IdBlockSize = 1024;
+
+    uint64_t splitMix(uint64_t value)
+    {
+        value += 0x9e3779b97f4a7c15ull;
+        value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ull;
+        value = (value ^ (value >> 27)) * 0x94d049bb133111ebull;
+        return value ^ (value >> 31);
+    }
+
+    struct ThreadStream
+    {
+        uint64_t seedGeneration = ~0ull;
+        uint64_t index = 0;
+        uint64_t key = 0;
+        uint64_t counter = 0;
+    };
+    thread_local ThreadStream threadStream;
+
+    struct ThreadIdBlock
+    {
+        uint64_t nextId = 0;
+        uint64_t endId = 0;
+    };
+    thread_local ThreadIdBlock threadIdBlock;
 }
 
 NumberGenerator::NumberGenerator()
 {
     _threadId = static_cast<uint64_t>(1) << 48;
-    _arrayOfRandomNumbers.reserve(1323781);
     _runningNumber = 0;
-    std::random_device rd;   //Will be used to obtain a seed for the random number engine
-    std::mt19937 gen(rd());  //Standard mersenne_twister_engine seeded with rd()
-    std::uniform_int_distribution<> distrib(0);
-
-    for (uint32_t i = 0; i < 1323781; ++i) {
-        _arrayOfRandomNumbers.emplace_back(distrib(gen));
-    }
+    std::random_device rd;
+    _seed = (static_cast<uint64_t>(rd()) << 32) | rd();
 }
 
 NumberGenerator::~NumberGenerator()
@@ -33,44 +50,82 @@ NumberGenerator& NumberGenerator::getInstance()
     return instance;
 }
 
+void NumberGenerator::setSeed(uint64_t seed)
+{
+    _seed = seed;
+    ++_seedGeneration;
+}
+
+void NumberGenerator::selectStream(uint64_t index)
+{
+    threadStream.index = index;
+    threadStream.seedGeneration = ~0ull;
+}
+
 uint32_t NumberGenerator::getRandomInt()
 {
-	return getNumberFromArray();
+    return static_cast<uint32_t>(getRandomBits() >> 32);
 }
 
 uint32_t NumberGenerator::getRandomInt(uint32_t range)
 {
-	return getNumberFromArray() % range;
+    return getRandomInt() % range;
 }
 
 uint32_t NumberGenerator::getRandomInt(uint32_t min, uint32_t max)
 {
     auto delta = max - min + 1;
-    return min + (getNumberFromArray() % delta);
+    return min + (getRandomInt() % delta);
+}
+
+double NumberGenerator::getRandomReal(double min, double max)
+{
+    return min + getRandomReal() * (max - min);
 }
 
-uint32_t NumberGenerator::getLargeRandomInt(uint32_t range)
+double NumberGenerator::getRandomReal()
 {
-	return getNumberFromArray() % (range + 1);
+    return static_cast<double>(getRandomInt()) / RandMax;
 }
 
-double NumberGenerator::getRandomReal(double min, double max)
+void NumberGenerator::fillRandomInts(uint32_t* result, int count, uint32_t range)
 {
-	return static_cast<double>(getLargeRandomInt(static_cast<int>((max - min) * 1000)) / 1000.0 + min);
+    for (int i = 0; i < count; ++i) {
+        result[i] = getRandomInt(range);
+    }
 }
 
-double NumberGenerator::getRandomReal()
+void NumberGenerator::fillRandomReals(double* result, int count, double min, double max)
 {
-    return static_cast<double>(getNumberFromArray()) / RandMax;
+    for (int i = 0; i < count; ++i) {
+        result[i] = getRandomReal(min, max);
+    }
 }
 
 uint64_t NumberGenerator::getId()
 {
-	return _threadId | ++_runningNumber;
+    auto& block = threadIdBlock;
+    if (block.nextId == block.endId) {
+        block.nextId = reserveIds(IdBlockSize);
+        block.endId = block.nextId + IdBlockSize;
+    }
+    return block.nextId++;
+}
+
+uint64_t NumberGenerator::reserveIds(int count)
+{
+    //running numbers start at 1 since id 0 denotes an unset id
+    return _threadId | (_runningNumber.fetch_add(count, std::memory_order_relaxed) + 1);
 }
 
-uint32_t NumberGenerator::getNumberFromArray()
+uint64_t NumberGenerator::getRandomBits()
 {
-	_index = (_index + 1) % _arrayOfRandomNumbers.size();
-	return _arrayOfRandomNumbers[_index];
+    auto& stream = threadStream;
+    auto seedGeneration = _seedGeneration.load(std::memory_order_acquire);
+    if (stream.seedGeneration != seedGeneration) {
+        stream.seedGeneration = seedGeneration;
+        stream.key = splitMix(_seed.load() ^ splitMix(stream.index));
+        stream.counter = 0;
+    }
+    return splitMix(stream.key + stream.counter++ * 0xd1342543de82ef95ull);
 }
@@ -1,34 +1,54 @@
 #pragma once
 
+#include <atomic>
+
 #include "Definitions.h"
 
+/**
+ * Random numbers are computed from a counter-based hash of (seed, stream, counter). Each thread draws from its own
+ * stream, hence no locking is required and no state is shared between threads. Streams are selected explicitly by
+ * an index, e.g. the chunk index in parallel loops, so that runs with the same seed are reproducible independently
+ * of the thread scheduling. Threads which have not selected a stream draw from stream 0.
+ */
 class NumberGenerator
 {
 public:
     BASE_EXPORT static NumberGenerator& getInstance();
 
+    //restarts all streams
+    BASE_EXPORT void setSeed(uint64_t seed);
+
+    //restarts the stream of the calling thread with the given index
+    BASE_EXPORT void selectStream(uint64_t index);
+
 	BASE_EXPORT uint32_t getRandomInt();
     BASE_EXPORT uint32_t getRandomInt(uint32_t range);
     BASE_EXPORT uint32_t getRandomInt(uint32_t min, uint32_t max);
     BASE_EXPORT double getRandomReal();
     BASE_EXPORT double getRandomReal(double min, double max);
 
+    BASE_EXPORT void fillRandomInts(uint32_t* result, int count, uint32_t range);
+    BASE_EXPORT void fillRandomReals(double* result, int count, double min, double max);
+
+    //ids are handed out from thread-local blocks, hence getId is lock-free and mostly touches no shared state
 	BASE_EXPORT uint64_t getId();
 
+    //returns the first id of a contiguous range [result, result + count)
+    BASE_EXPORT uint64_t reserveIds(int count);
+
 public:
     NumberGenerator(NumberGenerator const&) = delete;
     void operator=(NumberGenerator const&) = delete;
 
-	uint32_t getLargeRandomInt(uint32_t range);
-    uint32_t getNumberFromArray();
-
 private:
     NumberGenerator();
     ~NumberGenerator();
 
-	int _index = 0;
-	vector<uint32_t> _arrayOfRandomNumbers;
-	uint64_t _runningNumber = 0;
-	uint64_t _threadId = 0;
-};
+    uint64_t getRandomBits();
 
+    std::atomic<uint64_t> _seed;
+    std::atomic<uint64_t> _seedGeneration{0};  //incremented by setSeed in order to restart the thread streams
+
+	std::atomic<uint64_t> _runningNumber{0};
+	uint64_t _threadId = 0;  //distinguishes host ids from ids created by the engine
+};
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <future>
+#include <thread>
+#include <vector>
+
+class Parallel
+{
+public:
+    static int getNumChunks(int size, int minChunkSize)
+    {
+        auto numThreads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+        return std::max(1, std::min(numThreads, size / std::max(1, minChunkSize)));
+    }
+
+    //calls func(chunkIndex, begin, end) for contiguous chunks of [0, size), chunks are processed concurrently
+    template <typename Func>
+    static void forEachChunk(int size, int minChunkSize, Func const& func)
+    {
+        auto numChunks = getNumChunks(size, minChunkSize);
+        if (numChunks == 1) {
+            func(0, 0, size);
+            return;
+        }
+        std::vector<std::future<void>> futures;
+        futures.reserve(numChunks - 1);
+        for (int chunk = 1; chunk < numChunks; ++chunk) {
+            futures.emplace_back(std::async(std::launch::async, [&func, chunk, numChunks, size] {
+                func(chunk, getChunkBegin(chunk, numChunks, size), getChunkBegin(chunk + 1, numChunks, size));
+            }));
+        }
+        func(0, 0, getChunkBegin(1, numChunks, size));
+        for (auto& future : futures) {
+            future.get();
+        }
+    }
+
+private:
+    static int getChunkBegin(int chunk, int numChunks, int size)
+    {
+        return static_cast<int>(static_cast<int64_t>(size) * chunk / numChunks);
+    }
+};
@@ -0,0 +1,51 @@
+#include "PeriodicGrid.h"
+
+#include <algorithm>
+#include <cmath>
+
+PeriodicGrid::PeriodicGrid(IntVector2D const& worldSize, float maxSpacing, int numChannels)
+    : _worldSize{toFloat(worldSize.x), toFloat(worldSize.y)}
+    , _numChannels(numChannels)
+{
+    _size = {
+        std::max(1, static_cast<int>(std::ceil(_worldSize.x / maxSpacing))),
+        std::max(1, static_cast<int>(std::ceil(_worldSize.y / maxSpacing)))};
+    _spacing = {_worldSize.x / _size.x, _worldSize.y / _size.y};
+    _invSpacing = {1.0f / _spacing.x, 1.0f / _spacing.y};
+    _values.resize(static_cast<size_t>(_size.x) * _size.y * numChannels);
+}
+
+void PeriodicGrid::sample(RealVector2D const& pos, float* result) const
+{
+    auto gridX = (pos.x - _worldSize.x * std::floor(pos.x / _worldSize.x)) * _invSpacing.x;
+    auto gridY = (pos.y - _worldSize.y * std::floor(pos.y / _worldSize.y)) * _invSpacing.y;
+    auto x0 = static_cast<int>(gridX);
+    auto y0 = static_cast<int>(gridY);
+    auto fractionX = gridX - toFloat(x0);
+    auto fractionY = gridY - toFloat(y0);
+
+    //floating point rounding may yield exactly the grid size
+    x0 = std::min(x0, _size.x - 1);
+    y0 = std::min(y0, _size.y - 1);
+    auto x1 = x0 + 1 < _size.x ? x0 + 1 : 0;
+    auto y1 = y0 + 1 < _size.y ? y0 + 1 : 0;
+
+    auto values00 = getValues(x0, y0);
+    auto values10 = getValues(x1, y0);
+    auto values01 = getValues(x0, y1);
+    auto values11 = getValues(x1, y1);
+    for (int channel = 0; channel < _numChannels; ++channel) {
+        auto upper = values00[channel] + (values10[channel] - values00[channel]) * fractionX;
+        auto lower = values01[channel] + (values11[channel] - values01[channel]) * fractionX;
+        result[channel] = upper + (lower - upper) * fractionY;
+    }
+}
+
+void PeriodicGrid::sample(RealVector2D const* positions, int count, float* result) const
+{
+    Parallel::forEachChunk(count, 16384, [&](int, int begin, int end) {
+        for (int index = begin; index < end; ++index) {
+            sample(positions[index], result + static_cast<size_t>(index) * _numChannels);
+        }
+    });
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <vector>
+
+#include "Definitions.h"
+#include "DllExport.h"
+#include "Parallel.h"
+
+/**
+ * Regular grid over the periodic world whose points hold numChannels floats each. Sampling interpolates bilinearly
+ * and wraps around the world boundaries. The spacing is adjusted such that the grid points divide the world evenly,
+ * hence the interpolation is continuous across the boundaries as well.
+ */
+class PeriodicGrid
+{
+public:
+    PeriodicGrid() = default;
+    BASE_EXPORT PeriodicGrid(IntVector2D const& worldSize, float maxSpacing, int numChannels);
+
+    IntVector2D const& getSize() const { return _size; }
+    RealVector2D const& getWorldSize() const { return _worldSize; }
+    RealVector2D const& getInvSpacing() const { return _invSpacing; }
+    int getNumChannels() const { return _numChannels; }
+    RealVector2D getPointPos(int x, int y) const { return {toFloat(x) * _spacing.x, toFloat(y) * _spacing.y}; }
+
+    float* getValues(int x, int y) { return &_values[(x + y * _size.x) * _numChannels]; }
+    float const* getValues(int x, int y) const { return &_values[(x + y * _size.x) * _numChannels]; }
+    std::vector<float> const& getValues() const { return _values; }  //row-major, channels of a point are adjacent
+
+    //calls func(pos, values) for all grid points, rows are processed concurrently
+    template <typename Func>
+    void fill(Func const& func);
+
+    //writes numChannels floats to result
+    BASE_EXPORT void sample(RealVector2D const& pos, float* result) const;
+    BASE_EXPORT void sample(RealVector2D const* positions, int count, float* result) const;
+
+private:
+    IntVector2D _size = {0, 0};
+    RealVector2D _worldSize;
+    RealVector2D _spacing;
+    RealVector2D _invSpacing;
+    int _numChannels = 0;
+    std::vector<float> _values;
+};
+
+/**
+ * Implementations
+ */
+template <typename Func>
+void PeriodicGrid::fill(Func const& func)
+{
+    auto minRowsPerChunk = std::max(1, 16384 / std::max(1, _size.x));
+    Parallel::forEachChunk(_size.y, minRowsPerChunk, [&](int, int begin, int end) {
+        for (int y = begin; y < end; ++y) {
+            for (int x = 0; x < _size.x; ++x) {
+                func(getPointPos(x, y), getValues(x, y));
+            }
+        }
+    });
+}
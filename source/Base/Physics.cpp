@@ -1,7 +1,94 @@
 #include "Physics.h"
 
+#include "CpuFeatures.h"
 #include "Math.h"
 
+namespace
+{
+#ifdef ALIEN_X86_SIMD
+    ALIEN_TARGET_AVX2 int tangentialVelocitiesAvx2(
+        RealVector2D const* positionsFromCenter,
+        RealVector2D const* vels,
+        RealVector2D* result,
+        int count,
+        float angularVel)
+    {
+        auto angularVelV = _mm256_setr_ps(
+            angularVel, -angularVel, angularVel, -angularVel, angularVel, -angularVel, angularVel, -angularVel);
+        int index = 0;
+        for (; index + 4 <= count; index += 4) {
+            auto rotated = _mm256_permute_ps(_mm256_loadu_ps(&positionsFromCenter[index].x), 0xb1);
+            auto vel = _mm256_loadu_ps(&vels[index].x);
+            _mm256_storeu_ps(&result[index].x, _mm256_sub_ps(vel, _mm256_mul_ps(rotated, angularVelV)));
+        }
+        return index;
+    }
+
+    ALIEN_TARGET_AVX2 int
+    rotateQuarterCounterClockwiseAvx2(RealVector2D const* vectors, RealVector2D* result, int count)
+    {
+        auto signs = _mm256_setr_ps(1.0f, -1.0f, 1.0f, -1.0f, 1.0f, -1.0f, 1.0f, -1.0f);
+        int index = 0;
+        for (; index + 4 <= count; index += 4) {
+            auto rotated = _mm256_permute_ps(_mm256_loadu_ps(&vectors[index].x), 0xb1);
+            _mm256_storeu_ps(&result[index].x, _mm256_mul_ps(rotated, signs));
+        }
+        return index;
+    }
+
+    //pairs of positions are widened to (x0, y0, x1, y1) in double precision
+    ALIEN_TARGET_AVX2 int sumPositionsAvx2(RealVector2D const* positions, int count, double& sumX, double& sumY)
+    {
+        auto sum = _mm256_setzero_pd();
+        int index = 0;
+        for (; index + 2 <= count; index += 2) {
+            sum = _mm256_add_pd(sum, _mm256_cvtps_pd(_mm_loadu_ps(&positions[index].x)));
+        }
+        double lanes[4];
+        _mm256_storeu_pd(lanes, sum);
+        sumX = lanes[0] + lanes[2];
+        sumY = lanes[1] + lanes[3];
+        return index;
+    }
+
+    ALIEN_TARGET_AVX2 int sumAngularMomentumAvx2(
+        RealVector2D const* positions,
+        RealVector2D const* vels,
+        int count,
+        RealVector2D const& center,
+        double& angularMomentum,
+        double& momentOfInertia)
+    {
+        auto centerV = _mm256_setr_pd(center.x, center.y, center.x, center.y);
+        auto momentumSum = _mm256_setzero_pd();  //(rx * vy, ry * vx, ...)
+        auto inertiaSum = _mm256_setzero_pd();
+        int index = 0;
+        for (; index + 2 <= count; index += 2) {
+            auto r = _mm256_sub_pd(_mm256_cvtps_pd(_mm_loadu_ps(&positions[index].x)), centerV);
+            auto vel = _mm256_permute_pd(_mm256_cvtps_pd(_mm_loadu_ps(&vels[index].x)), 0x5);
+            momentumSum = _mm256_add_pd(momentumSum, _mm256_mul_pd(r, vel));
+            inertiaSum = _mm256_add_pd(inertiaSum, _mm256_mul_pd(r, r));
+        }
+        double lanes[4];
+        _mm256_storeu_pd(lanes, momentumSum);
+        angularMomentum = lanes[1] + lanes[3] - lanes[0] - lanes[2];
+        _mm256_storeu_pd(lanes, inertiaSum);
+        momentOfInertia = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+        return index;
+    }
+#else
+    int tangentialVelocitiesAvx2(RealVector2D const*, RealVector2D const*, RealVector2D*, int, float) { return 0; }
+    int rotateQuarterCounterClockwiseAvx2(RealVector2D const*, RealVector2D*, int) { return 0; }
+    int sumPositionsAvx2(RealVector2D const*, int, double&, double&) { return 0; }
+    int sumAngularMomentumAvx2(RealVector2D const*, RealVector2D const*, int, RealVector2D const&, double&, double&)
+    {
+        return 0;
+    }
+#endif
+
+    bool isAvx2() { return CpuFeatures::getSimdLevel() == SimdLevel::Avx2; }
+}
+
 RealVector2D
 Physics::tangentialVelocity(RealVector2D const& positionFromCenter, RealVector2D const& vel, double angularVel)
 {
@@ -16,3 +103,62 @@ RealVector2D Physics::rotateQuarterCounterClockwise(RealVector2D v)
     v.y = -temp;
     return v;
 }
+
+void Physics::tangentialVelocities(
+    RealVector2D const* positionsFromCenter,
+    RealVector2D const* vels,
+    RealVector2D* result,
+    int count,
+    double angularVel)
+{
+    auto angularVelRad = toFloat(angularVel * degToRad);
+    int index = isAvx2() ? tangentialVelocitiesAvx2(positionsFromCenter, vels, result, count, angularVelRad) : 0;
+    for (; index < count; ++index) {
+        result[index] = vels[index] - rotateQuarterCounterClockwise(positionsFromCenter[index]) * angularVelRad;
+    }
+}
+
+void Physics::rotateQuarterCounterClockwise(RealVector2D const* vectors, RealVector2D* result, int count)
+{
+    int index = isAvx2() ? rotateQuarterCounterClockwiseAvx2(vectors, result, count) : 0;
+    for (; index < count; ++index) {
+        result[index] = rotateQuarterCounterClockwise(vectors[index]);
+    }
+}
+
+RealVector2D Physics::calcCenterOfMass(RealVector2D const* positions, int count)
+{
+    if (count == 0) {
+        return {};
+    }
+    double sumX = 0;
+    double sumY = 0;
+    int index = isAvx2() ? sumPositionsAvx2(positions, count, sumX, sumY) : 0;
+    for (; index < count; ++index) {
+        sumX += positions[index].x;
+        sumY += positions[index].y;
+    }
+    return {toFloat(sumX / count), toFloat(sumY / count)};
+}
+
+double Physics::calcAngularVelocity(
+    RealVector2D const* positions,
+    RealVector2D const* vels,
+    int count,
+    RealVector2D const& center)
+{
+    //ratio of angular momentum and moment of inertia
+    double angularMomentum = 0;
+    double momentOfInertia = 0;
+    int index = isAvx2() ? sumAngularMomentumAvx2(positions, vels, count, center, angularMomentum, momentOfInertia) : 0;
+    for (; index < count; ++index) {
+        double rx = static_cast<double>(positions[index].x) - center.x;
+        double ry = static_cast<double>(positions[index].y) - center.y;
+        angularMomentum += ry * vels[index].x - rx * vels[index].y;
+        momentOfInertia += rx * rx + ry * ry;
+    }
+    if (momentOfInertia == 0) {
+        return 0;
+    }
+    return angularMomentum / momentOfInertia * radToDeg;
+}
@@ -11,4 +11,20 @@ public:
     tangentialVelocity(RealVector2D const& positionFromCenter, RealVector2D const& vel, double angularVel);
 
     BASE_EXPORT static RealVector2D rotateQuarterCounterClockwise(RealVector2D v);
+
+    //batch versions, vectorized according to CpuFeatures
+    BASE_EXPORT static void tangentialVelocities(
+        RealVector2D const* positionsFromCenter,
+        RealVector2D const* vels,
+        RealVector2D* result,
+        int count,
+        double angularVel);
+    BASE_EXPORT static void rotateQuarterCounterClockwise(RealVector2D const* vectors, RealVector2D* result, int count);
+
+    //selections of equally weighted entities, sums are accumulated in double precision
+    BASE_EXPORT static RealVector2D calcCenterOfMass(RealVector2D const* positions, int count);
+
+    //angular velocity in degrees whose rotational part is removed by tangentialVelocity
+    BASE_EXPORT static double
+    calcAngularVelocity(RealVector2D const* positions, RealVector2D const* vels, int count, RealVector2D const& center);
 };
@@ -0,0 +1,208 @@
+#include "Tracing.h"
+
+#include <algorithm>
+#include <fstream>
+
+namespace
+{
+    size_t const MaxEventsPerThread = 1 << 20;
+
+    struct TraceEvent
+    {
+        char const* subsystem;
+        char const* name;
+        int64_t start;     //in ns since start of the service
+        int64_t duration;  //in ns
+    };
+
+    struct SubsystemAccumulator
+    {
+        char const* subsystem;
+        int64_t selfTime;  //in ns
+        uint64_t numSpans;
+    };
+
+    std::string escapeJson(std::string const& value)
+    {
+        std::string result;
+        for (auto const& c : value) {
+            if (c == '"' || c == '\\') {
+                result += '\\';
+            }
+            result += c;
+        }
+        return result;
+    }
+}
+
+struct TraceThreadBuffer
+{
+    int threadId = 0;
+
+    //only used by the owning thread
+    std::vector<int64_t> durationOfNestedSpans;
+
+    //protected by mutex since they are read by other threads
+    std::mutex mutex;
+    std::string threadName;
+    std::vector<TraceEvent> events;
+    size_t nextEventIndex = 0;
+    std::vector<SubsystemAccumulator> subsystemTimes;
+};
+
+TracingService& TracingService::getInstance()
+{
+    static TracingService instance;
+    return instance;
+}
+
+bool TracingService::isCompiledIn()
+{
+#if defined(ALIEN_TRACING)
+    return true;
+#else
+    return false;
+#endif
+}
+
+TracingService::TracingService()
+    : _recording(isCompiledIn())
+    , _startTime(Clock::now())
+{}
+
+bool TracingService::isRecording() const
+{
+    return _recording.load(std::memory_order_relaxed);
+}
+
+void TracingService::setRecording(bool value)
+{
+    _recording.store(value && isCompiledIn());
+}
+
+void TracingService::setThreadName(std::string const& name)
+{
+    auto& buffer = getThreadBuffer();
+    std::lock_guard<std::mutex> lock(buffer.mutex);
+    buffer.threadName = name;
+}
+
+void TracingService::beginSpan()
+{
+    getThreadBuffer().durationOfNestedSpans.emplace_back(0);
+}
+
+void TracingService::endSpan(char const* subsystem, char const* name, Clock::time_point const& start)
+{
+    auto end = Clock::now();
+    auto& buffer = getThreadBuffer();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+    auto selfTime = duration - buffer.durationOfNestedSpans.back();
+    buffer.durationOfNestedSpans.pop_back();
+    if (!buffer.durationOfNestedSpans.empty()) {
+        buffer.durationOfNestedSpans.back() += duration;
+    }
+
+    std::lock_guard<std::mutex> lock(buffer.mutex);
+    TraceEvent event{
+        subsystem, name, std::chrono::duration_cast<std::chrono::nanoseconds>(start - _startTime).count(), duration};
+    if (buffer.events.size() < MaxEventsPerThread) {
+        buffer.events.emplace_back(event);
+    } else {
+        buffer.events.at(buffer.nextEventIndex) = event;  //oldest event is overwritten
+    }
+    buffer.nextEventIndex = (buffer.nextEventIndex + 1) % MaxEventsPerThread;
+
+    //subsystems are string literals, hence comparing pointers is sufficient in almost all cases
+    auto findResult = std::find_if(
+        buffer.subsystemTimes.begin(), buffer.subsystemTimes.end(), [&](SubsystemAccumulator const& accumulator) {
+            return accumulator.subsystem == subsystem;
+        });
+    if (findResult != buffer.subsystemTimes.end()) {
+        findResult->selfTime += selfTime;
+        ++findResult->numSpans;
+    } else {
+        buffer.subsystemTimes.emplace_back(SubsystemAccumulator{subsystem, selfTime, 1});
+    }
+}
+
+void TracingService::writeChromeTrace(std::string const& filename)
+{
+    std::ofstream stream(filename, std::ios::trunc);
+    if (!stream) {
+        throw std::runtime_error("The file " + filename + " could not be opened.");
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    stream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    auto separator = [&] {
+        if (!first) {
+            stream << ",\n";
+        }
+        first = false;
+    };
+    for (auto const& buffer : _buffers) {
+        std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+        if (!buffer->threadName.empty()) {
+            separator();
+            stream << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->threadId
+                   << ",\"args\":{\"name\":\"" << escapeJson(buffer->threadName) << "\"}}";
+        }
+        for (auto const& event : buffer->events) {
+            separator();
+            stream << "{\"name\":\"" << escapeJson(event.name) << "\",\"cat\":\"" << escapeJson(event.subsystem)
+                   << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->threadId << ",\"ts\":" << event.start / 1000
+                   << "." << event.start % 1000 / 100 << ",\"dur\":" << event.duration / 1000 << "."
+                   << event.duration % 1000 / 100 << "}";
+        }
+    }
+    stream << "]}" << std::endl;
+}
+
+std::vector<SubsystemTime> TracingService::getSubsystemTimes()
+{
+    std::vector<SubsystemTime> result;
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (auto const& buffer : _buffers) {
+        std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+        for (auto const& accumulator : buffer->subsystemTimes) {
+            auto findResult = std::find_if(result.begin(), result.end(), [&](SubsystemTime const& subsystemTime) {
+                return subsystemTime.subsystem == accumulator.subsystem;
+            });
+            if (findResult == result.end()) {
+                result.emplace_back(SubsystemTime{accumulator.subsystem});
+                findResult = result.end() - 1;
+            }
+            findResult->selfTime += static_cast<double>(accumulator.selfTime) / 1.0e9;
+            findResult->numSpans += accumulator.numSpans;
+        }
+    }
+    std::sort(result.begin(), result.end(), [](SubsystemTime const& left, SubsystemTime const& right) {
+        return left.selfTime > right.selfTime;
+    });
+    return result;
+}
+
+void TracingService::resetSubsystemTimes()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (auto const& buffer : _buffers) {
+        std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+        buffer->subsystemTimes.clear();
+    }
+}
+
+TraceThreadBuffer& TracingService::getThreadBuffer()
+{
+    thread_local TraceThreadBuffer* threadBuffer = nullptr;
+    if (!threadBuffer) {
+        auto buffer = boost::make_shared<TraceThreadBuffer>();
+        std::lock_guard<std::mutex> lock(_mutex);
+        buffer->threadId = toInt(_buffers.size()) + 1;
+        _buffers.emplace_back(buffer);
+        threadBuffer = buffer.get();
+    }
+    return *threadBuffer;
+}
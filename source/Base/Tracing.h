@@ -0,0 +1,98 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+
+#include "Definitions.h"
+
+/**
+ * Host-side tracing of scoped spans. Spans are recorded into thread-local ring buffers and can be dumped in the
+ * Chrome/Perfetto JSON trace format. The macro TRACE_SCOPE is only active if compiled with ALIEN_TRACING.
+ */
+#if defined(ALIEN_TRACING)
+#define TRACE_CONCAT_INTERN(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INTERN(a, b)
+#define TRACE_SCOPE(subsystem, name) TraceScope TRACE_CONCAT(traceScope, __LINE__)(subsystem, name)
+#else
+#define TRACE_SCOPE(subsystem, name)
+#endif
+
+struct SubsystemTime
+{
+    std::string subsystem;
+    double selfTime = 0;  //in seconds, without the time of nested spans of the same thread
+    uint64_t numSpans = 0;
+};
+
+struct TraceThreadBuffer;
+
+class TracingService
+{
+public:
+    BASE_EXPORT static TracingService& getInstance();
+
+    BASE_EXPORT static bool isCompiledIn();
+
+    BASE_EXPORT bool isRecording() const;
+    BASE_EXPORT void setRecording(bool value);
+
+    BASE_EXPORT void setThreadName(std::string const& name);   //for the calling thread
+
+    BASE_EXPORT void writeChromeTrace(std::string const& filename);
+
+    //accumulated since the last reset, sorted by decreasing self time
+    BASE_EXPORT std::vector<SubsystemTime> getSubsystemTimes();
+    BASE_EXPORT void resetSubsystemTimes();
+
+    using Clock = std::chrono::steady_clock;
+    void beginSpan();
+    void endSpan(char const* subsystem, char const* name, Clock::time_point const& start);
+
+public:
+    TracingService(TracingService const&) = delete;
+    void operator=(TracingService const&) = delete;
+
+private:
+    TracingService();
+
+    TraceThreadBuffer& getThreadBuffer();
+
+    std::atomic<bool> _recording;
+    Clock::time_point _startTime;
+
+    std::mutex _mutex;
+    std::vector<boost::shared_ptr<TraceThreadBuffer>> _buffers;
+};
+
+class TraceScope
+{
+public:
+    TraceScope(char const* subsystem, char const* name)
+        : _subsystem(subsystem)
+        , _name(name)
+    {
+        auto& service = TracingService::getInstance();
+        _active = service.isRecording();
+        if (_active) {
+            service.beginSpan();
+            _start = TracingService::Clock::now();
+        }
+    }
+
+    ~TraceScope()
+    {
+        if (_active) {
+            TracingService::getInstance().endSpan(_subsystem, _name, _start);
+        }
+    }
+
+    TraceScope(TraceScope const&) = delete;
+    void operator=(TraceScope const&) = delete;
+
+private:
+    char const* _subsystem;
+    char const* _name;
+    bool _active = false;
+    TracingService::Clock::time_point _start;
+};
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <utility>
+
 #include <boost/optional.hpp>
 
 template<typename T>
@@ -46,8 +48,8 @@ private:
 public:
 
 	StateTracker() = delete;
-	StateTracker(T const &v) : _value(v) {}
-	StateTracker(T const &v, State s) : _state(s), _value(v) {}
+	StateTracker(T v) : _value(std::move(v)) {}
+	StateTracker(T v, State s) : _state(s), _value(std::move(v)) {}
 
 	T const* operator->() const { return &_value; }
 	T* operator->() { return &_value; }
@@ -60,6 +62,6 @@ public:
 	StateTracker& setAsModified() { _state = State::Modified; return *this; }
 	T const& getValue() const { return _value; }
 	T & getValue() { return _value; }
-	StateTracker& setValue(T const& v) { _value = v; return *this; }
+	StateTracker& setValue(T v) { _value = std::move(v); return *this; }
 };
 
@@ -0,0 +1,100 @@
+#include "AllocationCounter.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    std::atomic<uint64_t> numAllocations{0};
+}
+
+AllocationCounter::AllocationCounter()
+    : _startValue(numAllocations.load())
+{}
+
+uint64_t AllocationCounter::getNumAllocations() const
+{
+    return numAllocations.load() - _startValue;
+}
+
+void AllocationCounter::increment()
+{
+    numAllocations.fetch_add(1, std::memory_order_relaxed);
+}
+
+void* operator new(std::size_t size)
+{
+    AllocationCounter::increment();
+    if (auto result = std::malloc(size == 0 ? 1 : size)) {
+        return result;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept
+{
+    std::free(pointer);
+}
+
+//aligned variants are used by std::pmr::new_delete_resource, the original pointer is stored in front of the block
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    AllocationCounter::increment();
+    auto align = static_cast<std::size_t>(alignment);
+    if (auto original = std::malloc(size + align + sizeof(void*))) {
+        auto address = reinterpret_cast<std::uintptr_t>(original) + sizeof(void*);
+        auto result = reinterpret_cast<void*>((address + align - 1) / align * align);
+        reinterpret_cast<void**>(result)[-1] = original;
+        return result;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return operator new(size, alignment);
+}
+
+void operator delete(void* pointer, std::align_val_t) noexcept
+{
+    if (pointer) {
+        std::free(reinterpret_cast<void**>(pointer)[-1]);
+    }
+}
+
+void operator delete[](void* pointer, std::align_val_t alignment) noexcept
+{
+    operator delete(pointer, alignment);
+}
+
+void operator delete(void* pointer, std::size_t, std::align_val_t alignment) noexcept
+{
+    operator delete(pointer, alignment);
+}
+
+void operator delete[](void* pointer, std::size_t, std::align_val_t alignment) noexcept
+{
+    operator delete(pointer, alignment);
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstdint>
+
+/**
+ * Counts heap allocations of the whole process. alien-benchmarks replaces the global operator new for this purpose.
+ */
+class AllocationCounter
+{
+public:
+    AllocationCounter();
+
+    uint64_t getNumAllocations() const;  //since construction
+
+    static void increment();
+
+private:
+    uint64_t _startValue;
+};
@@ -0,0 +1,116 @@
+#include <cmath>
+#include <random>
+
+#include "Base/CpuFeatures.h"
+#include "Base/Math.h"
+#include "Base/Physics.h"
+
+#include "BenchmarkFramework.h"
+
+namespace
+{
+    int const NumVectors = 1000000;
+    RealVector2D const Center{500.0f, 500.0f};
+
+    std::vector<RealVector2D> getRandomVectors(unsigned int seed, float min, float max)
+    {
+        std::mt19937 generator(seed);
+        std::uniform_real_distribution<float> distribution(min, max);
+        std::vector<RealVector2D> result;
+        result.reserve(NumVectors);
+        for (int i = 0; i < NumVectors; ++i) {
+            result.emplace_back(distribution(generator), distribution(generator));
+        }
+        return result;
+    }
+}
+
+BENCHMARK(BatchMath, selectionWith1MEntities)
+{
+    auto positions = getRandomVectors(0, 0.0f, 1000.0f);
+    auto vels = getRandomVectors(1, -1.0f, 1.0f);
+    std::vector<RealVector2D> relPositions;
+    relPositions.reserve(NumVectors);
+    for (auto const& pos : positions) {
+        relPositions.emplace_back(pos - Center);
+    }
+    std::vector<float> values(NumVectors);
+    std::vector<RealVector2D> vectors(NumVectors);
+
+    //loops over the single element helpers
+    Benchmark::measure("length per element", [&] {
+        for (int i = 0; i < NumVectors; ++i) {
+            values[i] = toFloat(Math::length(relPositions[i]));
+        }
+        Benchmark::keep(values.back());
+    });
+    Benchmark::measure("angleOfVector per element", [&] {
+        for (int i = 0; i < NumVectors; ++i) {
+            values[i] = toFloat(Math::angleOfVector(relPositions[i]));
+        }
+        Benchmark::keep(values.back());
+    });
+    Benchmark::measure("tangentialVelocity per element", [&] {
+        for (int i = 0; i < NumVectors; ++i) {
+            vectors[i] = Physics::tangentialVelocity(relPositions[i], vels[i], 2.0);
+        }
+        Benchmark::keep(vectors.back().x);
+    });
+    Benchmark::measure("rotation per element", [&] {
+        auto cosAngle = std::cos(30.0 * degToRad);
+        auto sinAngle = std::sin(30.0 * degToRad);
+        for (int i = 0; i < NumVectors; ++i) {
+            auto const& r = relPositions[i];
+            RealVector2D rotated{toFloat(r.x * cosAngle - r.y * sinAngle), toFloat(r.y * cosAngle + r.x * sinAngle)};
+            vectors[i] = Center + rotated;
+        }
+        Benchmark::keep(vectors.back().x);
+    });
+    Benchmark::measure("center of mass and angular velocity per element", [&] {
+        RealVector2D sum;
+        for (auto const& pos : positions) {
+            sum += pos;
+        }
+        auto center = sum / toFloat(NumVectors);
+        double angularMomentum = 0;
+        double momentOfInertia = 0;
+        for (int i = 0; i < NumVectors; ++i) {
+            auto r = positions[i] - center;
+            angularMomentum += r.y * vels[i].x - r.x * vels[i].y;
+            momentOfInertia += Math::length(r) * Math::length(r);
+        }
+        Benchmark::keep(angularMomentum / momentOfInertia);
+    });
+
+    CpuFeatures::setSimdLevelLimit(SimdLevel::Avx2);
+    auto maxLevel = CpuFeatures::getSimdLevel();
+    for (auto level : {SimdLevel::Scalar, SimdLevel::Avx2}) {
+        if (level > maxLevel) {
+            break;
+        }
+        CpuFeatures::setSimdLevelLimit(level);
+        auto name = level == SimdLevel::Avx2 ? std::string(" AVX2") : std::string(" scalar");
+        Benchmark::measure("lengths" + name, [&] {
+            Math::lengths(relPositions.data(), values.data(), NumVectors);
+            Benchmark::keep(values.back());
+        });
+        Benchmark::measure("anglesOfVectors" + name, [&] {
+            Math::anglesOfVectors(relPositions.data(), values.data(), NumVectors);
+            Benchmark::keep(values.back());
+        });
+        Benchmark::measure("tangentialVelocities" + name, [&] {
+            Physics::tangentialVelocities(relPositions.data(), vels.data(), vectors.data(), NumVectors, 2.0);
+            Benchmark::keep(vectors.back().x);
+        });
+        Benchmark::measure("rotate" + name, [&] {
+            vectors = positions;
+            Math::rotate(vectors.data(), NumVectors, Center, 30.0);
+            Benchmark::keep(vectors.back().x);
+        });
+        Benchmark::measure("center of mass and angular velocity" + name, [&] {
+            auto center = Physics::calcCenterOfMass(positions.data(), NumVectors);
+            Benchmark::keep(Physics::calcAngularVelocity(positions.data(), vels.data(), NumVectors, center));
+        });
+    }
+    CpuFeatures::setSimdLevelLimit(SimdLevel::Avx2);
+}
@@ -0,0 +1,56 @@
+#include "BenchmarkFramework.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+BenchmarkRegistry& BenchmarkRegistry::getInstance()
+{
+    static BenchmarkRegistry instance;
+    return instance;
+}
+
+void BenchmarkRegistry::add(std::string const& name, BenchmarkFunction const& function)
+{
+    _benchmarks.emplace_back(name, function);
+}
+
+int BenchmarkRegistry::runAll(std::string const& filter) const
+{
+    int numFailures = 0;
+    for (auto const& [name, function] : _benchmarks) {
+        if (name.find(filter) == std::string::npos) {
+            continue;
+        }
+        std::cout << name << std::endl;
+        try {
+            function();
+        } catch (std::exception const& e) {
+            ++numFailures;
+            std::cout << "  [FAILED] " << e.what() << std::endl;
+        }
+    }
+    return numFailures;
+}
+
+double Benchmark::measure(std::string const& label, std::function<void()> const& function, int repetitions)
+{
+    std::vector<double> durations;
+    for (int i = 0; i < repetitions; ++i) {
+        auto startTime = std::chrono::steady_clock::now();
+        function();
+        durations.emplace_back(
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count());
+    }
+    std::sort(durations.begin(), durations.end());
+    auto result = durations.at(durations.size() / 2);
+    std::cout << "  " << std::left << std::setw(48) << label << std::right << std::fixed << std::setprecision(3)
+              << std::setw(12) << result << " ms" << std::endl;
+    return result;
+}
+
+void Benchmark::report(std::string const& label, std::string const& value)
+{
+    std::cout << "  " << std::left << std::setw(48) << label << std::right << std::setw(15) << value << std::endl;
+}
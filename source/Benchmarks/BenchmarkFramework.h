@@ -0,0 +1,58 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <string>
+#include <vector>
+
+/**
+ * Registry of host-side benchmarks. Benchmarks are registered by the BENCHMARK macro and executed by
+ * alien-benchmarks. Each benchmark prints its measurements, there are no pass/fail criteria.
+ */
+class BenchmarkRegistry
+{
+public:
+    using BenchmarkFunction = std::function<void()>;
+
+    static BenchmarkRegistry& getInstance();
+
+    void add(std::string const& name, BenchmarkFunction const& function);
+    int runAll(std::string const& filter) const;  //returns the number of benchmarks which threw an exception
+
+private:
+    std::vector<std::pair<std::string, BenchmarkFunction>> _benchmarks;
+};
+
+struct BenchmarkRegistration
+{
+    BenchmarkRegistration(std::string const& name, BenchmarkRegistry::BenchmarkFunction const& function)
+    {
+        BenchmarkRegistry::getInstance().add(name, function);
+    }
+};
+
+namespace Benchmark
+{
+    //executes the function repeatedly and prints the median duration
+    double measure(std::string const& label, std::function<void()> const& function, int repetitions = 5);
+
+    void report(std::string const& label, std::string const& value);
+
+    //prevents the compiler from discarding the computation of a value
+    template <typename T>
+    void keep(T const& value)
+    {
+#if defined(_MSC_VER)
+        static void const* volatile sink;
+        sink = &value;
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+#else
+        asm volatile("" : : "g"(&value) : "memory");
+#endif
+    }
+}
+
+#define BENCHMARK(suite, name) \
+    static void suite##_##name(); \
+    static BenchmarkRegistration suite##_##name##_registration(#suite "." #name, &suite##_##name); \
+    static void suite##_##name()
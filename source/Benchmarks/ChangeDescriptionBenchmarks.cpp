@@ -0,0 +1,129 @@
+#include "EngineInterface/ChangeDescriptions.h"
+#include "EngineInterface/Descriptions.h"
+
+#include "AllocationCounter.h"
+#include "BenchmarkFramework.h"
+
+namespace
+{
+    int const NumClusters = 100000;
+    int const CellsPerCluster = 10;
+    int const NumParticles = 100000;
+    int const NumChangedClusters = 1000;
+
+    DataDescription createData()
+    {
+        DataDescription result;
+        result.reserve(NumClusters, NumParticles);
+        uint64_t id = 1;
+        for (int i = 0; i < NumClusters; ++i) {
+            auto& cluster = result.emplaceCluster();
+            cluster.setId(id++).reserve(CellsPerCluster);
+            for (int j = 0; j < CellsPerCluster; ++j) {
+                auto& cell = cluster.emplaceCell();
+                cell.setId(id++).setPos({toFloat(i % 1000), toFloat(i / 1000 + j)}).setEnergy(100.0);
+                if (j > 0) {
+                    cell.connections.emplace_back(ConnectionDescription{id - 2, 1.0f, 0.0f});
+                }
+            }
+        }
+        for (int i = 0; i < NumParticles; ++i) {
+            result.emplaceParticle().setId(id++).setEnergy(10.0);
+        }
+        return result;
+    }
+
+    std::vector<CellDescription const*> getCells(DataDescription const& data)
+    {
+        std::vector<CellDescription const*> result;
+        for (auto const& cluster : data.clusters) {
+            for (auto const& cell : cluster.cells) {
+                result.emplace_back(&cell);
+            }
+        }
+        return result;
+    }
+
+    void reportAllocations(std::string const& label, std::function<void()> const& function)
+    {
+        AllocationCounter counter;
+        function();
+        Benchmark::report(label, std::to_string(counter.getNumAllocations()) + " allocs");
+    }
+}
+
+BENCHMARK(DataChangeDescription, diffWith1MCells)
+{
+    auto dataBefore = createData();
+    auto dataAfter = dataBefore;
+
+    Benchmark::measure("diff of unchanged data", [&] {
+        Benchmark::keep(DataChangeDescription(dataBefore, dataAfter).cells.size());
+    });
+
+    //one cell is modified in each of the changed clusters
+    for (int i = 0; i < NumChangedClusters; ++i) {
+        dataAfter.clusters.at(i * (NumClusters / NumChangedClusters)).cells.front().setEnergy(50.0);
+    }
+    Benchmark::measure("diff after changing 1000 clusters", [&] {
+        Benchmark::keep(DataChangeDescription(dataBefore, dataAfter).cells.size());
+    });
+
+    for (auto& cluster : dataAfter.clusters) {
+        cluster.cells.back().setEnergy(50.0);
+    }
+    Benchmark::measure("diff after changing all clusters", [&] {
+        Benchmark::keep(DataChangeDescription(dataBefore, dataAfter).cells.size());
+    });
+    Benchmark::measure(
+        "full conversion for comparison", [&] { Benchmark::keep(DataChangeDescription(dataAfter).cells.size()); });
+}
+
+BENCHMARK(CellChangeDescription, buildAndConvert1MRecords)
+{
+    auto data = createData();
+    auto cellsBefore = getCells(data);
+    auto dataAfter = data;
+    for (auto& cluster : dataAfter.clusters) {
+        for (auto& cell : cluster.cells) {
+            cell.setEnergy(50.0);
+        }
+    }
+    auto cellsAfter = getCells(dataAfter);
+
+    Benchmark::report("size of CellDescription", std::to_string(sizeof(CellDescription)) + " bytes");
+    Benchmark::report("size of CellChangeDescription", std::to_string(sizeof(CellChangeDescription)) + " bytes");
+
+    auto buildRecords = [&](bool keepOldValues) {
+        std::vector<CellChangeDescription> result;
+        result.reserve(cellsBefore.size());
+        for (int i = 0; i < cellsBefore.size(); ++i) {
+            result.emplace_back(*cellsBefore.at(i), *cellsAfter.at(i), keepOldValues);
+        }
+        return result;
+    };
+    reportAllocations("1M energy changes", [&] { Benchmark::keep(buildRecords(false).size()); });
+    reportAllocations("1M energy changes with old values", [&] { Benchmark::keep(buildRecords(true).size()); });
+    Benchmark::measure("1M energy changes", [&] { Benchmark::keep(buildRecords(false).size()); });
+    Benchmark::measure("1M energy changes with old values", [&] { Benchmark::keep(buildRecords(true).size()); });
+
+    auto records = buildRecords(false);
+    Benchmark::measure("apply 1M energy changes", [&] {
+        auto record = records.begin();
+        for (auto& cluster : data.clusters) {
+            for (auto& cell : cluster.cells) {
+                cell.applyChange(*record++);
+            }
+        }
+    });
+
+    DataChangeDescription newCells(dataAfter);
+    Benchmark::measure("1M CellDescriptions from new cell records", [&] {
+        std::vector<CellDescription> cells;
+        cells.reserve(newCells.cells.size());
+        for (auto const& cell : newCells.cells) {
+            cells.emplace_back(cell.getValue());
+        }
+        Benchmark::keep(cells.size());
+    });
+}
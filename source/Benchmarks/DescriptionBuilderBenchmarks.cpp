@@ -0,0 +1,153 @@
+#include <unordered_map>
+
+#include "EngineInterface/ChangeDescriptions.h"
+#include "EngineInterface/DescriptionArena.h"
+#include "EngineInterface/Descriptions.h"
+
+#include "AllocationCounter.h"
+#include "BenchmarkFramework.h"
+
+namespace
+{
+    int const NumClusters = 1000;
+    int const CellsPerCluster = 100;
+
+    //strings exceed the small string optimization
+    CellMetadata createMetadata()
+    {
+        return CellMetadata()
+            .setName("cell name which is long enough")
+            .setDescription("cell description which is long enough")
+            .setSourceCode("mov [1], [2]\nadd [1], 3\n");
+    }
+
+    TokenDescription createToken() { return TokenDescription().setEnergy(10).setData(std::string(256, 'a')); }
+
+    //usage before the builders were move-aware: every element is created first and copied into its container
+    DataDescription buildByCopies()
+    {
+        DataDescription result;
+        uint64_t id = 1;
+        for (int i = 0; i < NumClusters; ++i) {
+            ClusterDescription cluster;
+            cluster.setId(id++);
+            for (int j = 0; j < CellsPerCluster; ++j) {
+                auto metadata = createMetadata();
+                auto token = createToken();
+                CellDescription cell;
+                cell.setId(id++).setPos({toFloat(i), toFloat(j)}).setMetadata(metadata).addToken(token);
+                cluster.addCell(cell);
+            }
+            result.addCluster(cluster);
+        }
+        return result;
+    }
+
+    //strings are written into the description as DataConverter does, hence they use its allocator
+    void buildInPlace(DataDescription& result)
+    {
+        auto metadata = createMetadata();
+        auto token = createToken();
+        result.reserve(NumClusters, 0);
+        uint64_t id = 1;
+        for (int i = 0; i < NumClusters; ++i) {
+            auto& cluster = result.emplaceCluster();
+            cluster.setId(id++).reserve(CellsPerCluster);
+            for (int j = 0; j < CellsPerCluster; ++j) {
+                auto& cell = cluster.emplaceCell().setId(id++).setPos({toFloat(i), toFloat(j)});
+                cell.metadata.setName(metadata.name)
+                    .setDescription(metadata.description)
+                    .setSourceCode(metadata.computerSourcecode);
+                cell.tokens.emplace_back().setEnergy(token.energy).setData(token.data);
+            }
+        }
+    }
+
+    DataDescription buildInPlace()
+    {
+        DataDescription result;
+        buildInPlace(result);
+        return result;
+    }
+
+    //the description is dropped at the end of the scope as it happens for snapshots
+    void buildAndDrop() { Benchmark::keep(buildInPlace().clusters.size()); }
+    void buildAndDropInArena()
+    {
+        DescriptionArena arena;
+        buildInPlace(arena.getData());
+        Benchmark::keep(arena.getData().clusters.size());
+    }
+
+    void reportAllocations(std::string const& label, std::function<void()> const& function)
+    {
+        AllocationCounter counter;
+        function();
+        Benchmark::report(label, std::to_string(counter.getNumAllocations()) + " allocs");
+    }
+}
+
+BENCHMARK(DescriptionBuilders, allocationsFor100kCells)
+{
+    reportAllocations("build with copied elements", [] { Benchmark::keep(buildByCopies().clusters.size()); });
+    reportAllocations("build in place", [] { Benchmark::keep(buildInPlace().clusters.size()); });
+
+    auto data = buildInPlace();
+    reportAllocations(
+        "DataChangeDescription(data)", [&] { Benchmark::keep(DataChangeDescription(data).cells.size()); });
+
+    Benchmark::measure("build with copied elements", [] { Benchmark::keep(buildByCopies().clusters.size()); });
+    Benchmark::measure("build in place", [] { Benchmark::keep(buildInPlace().clusters.size()); });
+    Benchmark::measure(
+        "DataChangeDescription(data)", [&] { Benchmark::keep(DataChangeDescription(data).cells.size()); });
+}
+
+BENCHMARK(DescriptionBuilders, arenaFor100kCells)
+{
+    reportAllocations("build and drop", [] { buildAndDrop(); });
+    reportAllocations("build and drop in arena", [] { buildAndDropInArena(); });
+
+    Benchmark::measure("build and drop", [] { buildAndDrop(); });
+    Benchmark::measure("build and drop in arena", [] { buildAndDropInArena(); });
+}
+
+BENCHMARK(DescriptionBuilders, connectionsFor100kLattice)
+{
+    //316 x 316 cells connected to their right and lower neighbors
+    int const LatticeSize = 316;
+    ClusterDescription cluster;
+    std::vector<std::pair<uint64_t, uint64_t>> cellIdPairs;
+    for (int y = 0; y < LatticeSize; ++y) {
+        for (int x = 0; x < LatticeSize; ++x) {
+            uint64_t id = y * LatticeSize + x + 1;
+            cluster.addCell(CellDescription().setId(id).setPos({toFloat(x), toFloat(y)}).setMaxConnections(4));
+            if (x + 1 < LatticeSize) {
+                cellIdPairs.emplace_back(id, id + 1);
+            }
+            if (y + 1 < LatticeSize) {
+                cellIdPairs.emplace_back(id, id + LatticeSize);
+            }
+        }
+    }
+
+    //each repetition works on a fresh copy, the copy is measured separately
+    Benchmark::measure("copy", [&] { Benchmark::keep(ClusterDescription(cluster).cells.size()); });
+    Benchmark::measure("copy and addConnections", [&] {
+        auto connectedCluster = cluster;
+        connectedCluster.addConnections(cellIdPairs);
+        Benchmark::keep(connectedCluster.cells.size());
+    });
+
+    //single repetition since the sequential variant takes several seconds
+    Benchmark::measure(
+        "copy and addConnection per pair",
+        [&] {
+            auto connectedCluster = cluster;
+            std::unordered_map<uint64_t, int> cache;
+            for (auto const& [cellId1, cellId2] : cellIdPairs) {
+                connectedCluster.addConnection(cellId1, cellId2, cache);
+            }
+            Benchmark::keep(connectedCluster.cells.size());
+        },
+        1);
+}
@@ -0,0 +1,50 @@
+#include "EngineInterface/DescriptionHelper.h"
+#include "EngineInterface/Descriptions.h"
+
+#include "BenchmarkFramework.h"
+
+namespace
+{
+    int const NumClusters = 25000;
+    int const CellsPerCluster = 10;
+    int const NumParticles = 25000;
+    IntVector2D const WorldSize{1000, 1000};
+
+    DataDescription createData()
+    {
+        DataDescription result;
+        result.reserve(NumClusters, NumParticles);
+        uint64_t id = 1;
+        for (int i = 0; i < NumClusters; ++i) {
+            auto& cluster = result.emplaceCluster();
+            cluster.setId(id++).reserve(CellsPerCluster);
+            auto pos = RealVector2D{toFloat(i % 100 * 10), toFloat(i / 100 * 4)};
+            for (int j = 0; j < CellsPerCluster; ++j) {
+                auto& cell = cluster.emplaceCell();
+                cell.setId(id++).setPos({pos.x + toFloat(j % 5), pos.y + toFloat(j / 5)});
+                if (j > 0) {
+                    cell.connections.emplace_back(ConnectionDescription{id - 2, 1.0f, 0.0f});
+                }
+            }
+        }
+        for (int i = 0; i < NumParticles; ++i) {
+            result.emplaceParticle().setId(id++).setPos({toFloat(i % 1000), toFloat(i / 1000)});
+        }
+        return result;
+    }
+}
+
+BENCHMARK(DescriptionHelper, duplicateTo4xWorldWith250kCells)
+{
+    auto data = createData();
+
+    //each repetition works on a fresh copy, the copy is measured separately
+    Benchmark::measure("copy", [&] { Benchmark::keep(DataDescription(data).clusters.size()); });
+    Benchmark::measure("copy and duplicate to 4x world", [&] {
+        auto dataToDuplicate = data;
+        DescriptionNavigator navigator;
+        navigator.update(dataToDuplicate);
+        DescriptionHelper::duplicate(dataToDuplicate, navigator, WorldSize, {WorldSize.x * 2, WorldSize.y * 2});
+        Benchmark::keep(dataToDuplicate.clusters.size());
+    });
+}
@@ -0,0 +1,145 @@
+#include <map>
+#include <random>
+#include <unordered_set>
+
+#include "EngineInterface/ChangeDescriptions.h"
+#include "EngineInterface/Descriptions.h"
+
+#include "BenchmarkFramework.h"
+
+namespace
+{
+    //navigator before the introduction of flat hash maps
+    struct StdMapDescriptionNavigator
+    {
+        std::unordered_set<uint64_t> cellIds;
+        std::unordered_set<uint64_t> particleIds;
+        std::map<uint64_t, uint64_t> clusterIdsByCellIds;
+        std::map<uint64_t, int> clusterIndicesByClusterIds;
+        std::map<uint64_t, int> clusterIndicesByCellIds;
+        std::map<uint64_t, int> cellIndicesByCellIds;
+        std::map<uint64_t, int> particleIndicesByParticleIds;
+
+        void update(DataDescription const& data)
+        {
+            cellIds.clear();
+            particleIds.clear();
+            clusterIdsByCellIds.clear();
+            clusterIndicesByCellIds.clear();
+            clusterIndicesByClusterIds.clear();
+            cellIndicesByCellIds.clear();
+            particleIndicesByParticleIds.clear();
+
+            int clusterIndex = 0;
+            for (auto const& cluster : data.clusters) {
+                clusterIndicesByClusterIds.insert_or_assign(cluster.id, clusterIndex);
+                int cellIndex = 0;
+                for (auto const& cell : cluster.cells) {
+                    clusterIdsByCellIds.insert_or_assign(cell.id, cluster.id);
+                    clusterIndicesByCellIds.insert_or_assign(cell.id, clusterIndex);
+                    cellIndicesByCellIds.insert_or_assign(cell.id, cellIndex);
+                    cellIds.insert(cell.id);
+                    ++cellIndex;
+                }
+                ++clusterIndex;
+            }
+
+            int particleIndex = 0;
+            for (auto const& particle : data.particles) {
+                particleIndicesByParticleIds.insert_or_assign(particle.id, particleIndex);
+                particleIds.insert(particle.id);
+                ++particleIndex;
+            }
+        }
+    };
+
+    int const NumClusters = 100000;
+    int const CellsPerCluster = 10;
+    int const NumParticles = 100000;
+    int const NumLookups = 1000000;
+    int const NumDeletedCells = 1000;
+
+    DataDescription createData()
+    {
+        DataDescription result;
+        result.reserve(NumClusters, NumParticles);
+        uint64_t id = 1;
+        for (int i = 0; i < NumClusters; ++i) {
+            auto& cluster = result.emplaceCluster();
+            cluster.setId(id++).reserve(CellsPerCluster);
+            for (int j = 0; j < CellsPerCluster; ++j) {
+                cluster.emplaceCell().setId(id++);
+            }
+        }
+        for (int i = 0; i < NumParticles; ++i) {
+            result.emplaceParticle().setId(id++);
+        }
+        return result;
+    }
+
+    std::vector<uint64_t> getRandomCellIds(DataDescription const& data)
+    {
+        std::mt19937 generator(0);
+        std::uniform_int_distribution<int> clusterDistribution(0, NumClusters - 1);
+        std::uniform_int_distribution<int> cellDistribution(0, CellsPerCluster - 1);
+        std::vector<uint64_t> result;
+        result.reserve(NumLookups);
+        for (int i = 0; i < NumLookups; ++i) {
+            auto const& cluster = data.clusters.at(clusterDistribution(generator));
+            result.emplace_back(cluster.cells.at(cellDistribution(generator)).id);
+        }
+        return result;
+    }
+}
+
+BENCHMARK(DescriptionNavigator, rebuildAndLookupWith1MCells)
+{
+    auto data = createData();
+    auto cellIds = getRandomCellIds(data);
+
+    StdMapDescriptionNavigator stdMapNavigator;
+    DescriptionNavigator navigator;
+    Benchmark::measure("rebuild (std::map)", [&] { stdMapNavigator.update(data); });
+    Benchmark::measure("rebuild (flat hash map)", [&] { navigator.update(data); });
+
+    Benchmark::measure("1M lookups (std::map)", [&] {
+        int sum = 0;
+        for (auto const& id : cellIds) {
+            sum += stdMapNavigator.cellIndicesByCellIds.at(id);
+        }
+        Benchmark::keep(sum);
+    });
+    Benchmark::measure("1M lookups (flat hash map)", [&] {
+        int sum = 0;
+        for (auto const& id : cellIds) {
+            sum += navigator.cellIndicesByCellIds.at(id);
+        }
+        Benchmark::keep(sum);
+    });
+}
+
+BENCHMARK(DescriptionNavigator, incrementalUpdateWith1MCells)
+{
+    auto data = createData();
+
+    //deletes one cell in each of the first clusters
+    DataChangeDescription changes;
+    for (int i = 0; i < NumDeletedCells; ++i) {
+        auto& cells = data.clusters.at(i * (NumClusters / NumDeletedCells)).cells;
+        changes.addDeletedCell(CellChangeDescription().setId(cells.back().id));
+        cells.pop_back();
+    }
+
+    DescriptionNavigator navigator;
+    Benchmark::measure("full update after 1000 deleted cells", [&] { navigator.update(data); });
+
+    std::vector<DescriptionNavigator> navigatorsBeforeChange(5);
+    auto dataBeforeChange = createData();
+    for (auto& navigatorBeforeChange : navigatorsBeforeChange) {
+        navigatorBeforeChange.update(dataBeforeChange);
+    }
+    int repetition = 0;
+    Benchmark::measure("incremental update after 1000 deleted cells", [&] {
+        navigatorsBeforeChange.at(repetition++).update(data, changes);
+    });
+}
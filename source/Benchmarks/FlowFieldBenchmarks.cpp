@@ -0,0 +1,69 @@
+#include <random>
+
+#include "EngineInterface/FlowFieldGrid.h"
+
+#include "BenchmarkFramework.h"
+
+namespace
+{
+    IntVector2D const WorldSize{2000, 1000};
+    int const NumPositions = 1000000;
+
+    std::vector<RealVector2D> getRandomPositions()
+    {
+        std::mt19937 generator(0);
+        std::uniform_real_distribution<float> distributionX(0, toFloat(WorldSize.x));
+        std::uniform_real_distribution<float> distributionY(0, toFloat(WorldSize.y));
+        std::vector<RealVector2D> result;
+        result.reserve(NumPositions);
+        for (int i = 0; i < NumPositions; ++i) {
+            result.emplace_back(distributionX(generator), distributionY(generator));
+        }
+        return result;
+    }
+
+    std::vector<FlowCenter> getRandomCenters(int numCenters)
+    {
+        std::mt19937 generator(numCenters);
+        std::uniform_real_distribution<float> distribution(0, 1);
+        std::vector<FlowCenter> result(numCenters);
+        for (auto& center : result) {
+            center.posX = distribution(generator) * toFloat(WorldSize.x);
+            center.posY = distribution(generator) * toFloat(WorldSize.y);
+            center.radius = 100.0f + distribution(generator) * 400.0f;
+            center.orientation = distribution(generator) < 0.5f ? Orientation::Clockwise : Orientation::CounterClockwise;
+        }
+        return result;
+    }
+}
+
+//the grid is built once per change of the settings and sampled for every cell in every time step
+BENCHMARK(FlowField, gridVsAnalyticBy1MPositions)
+{
+    auto positions = getRandomPositions();
+    std::vector<RealVector2D> velocities(NumPositions);
+
+    for (auto numCenters : {1, 2, FlowFieldSettings::MaxCenters, 32}) {
+        auto centers = getRandomCenters(numCenters);
+        auto suffix = " with " + std::to_string(numCenters) + (1 == numCenters ? " center" : " centers");
+
+        Benchmark::measure("analytic" + suffix, [&] {
+            for (int i = 0; i < NumPositions; ++i) {
+                velocities[i] = FlowFieldGrid::calcVelocity(centers, positions[i], WorldSize);
+            }
+            Benchmark::keep(velocities.back().x);
+        });
+
+        FlowFieldGrid grid;
+        Benchmark::measure("grid build" + suffix, [&] {
+            grid = FlowFieldGrid();
+            grid.update(centers, WorldSize);
+        });
+        Benchmark::measure("grid sample" + suffix, [&] {
+            for (int i = 0; i < NumPositions; ++i) {
+                velocities[i] = grid.sampleVelocity(positions[i]);
+            }
+            Benchmark::keep(velocities.back().x);
+        });
+    }
+}
@@ -0,0 +1,13 @@
+#include <iostream>
+
+#include "BenchmarkFramework.h"
+
+int main(int argc, char** argv)
+{
+    if (argc > 2) {
+        std::cerr << "Usage: alien-benchmarks [name filter]" << std::endl;
+        return 1;
+    }
+    auto filter = argc == 2 ? std::string(argv[1]) : std::string();
+    return BenchmarkRegistry::getInstance().runAll(filter) == 0 ? 0 : 1;
+}
@@ -0,0 +1,85 @@
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include <boost/property_tree/json_parser.hpp>
+
+#include "EngineInterface/Parser.h"
+#include "EngineInterface/Settings.h"
+
+#include "BenchmarkFramework.h"
+
+namespace
+{
+    int const NumFiles = 10000;
+
+    std::vector<std::filesystem::path> writeSettingsFiles(std::filesystem::path const& directory)
+    {
+        std::filesystem::create_directories(directory);
+        std::vector<std::filesystem::path> result;
+        result.reserve(NumFiles);
+        for (int i = 0; i < NumFiles; ++i) {
+            Settings settings;
+            settings.generalSettings.worldSizeX = 1000 + i;
+            settings.simulationParameters.radiationProb = toFloat(i) / NumFiles;
+            settings.simulationParametersSpots.numSpots = i % 3;
+            settings.flowFieldSettings.active = i % 2 == 0;
+
+            auto filename = directory / ("simulation" + std::to_string(i) + ".settings.json");
+            std::ofstream stream(filename);
+            boost::property_tree::json_parser::write_json(stream, Parser::encode(i, settings));
+            result.emplace_back(filename);
+        }
+        return result;
+    }
+
+    //former implementation of Serializer::deserializeTimestepAndSettings
+    std::pair<uint64_t, Settings> readByPropertyTree(std::filesystem::path const& filename)
+    {
+        std::ifstream stream(filename);
+        boost::property_tree::ptree tree;
+        boost::property_tree::read_json(stream, tree);
+        return Parser::decodeTimestepAndSettings(tree);
+    }
+
+    std::pair<uint64_t, Settings> readByFlatJsonReader(std::filesystem::path const& filename)
+    {
+        std::ifstream stream(filename);
+        std::string json{std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>()};
+        return Parser::decodeTimestepAndSettings(std::string_view(json));
+    }
+
+    std::string formatPerFile(double milliseconds)
+    {
+        std::stringstream stream;
+        stream << milliseconds * 1000.0 / NumFiles << " us";
+        return stream.str();
+    }
+}
+
+BENCHMARK(SettingsParser, load10kSettingsFiles)
+{
+    auto directory = std::filesystem::temp_directory_path() / "alien-settings-benchmark";
+    auto filenames = writeSettingsFiles(directory);
+
+    auto propertyTreeTime = Benchmark::measure(
+        "property tree",
+        [&] {
+            for (auto const& filename : filenames) {
+                Benchmark::keep(readByPropertyTree(filename).first);
+            }
+        },
+        3);
+    auto flatReaderTime = Benchmark::measure(
+        "flat json reader",
+        [&] {
+            for (auto const& filename : filenames) {
+                Benchmark::keep(readByFlatJsonReader(filename).first);
+            }
+        },
+        3);
+    Benchmark::report("property tree per file", formatPerFile(propertyTreeTime));
+    Benchmark::report("flat json reader per file", formatPerFile(flatReaderTime));
+
+    std::filesystem::remove_all(directory);
+}
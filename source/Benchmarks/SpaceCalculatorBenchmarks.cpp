@@ -0,0 +1,108 @@
+#include <cmath>
+#include <random>
+
+#include "Base/CpuFeatures.h"
+#include "EngineInterface/SpaceCalculator.h"
+
+#include "BenchmarkFramework.h"
+
+namespace
+{
+    IntVector2D const WorldSize{6000, 3000};
+    int const NumPositions = 1000000;
+
+    std::vector<RealVector2D> getRandomPositions(unsigned int seed)
+    {
+        std::mt19937 generator(seed);
+        std::uniform_real_distribution<float> distributionX(-toFloat(WorldSize.x), 2.0f * toFloat(WorldSize.x));
+        std::uniform_real_distribution<float> distributionY(-toFloat(WorldSize.y), 2.0f * toFloat(WorldSize.y));
+        std::vector<RealVector2D> result;
+        result.reserve(NumPositions);
+        for (int i = 0; i < NumPositions; ++i) {
+            result.emplace_back(distributionX(generator), distributionY(generator));
+        }
+        return result;
+    }
+
+    //former implementation of SpaceCalculator::correctPosition
+    void correctPositionByFmod(RealVector2D& pos)
+    {
+        auto sizeX = toFloat(WorldSize.x);
+        auto sizeY = toFloat(WorldSize.y);
+        pos.x = std::fmod(std::fmod(pos.x, sizeX) + sizeX, sizeX);
+        pos.y = std::fmod(std::fmod(pos.y, sizeY) + sizeY, sizeY);
+    }
+
+    std::string getName(SimdLevel level)
+    {
+        switch (level) {
+        case SimdLevel::Avx2:
+            return "AVX2";
+        case SimdLevel::Sse41:
+            return "SSE4.1";
+        default:
+            return "scalar";
+        }
+    }
+}
+
+BENCHMARK(SpaceCalculator, batchFunctionsWith1MPositions)
+{
+    SpaceCalculator spaceCalculator(WorldSize);
+    auto positions1 = getRandomPositions(0);
+    auto positions2 = getRandomPositions(1);
+    std::vector<RealVector2D> displacements(NumPositions);
+    std::vector<float> distances(NumPositions);
+
+    Benchmark::measure("distance per element", [&] {
+        for (int i = 0; i < NumPositions; ++i) {
+            distances[i] = spaceCalculator.distance(positions1.front(), positions2[i]);
+        }
+        Benchmark::keep(distances.back());
+    });
+    Benchmark::measure("correctDisplacement per element", [&] {
+        for (int i = 0; i < NumPositions; ++i) {
+            displacements[i] = positions2[i] - positions1[i];
+            spaceCalculator.correctDisplacement(displacements[i]);
+        }
+        Benchmark::keep(displacements.back().x);
+    });
+    Benchmark::measure("correctPosition per element", [&] {
+        auto positions = positions1;
+        for (auto& position : positions) {
+            spaceCalculator.correctPosition(position);
+        }
+        Benchmark::keep(positions.back().x);
+    });
+    Benchmark::measure("correctPosition by fmod per element", [&] {
+        auto positions = positions1;
+        for (auto& position : positions) {
+            correctPositionByFmod(position);
+        }
+        Benchmark::keep(positions.back().x);
+    });
+
+    CpuFeatures::setSimdLevelLimit(SimdLevel::Avx2);
+    auto maxLevel = CpuFeatures::getSimdLevel();
+    for (auto level : {SimdLevel::Scalar, SimdLevel::Sse41, SimdLevel::Avx2}) {
+        if (level > maxLevel) {
+            break;
+        }
+        CpuFeatures::setSimdLevelLimit(level);
+        auto name = getName(level);
+        Benchmark::measure("distances " + name, [&] {
+            spaceCalculator.distances(positions1.front(), positions2.data(), distances.data(), NumPositions);
+            Benchmark::keep(distances.back());
+        });
+        Benchmark::measure("displacements " + name, [&] {
+            spaceCalculator.displacements(positions1.data(), positions2.data(), displacements.data(), NumPositions);
+            Benchmark::keep(displacements.back().x);
+        });
+        Benchmark::measure("correctPositions " + name, [&] {
+            auto positions = positions1;
+            spaceCalculator.correctPositions(positions.data(), NumPositions);
+            Benchmark::keep(positions.back().x);
+        });
+    }
+    CpuFeatures::setSimdLevelLimit(SimdLevel::Avx2);
+}
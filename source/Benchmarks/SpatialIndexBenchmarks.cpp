@@ -0,0 +1,98 @@
+#include <random>
+
+#include "EngineInterface/Descriptions.h"
+#include "EngineInterface/SpaceCalculator.h"
+#include "EngineInterface/SpatialIndex.h"
+
+#include "BenchmarkFramework.h"
+
+namespace
+{
+    IntVector2D const WorldSize{1000, 1000};
+    int const NumClusters = 100000;
+    int const CellsPerCluster = 10;
+    int const NumQueries = 100000;
+    int const NumFullScanQueries = 10;
+    float const Radius = 3.0f;
+    int const NumNearestEntities = 8;
+
+    DataDescription createData()
+    {
+        std::mt19937 generator(0);
+        std::uniform_real_distribution<float> distribution(0.0f, toFloat(WorldSize.x));
+        DataDescription result;
+        result.reserve(NumClusters, 0);
+        uint64_t id = 1;
+        for (int i = 0; i < NumClusters; ++i) {
+            auto& cluster = result.emplaceCluster();
+            cluster.setId(id++).reserve(CellsPerCluster);
+            RealVector2D clusterPos{distribution(generator), distribution(generator)};
+            for (int j = 0; j < CellsPerCluster; ++j) {
+                cluster.emplaceCell().setId(id++).setPos({clusterPos.x + toFloat(j), clusterPos.y});
+            }
+        }
+        return result;
+    }
+
+    std::vector<RealVector2D> getRandomPositions(int numPositions)
+    {
+        std::mt19937 generator(1);
+        std::uniform_real_distribution<float> distribution(0.0f, toFloat(WorldSize.x));
+        std::vector<RealVector2D> result;
+        result.reserve(numPositions);
+        for (int i = 0; i < numPositions; ++i) {
+            result.emplace_back(distribution(generator), distribution(generator));
+        }
+        return result;
+    }
+}
+
+BENCHMARK(SpatialIndex, queriesWith1MCells)
+{
+    auto data = createData();
+    auto positions = getRandomPositions(NumQueries);
+
+    Benchmark::measure("build", [&] { SpatialIndex index(data, WorldSize); });
+
+    SpatialIndex index(data, WorldSize);
+    Benchmark::measure("100k radius queries", [&] {
+        int numEntities = 0;
+        for (auto const& pos : positions) {
+            numEntities += toInt(index.getEntitiesInRadius(pos, Radius).size());
+        }
+        Benchmark::keep(numEntities);
+    });
+    Benchmark::measure("100k radius queries (batched)", [&] {
+        Benchmark::keep(index.getEntitiesInRadius(positions, Radius).size());
+    });
+    Benchmark::measure("100k 8-nearest queries", [&] {
+        int numEntities = 0;
+        for (auto const& pos : positions) {
+            numEntities += toInt(index.getNearestEntities(pos, NumNearestEntities).size());
+        }
+        Benchmark::keep(numEntities);
+    });
+    Benchmark::measure("100k 8-nearest queries (batched)", [&] {
+        Benchmark::keep(index.getNearestEntities(positions, NumNearestEntities).size());
+    });
+
+    //baseline: scanning the whole description per query
+    SpaceCalculator spaceCalculator(WorldSize);
+    auto fullScanPositions = getRandomPositions(NumFullScanQueries);
+    auto fullScanDuration = Benchmark::measure("10 radius queries (full scan)", [&] {
+        int numEntities = 0;
+        for (auto const& pos : fullScanPositions) {
+            for (auto const& cluster : data.clusters) {
+                for (auto const& cell : cluster.cells) {
+                    if (spaceCalculator.distance(pos, cell.pos) <= Radius) {
+                        ++numEntities;
+                    }
+                }
+            }
+        }
+        Benchmark::keep(numEntities);
+    }, 1);
+    Benchmark::report(
+        "100k radius queries (full scan, extrapolated)",
+        std::to_string(toInt(fullScanDuration * NumQueries / NumFullScanQueries)) + " ms");
+}
@@ -0,0 +1,136 @@
+#include "BatchRunner.h"
+
+#include <chrono>
+#include <regex>
+
+#include "Base/LoggingService.h"
+#include "Base/ServiceLocator.h"
+#include "EngineInterface/ChangeDescriptions.h"
+#include "EngineInterface/Serializer.h"
+#include "EngineImpl/SimulationController.h"
+
+BatchRunner::BatchRunner(SimulationController const& simController, BatchSettings const& settings)
+    : _simController(simController)
+    , _settings(settings)
+{
+    _serializer = boost::make_shared<_Serializer>();
+}
+
+BatchSummary BatchRunner::run()
+{
+    auto loggingService = ServiceLocator::getInstance().getService<LoggingService>();
+
+    loadSimulation();
+    writeStatisticsHeader();
+
+    BatchSummary result;
+    result.startTimestep = _simController->getCurrentTimestep();
+    _lastStatisticsTimestep = result.startTimestep;
+
+    auto startTime = std::chrono::steady_clock::now();
+    auto getDuration = [&startTime] {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    };
+
+    uint64_t timesteps = 0;
+    while (!isFinished(timesteps, getDuration())) {
+        _simController->calcSingleTimestep();
+        ++timesteps;
+
+        if (_statisticsFile.is_open() && timesteps % _settings.statisticsInterval == 0) {
+            writeStatistics(getDuration());
+        }
+        if (_settings.snapshotInterval > 0 && timesteps % _settings.snapshotInterval == 0) {
+            auto filename = getSnapshotFilename(_simController->getCurrentTimestep());
+            writeSnapshot(filename);
+            loggingService->logMessage(Priority::Unimportant, "snapshot written to " + filename);
+            ++result.numSnapshots;
+        }
+    }
+    result.duration = getDuration();
+    result.endTimestep = _simController->getCurrentTimestep();
+
+    if (_statisticsFile.is_open() && timesteps % _settings.statisticsInterval != 0) {
+        writeStatistics(result.duration);
+    }
+    if (!_settings.outputFilename.empty()) {
+        writeSnapshot(_settings.outputFilename);
+        ++result.numSnapshots;
+    }
+    return result;
+}
+
+void BatchRunner::loadSimulation()
+{
+    DeserializedColumnarSimulation deserializedData;
+    if (!_serializer->deserializeSimulationFromFile(_settings.inputFilename, deserializedData)) {
+        throw std::runtime_error("The file " + _settings.inputFilename + " could not be loaded.");
+    }
+    _simController->newSimulation(deserializedData.timestep, deserializedData.settings, deserializedData.symbolMap);
+    _simController->addColumnarSimulationData(deserializedData.content);
+}
+
+bool BatchRunner::isFinished(uint64_t timesteps, double duration) const
+{
+    if (_settings.timesteps && timesteps >= *_settings.timesteps) {
+        return true;
+    }
+    if (_settings.maxDuration && duration >= *_settings.maxDuration) {
+        return true;
+    }
+    return false;
+}
+
+void BatchRunner::writeStatisticsHeader()
+{
+    if (_settings.statisticsFilename.empty()) {
+        return;
+    }
+    _statisticsFile.open(_settings.statisticsFilename, std::ios::trunc);
+    if (!_statisticsFile) {
+        throw std::runtime_error("The file " + _settings.statisticsFilename + " could not be opened.");
+    }
+    _statisticsFile << "time step,cells,particles,tokens,internal energy,created cells,successful attacks,"
+                       "failed attacks,muscle activities,tps"
+                    << std::endl;
+}
+
+void BatchRunner::writeStatistics(double duration)
+{
+    _simController->updateStatistics();
+    auto statistics = _simController->getStatistics();
+
+    auto tps = duration > _lastStatisticsDuration
+        ? toFloat(statistics.timeStep - _lastStatisticsTimestep) / (duration - _lastStatisticsDuration)
+        : 0.0;
+    _lastStatisticsTimestep = statistics.timeStep;
+    _lastStatisticsDuration = duration;
+
+    _statisticsFile << statistics.timeStep << "," << statistics.numCells << "," << statistics.numParticles << ","
+                    << statistics.numTokens << "," << statistics.totalInternalEnergy << ","
+                    << statistics.numCreatedCells << "," << statistics.numSuccessfulAttacks << ","
+                    << statistics.numFailedAttacks << "," << statistics.numMuscleActivities << "," << tps
+                    << std::endl;
+}
+
+void BatchRunner::writeSnapshot(std::string const& filename)
+{
+    DeserializedColumnarSimulation sim;
+    sim.timestep = _simController->getCurrentTimestep();
+    sim.settings = _simController->getSettings();
+    sim.symbolMap = _simController->getSymbolMap();
+    sim.content = _simController->getColumnarSimulationData({0, 0}, _simController->getWorldSize());
+    if (!_serializer->serializeSimulationToFile(filename, sim)) {
+        throw std::runtime_error("The file " + filename + " could not be written.");
+    }
+}
+
+std::string BatchRunner::getSnapshotFilename(uint64_t timestep) const
+{
+    std::regex fileEndingExpr("\\.\\w+$");
+    auto timestepEnding = "." + std::to_string(timestep) + ".sim";
+    if (!std::regex_search(_settings.outputFilename, fileEndingExpr)) {
+        return _settings.outputFilename + timestepEnding;
+    }
+    return std::regex_replace(_settings.outputFilename, fileEndingExpr, timestepEnding);
+}
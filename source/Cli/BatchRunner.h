@@ -0,0 +1,37 @@
+#pragma once
+
+#include <fstream>
+
+#include "EngineInterface/Definitions.h"
+#include "EngineImpl/Definitions.h"
+
+#include "BatchSettings.h"
+
+/**
+ * Runs a simulation without any window, render loop or OpenGL interop.
+ * Time steps are calculated directly on the calling thread while the engine worker is paused.
+ */
+class BatchRunner
+{
+public:
+    BatchRunner(SimulationController const& simController, BatchSettings const& settings);
+
+    BatchSummary run();
+
+private:
+    void loadSimulation();
+    bool isFinished(uint64_t timesteps, double duration) const;
+
+    void writeStatisticsHeader();
+    void writeStatistics(double duration);
+    void writeSnapshot(std::string const& filename);
+    std::string getSnapshotFilename(uint64_t timestep) const;
+
+    SimulationController _simController;
+    Serializer _serializer;
+    BatchSettings _settings;
+
+    std::ofstream _statisticsFile;
+    uint64_t _lastStatisticsTimestep = 0;
+    double _lastStatisticsDuration = 0;
+};
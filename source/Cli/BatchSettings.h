@@ -0,0 +1,29 @@
+#pragma once
+
+#include "Base/Definitions.h"
+
+struct BatchSettings
+{
+    std::string inputFilename;
+    std::string outputFilename;  //empty = no final snapshot
+    std::string statisticsFilename;  //empty = no statistics file
+    std::string traceFilename;  //empty = no trace file, requires a build with ALIEN_TRACING
+
+    boost::optional<uint64_t> timesteps;
+    boost::optional<double> maxDuration;  //in seconds
+
+    uint64_t snapshotInterval = 0;  //0 = no periodic snapshots
+    uint64_t statisticsInterval = 100;
+    boost::optional<uint64_t> seed;  //none = random seed
+
+    bool quiet = false;
+    bool sequentialHostStages = false;  //baseline for time step measurements
+};
+
+struct BatchSummary
+{
+    uint64_t startTimestep = 0;
+    uint64_t endTimestep = 0;
+    double duration = 0;  //in seconds
+    int numSnapshots = 0;
+};
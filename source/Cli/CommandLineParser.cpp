@@ -0,0 +1,97 @@
+#include "CommandLineParser.h"
+
+#include <sstream>
+#include <type_traits>
+
+namespace
+{
+    template <typename T>
+    T parseNumber(std::string const& option, std::string const& value)
+    {
+        if (std::is_unsigned<T>::value && value.find('-') != std::string::npos) {
+            throw ParseErrorException("Invalid value '" + value + "' for option " + option + ".");
+        }
+        std::istringstream stream(value);
+        T result;
+        stream >> result;
+        if (stream.fail() || !stream.eof()) {
+            throw ParseErrorException("Invalid value '" + value + "' for option " + option + ".");
+        }
+        return result;
+    }
+}
+
+BatchSettings CommandLineParser::parse(int argc, char** argv)
+{
+    BatchSettings result;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string option = argv[i];
+        if (option == "-q" || option == "--quiet") {
+            result.quiet = true;
+            continue;
+        }
+        if (option == "--sequential-host-stages") {
+            result.sequentialHostStages = true;
+            continue;
+        }
+        if (i + 1 >= argc) {
+            throw ParseErrorException("Missing value for option " + option + ".");
+        }
+        std::string value = argv[++i];
+
+        if (option == "-i" || option == "--input") {
+            result.inputFilename = value;
+        } else if (option == "-o" || option == "--output") {
+            result.outputFilename = value;
+        } else if (option == "-t" || option == "--timesteps") {
+            result.timesteps = parseNumber<uint64_t>(option, value);
+        } else if (option == "-d" || option == "--duration") {
+            result.maxDuration = parseNumber<double>(option, value);
+        } else if (option == "--snapshot-interval") {
+            result.snapshotInterval = parseNumber<uint64_t>(option, value);
+        } else if (option == "--statistics") {
+            result.statisticsFilename = value;
+        } else if (option == "--statistics-interval") {
+            result.statisticsInterval = parseNumber<uint64_t>(option, value);
+            if (result.statisticsInterval == 0) {
+                throw ParseErrorException("The statistics interval has to be positive.");
+            }
+        } else if (option == "--seed") {
+            result.seed = parseNumber<uint64_t>(option, value);
+        } else if (option == "--trace") {
+            result.traceFilename = value;
+        } else {
+            throw ParseErrorException("Unknown option " + option + ".");
+        }
+    }
+
+    if (result.inputFilename.empty()) {
+        throw ParseErrorException("No input file specified.");
+    }
+    if (!result.timesteps && !result.maxDuration) {
+        throw ParseErrorException("Either --timesteps or --duration has to be specified.");
+    }
+    if (result.snapshotInterval > 0 && result.outputFilename.empty()) {
+        throw ParseErrorException("Periodic snapshots require an output file.");
+    }
+    return result;
+}
+
+std::string CommandLineParser::getUsage()
+{
+    return "Usage: alien-cli -i <input.sim> [options]\n"
+           "\n"
+           "Options:\n"
+           "  -i, --input <file>               simulation file to load\n"
+           "  -o, --output <file>              simulation file to write at the end\n"
+           "  -t, --timesteps <n>              number of time steps to calculate\n"
+           "  -d, --duration <seconds>         wall-clock budget\n"
+           "  --snapshot-interval <n>          write <output>.<time step>.sim every n time steps\n"
+           "  --statistics <file>              write statistics as CSV\n"
+           "  --statistics-interval <n>        time steps between statistics rows (default: 100)\n"
+           "  --seed <n>                       seed for the random numbers of host and GPU\n"
+           "  --trace <file>                   write host-side trace spans in Chrome trace format\n"
+           "  --sequential-host-stages         run data conversions and statistics readback in the worker thread\n"
+           "  -q, --quiet                      only log important messages\n";
+}
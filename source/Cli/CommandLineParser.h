@@ -0,0 +1,10 @@
+#pragma once
+
+#include "BatchSettings.h"
+
+class CommandLineParser
+{
+public:
+    static BatchSettings parse(int argc, char** argv);  //throws ParseErrorException
+    static std::string getUsage();
+};
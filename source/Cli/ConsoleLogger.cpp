@@ -0,0 +1,26 @@
+#include "ConsoleLogger.h"
+
+#include <iostream>
+
+#include "Base/ServiceLocator.h"
+
+ConsoleLogger::ConsoleLogger(Priority minPriority)
+    : _minPriority(minPriority)
+{
+    auto loggingService = ServiceLocator::getInstance().getService<LoggingService>();
+    loggingService->registerCallBack(this);
+}
+
+ConsoleLogger::~ConsoleLogger()
+{
+    auto loggingService = ServiceLocator::getInstance().getService<LoggingService>();
+    loggingService->unregisterCallBack(this);
+}
+
+void ConsoleLogger::newLogMessage(Priority priority, std::string const& message)
+{
+    if (priority < _minPriority) {
+        return;
+    }
+    std::cout << message << std::endl;
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "Base/LoggingService.h"
+
+class ConsoleLogger : public LoggingCallBack
+{
+public:
+    ConsoleLogger(Priority minPriority);
+    virtual ~ConsoleLogger();
+
+    void newLogMessage(Priority priority, std::string const& message) override;
+
+private:
+    Priority _minPriority;
+};
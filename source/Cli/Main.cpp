@@ -0,0 +1,63 @@
+#include <iostream>
+
+#include "Base/BaseServices.h"
+#include "Base/LoggingService.h"
+#include "Base/NumberGenerator.h"
+#include "Base/ServiceLocator.h"
+#include "Base/StringFormatter.h"
+#include "Base/Tracing.h"
+#include "EngineImpl/SimulationController.h"
+
+#include "BatchRunner.h"
+#include "CommandLineParser.h"
+#include "ConsoleLogger.h"
+
+int main(int argc, char** argv)
+{
+    BaseServices baseServices;
+
+    BatchSettings settings;
+    try {
+        settings = CommandLineParser::parse(argc, argv);
+    } catch (ParseErrorException const& e) {
+        std::cerr << e.what() << std::endl << std::endl << CommandLineParser::getUsage();
+        return 1;
+    }
+    ConsoleLogger logger(settings.quiet ? Priority::Important : Priority::Unimportant);
+    TracingService::getInstance().setThreadName("Main");
+
+    if (settings.seed) {
+        NumberGenerator::getInstance().setSeed(*settings.seed);
+    }
+
+    auto simController = boost::make_shared<_SimulationController>();
+    try {
+        simController->initCuda();
+        simController->setHostStagePipelining(!settings.sequentialHostStages);
+
+        BatchRunner runner(simController, settings);
+        auto summary = runner.run();
+        simController->closeSimulation();
+
+        if (!settings.traceFilename.empty()) {
+            if (!TracingService::isCompiledIn()) {
+                std::cerr << "Tracing is not available since this build has been configured without ALIEN_TRACING."
+                          << std::endl;
+            }
+            TracingService::getInstance().writeChromeTrace(settings.traceFilename);
+        }
+
+        auto timesteps = summary.endTimestep - summary.startTimestep;
+        auto tps = summary.duration > 0 ? toFloat(timesteps) / toFloat(summary.duration) : 0.0f;
+        std::cout << "time steps: " << StringFormatter::format(summary.startTimestep) << " -> "
+                  << StringFormatter::format(summary.endTimestep) << std::endl
+                  << "duration: " << StringFormatter::format(toFloat(summary.duration), 2) << " s" << std::endl
+                  << "time steps per second: " << StringFormatter::format(tps, 1) << std::endl
+                  << "snapshots written: " << summary.numSnapshots << std::endl;
+    } catch (std::exception const& e) {
+        auto loggingService = ServiceLocator::getInstance().getService<LoggingService>();
+        loggingService->logMessage(Priority::Important, std::string("The following exception occurred: ") + e.what());
+        return 1;
+    }
+    return 0;
+}
@@ -6,6 +6,7 @@
 #include <device_launch_parameters.h>
 #include <cuda/helper_cuda.h>
 
+#include "Base/NumberGenerator.h"
 #include "EngineInterface/GpuSettings.h"
 
 #include "Array.cuh"
@@ -59,10 +60,10 @@ public:
         unsigned long long int hostCurrentId = 1;
         CHECK_FOR_CUDA_ERROR(cudaMemcpy(_currentId, &hostCurrentId, sizeof(_currentId), cudaMemcpyHostToDevice));
 
-        std::vector<int> randomNumbers(size);
-        for (int i = 0; i < size; ++i) {
-            randomNumbers[i] = rand();
-        }
+        //numbers in [0, RAND_MAX] as expected by the random functions below
+        std::vector<uint32_t> randomNumbers(size);
+        NumberGenerator::getInstance().fillRandomInts(
+            randomNumbers.data(), size, static_cast<uint32_t>(RAND_MAX) + 1);
         CHECK_FOR_CUDA_ERROR(cudaMemcpy(_array, randomNumbers.data(), sizeof(int) * size, cudaMemcpyHostToDevice));
     }
 
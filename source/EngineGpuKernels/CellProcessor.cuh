@@ -132,7 +132,7 @@ __inline__ __device__ void CellProcessor::collisions(SimulationData& data)
 
                 if (cell->numConnections < cell->maxConnections && otherCell->numConnections < otherCell->maxConnections
                     && Math::length(velDelta)
-                        >= SpotCalculator::calc(&SimulationParametersSpotValues::cellFusionVelocity, data, cell->absPos)
+                        >= SpotCalculator::calc(&SimulationParametersSpotValues::cellFusionVelocity, cell->absPos)
                     && isApproaching && cell->energy <= cudaSimulationParameters.spotValues.cellMaxBindingEnergy
                     && otherCell->energy <= cudaSimulationParameters.spotValues.cellMaxBindingEnergy) {
                     CellConnectionProcessor::scheduleAddConnections(data, cell, otherCell, true);
@@ -179,7 +179,7 @@ __inline__ __device__ void CellProcessor::applyAndCheckForces(SimulationData& da
 
         auto force = cell->temp1;
         if (Math::length(force)
-            > SpotCalculator::calc(&SimulationParametersSpotValues::cellMaxForce, data, cell->absPos)) {
+            > SpotCalculator::calc(&SimulationParametersSpotValues::cellMaxForce, cell->absPos)) {
             if(data.numberGen.random() < cudaSimulationParameters.cellMaxForceDecayProb) {
                 CellConnectionProcessor::scheduleDelCellAndConnections(data, cell, index);
             }
@@ -207,8 +207,7 @@ __inline__ __device__ void CellProcessor::calcForces(SimulationData& data)
         float2 force{0, 0};
         float2 prevDisplacement = cell->connections[cell->numConnections - 1].cell->absPos - cell->absPos;
         data.cellMap.mapDisplacementCorrection(prevDisplacement);
-        auto cellBindingForce = SpotCalculator::calc(
-            &SimulationParametersSpotValues::cellBindingForce, data, cell->absPos);
+        auto cellBindingForce = SpotCalculator::calc(&SimulationParametersSpotValues::cellBindingForce, cell->absPos);
         for (int i = 0; i < cell->numConnections; ++i) {
             auto connectingCell = cell->connections[i].cell;
 
@@ -334,7 +333,7 @@ __inline__ __device__ void CellProcessor::applyAveragedVelocities(SimulationData
     for (int index = partition.startIndex; index <= partition.endIndex; ++index) {
         auto& cell = cells.at(index);
 
-        auto friction = SpotCalculator::calc(&SimulationParametersSpotValues::friction, data, cell->absPos);
+        auto friction = SpotCalculator::calc(&SimulationParametersSpotValues::friction, cell->absPos);
         cell->vel = cell->temp1 * (1.0f - friction);
     }
 }
@@ -349,7 +348,7 @@ __inline__ __device__ void CellProcessor::radiation(SimulationData& data)
         auto& cell = cells.at(index);
         if (data.numberGen.random() < cudaSimulationParameters.radiationProb) {
             auto radiationFactor =
-                SpotCalculator::calc(&SimulationParametersSpotValues::radiationFactor, data, cell->absPos);
+                SpotCalculator::calc(&SimulationParametersSpotValues::radiationFactor, cell->absPos);
             if (radiationFactor > 0) {
 
                 auto& pos = cell->absPos;
@@ -397,9 +396,9 @@ __inline__ __device__ void CellProcessor::decay(SimulationData& data)
             }
         }
 
-        auto cellMinEnergy = SpotCalculator::calc(&SimulationParametersSpotValues::cellMinEnergy, data, cell->absPos);
+        auto cellMinEnergy = SpotCalculator::calc(&SimulationParametersSpotValues::cellMinEnergy, cell->absPos);
         auto cellMaxBindingEnergy =
-            SpotCalculator::calc(&SimulationParametersSpotValues::cellMaxBindingEnergy, data, cell->absPos);
+            SpotCalculator::calc(&SimulationParametersSpotValues::cellMaxBindingEnergy, cell->absPos);
         if (cell->energy < cellMinEnergy || destroyDueToTokenUsage) {
             CellConnectionProcessor::scheduleDelCellAndConnections(data, cell, index);
         } else if (cell->energy > cellMaxBindingEnergy) {
@@ -5,8 +5,12 @@
 #include "EngineInterface/SimulationParametersSpots.h"
 #include "EngineInterface/GpuSettings.h"
 
+#include "PeriodicGridData.cuh"
+
 __constant__ __device__ GpuSettings gpuConstants;
 __constant__ __device__ SimulationParameters cudaSimulationParameters;
 __constant__ __device__ SimulationParametersSpots cudaSimulationParametersSpots;
 __constant__ __device__ FlowFieldSettings cudaFlowFieldSettings;
 __constant__ __device__ int cudaImageBlurFactors[7];
+__constant__ __device__ PeriodicGridData cudaSpotFactorGrid;  //one channel per spot, see SpotFactorGrid
+__constant__ __device__ PeriodicGridData cudaFlowFieldGrid;  //velocities, see FlowFieldGrid
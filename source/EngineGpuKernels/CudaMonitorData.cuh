@@ -6,74 +6,90 @@
 #include "Definitions.cuh"
 #include "Entities.cuh"
 
+/**
+ * The monitor data of a time step is gathered in device memory and then copied asynchronously to pinned host memory
+ * on a separate stream. In this way the host can wait for the transfer while the next time step is calculated.
+ */
 class CudaMonitorData
 {
 public:
-    __host__ void init()
+    struct MonitorData
     {
-        CudaMemoryManager::getInstance().acquireMemory<int>(1, _numCells);
-        CudaMemoryManager::getInstance().acquireMemory<int>(1, _numTokens);
-        CudaMemoryManager::getInstance().acquireMemory<int>(1, _numParticles);
-        CudaMemoryManager::getInstance().acquireMemory<double>(1, _internalEnergy);
-
-        CHECK_FOR_CUDA_ERROR(cudaMemset(_numCells, 0, sizeof(int)));
-        CHECK_FOR_CUDA_ERROR(cudaMemset(_numTokens, 0, sizeof(int)));
-        CHECK_FOR_CUDA_ERROR(cudaMemset(_numParticles, 0, sizeof(int)));
+        uint64_t timeStep = 0;
+        int numCells = 0;
+        int numParticles = 0;
+        int numTokens = 0;
+        double totalInternalEnergy = 0.0;
+        int numCreatedCells = 0;
+        int numSuccessfulAttacks = 0;
+        int numFailedAttacks = 0;
+        int numMuscleActivities = 0;
+    };
 
-        double zero = 0.0;
-        CHECK_FOR_CUDA_ERROR(cudaMemcpy(_internalEnergy, &zero, sizeof(double), cudaMemcpyHostToDevice));
+    __host__ void init()
+    {
+        CudaMemoryManager::getInstance().acquireMemory<MonitorData>(1, _data);
+        CHECK_FOR_CUDA_ERROR(cudaMallocHost(&_hostData, sizeof(MonitorData)));
+        *_hostData = MonitorData();
+        CHECK_FOR_CUDA_ERROR(cudaMemcpy(_data, _hostData, sizeof(MonitorData), cudaMemcpyHostToDevice));
 
+        CHECK_FOR_CUDA_ERROR(cudaStreamCreateWithFlags(&_stream, cudaStreamNonBlocking));
+        CHECK_FOR_CUDA_ERROR(cudaEventCreateWithFlags(&_copiedToHost, cudaEventDisableTiming));
+        CHECK_FOR_CUDA_ERROR(cudaEventRecord(_copiedToHost, _stream));
     }
 
     __host__ void free()
     {
-        CudaMemoryManager::getInstance().freeMemory(_numCells);
-        CudaMemoryManager::getInstance().freeMemory(_numTokens);
-        CudaMemoryManager::getInstance().freeMemory(_numParticles);
-        CudaMemoryManager::getInstance().freeMemory(_internalEnergy);
+        CHECK_FOR_CUDA_ERROR(cudaEventSynchronize(_copiedToHost));
+        CHECK_FOR_CUDA_ERROR(cudaEventDestroy(_copiedToHost));
+        CHECK_FOR_CUDA_ERROR(cudaStreamDestroy(_stream));
+        CHECK_FOR_CUDA_ERROR(cudaFreeHost(_hostData));
+        CudaMemoryManager::getInstance().freeMemory(_data);
     }
 
-    struct MonitorData
+    //the previous copy has to be finished, see waitForCopyToHost()
+    __host__ void beginCopyToHost()
     {
-        uint64_t timeStep = 0;
-        int numCells = 0;
-        int numParticles = 0;
-        int numTokens = 0;
-        double totalInternalEnergy = 0.0;
-    };
-    __host__ MonitorData getMonitorData(uint64_t timeStep)
+        CHECK_FOR_CUDA_ERROR(
+            cudaMemcpyAsync(_hostData, _data, sizeof(MonitorData), cudaMemcpyDeviceToHost, _stream));
+        CHECK_FOR_CUDA_ERROR(cudaEventRecord(_copiedToHost, _stream));
+    }
+
+    __host__ void waitForCopyToHost() { CHECK_FOR_CUDA_ERROR(cudaEventSynchronize(_copiedToHost)); }
+
+    __host__ MonitorData getMonitorData()
     {
-        MonitorData result;
-        CHECK_FOR_CUDA_ERROR(cudaMemcpy(&result.numCells, _numCells, sizeof(int), cudaMemcpyDeviceToHost));
-        CHECK_FOR_CUDA_ERROR(cudaMemcpy(&result.numParticles, _numParticles, sizeof(int), cudaMemcpyDeviceToHost));
-        CHECK_FOR_CUDA_ERROR(cudaMemcpy(&result.numTokens, _numTokens, sizeof(int), cudaMemcpyDeviceToHost));
-        CHECK_FOR_CUDA_ERROR(cudaMemcpy(&result.totalInternalEnergy, _internalEnergy, sizeof(double), cudaMemcpyDeviceToHost));
-        result.timeStep = timeStep;
-        return result;
+        waitForCopyToHost();
+        return *_hostData;
     }
 
-    __inline__ __device__ void reset()
+    __inline__ __device__ void reset(uint64_t timeStep)
     {
-        *_numCells = 0;
-        *_numTokens = 0;
-        *_numParticles = 0;
-        *_internalEnergy = 0.0f;
+        *_data = MonitorData();
+        _data->timeStep = timeStep;
     }
 
-    __inline__ __device__ void setNumCells(int value) { *_numCells = value; }
-    __inline__ __device__ void setNumParticles(int value) { *_numParticles = value; }
-    __inline__ __device__ void setNumTokens(int value) { *_numTokens = value; }
+    __inline__ __device__ void setNumCells(int value) { _data->numCells = value; }
+    __inline__ __device__ void setNumParticles(int value) { _data->numParticles = value; }
+    __inline__ __device__ void setNumTokens(int value) { _data->numTokens = value; }
 
+    __inline__ __device__ void
+    setProcessStatistics(int createdCells, int successfulAttacks, int failedAttacks, int muscleActivities)
+    {
+        _data->numCreatedCells = createdCells;
+        _data->numSuccessfulAttacks = successfulAttacks;
+        _data->numFailedAttacks = failedAttacks;
+        _data->numMuscleActivities = muscleActivities;
+    }
 
     __inline__ __device__ void incInternalEnergy(float changeValue)
     {
-        atomicAdd(_internalEnergy, static_cast<double>(changeValue));
+        atomicAdd(&_data->totalInternalEnergy, static_cast<double>(changeValue));
     }
 
 private:
-    int* _numCells;
-    int* _numTokens;
-    int* _numParticles;
-    double* _internalEnergy;
+    MonitorData* _data;
+    MonitorData* _hostData;  //pinned memory
+    cudaStream_t _stream;
+    cudaEvent_t _copiedToHost;
 };
-
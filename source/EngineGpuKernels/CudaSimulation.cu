@@ -36,6 +36,19 @@
 
 namespace
 {
+    template <typename Symbol, typename T>
+    void uploadRanges(Symbol const& symbol, T const& value, std::vector<ByteRange> const& ranges)
+    {
+        for (auto const& range : ranges) {
+            CHECK_FOR_CUDA_ERROR(cudaMemcpyToSymbol(
+                symbol,
+                reinterpret_cast<char const*>(&value) + range.offset,
+                range.size,
+                range.offset,
+                cudaMemcpyHostToDevice));
+        }
+    }
+
     class CudaInitializer
     {
     public:
@@ -112,7 +125,11 @@ void _CudaSimulation::initCuda()
 _CudaSimulation::_CudaSimulation(uint64_t timestep, Settings const& settings, GpuSettings const& gpuSettings)
 {
     CHECK_FOR_CUDA_ERROR(cudaGetLastError());
+    CHECK_FOR_CUDA_ERROR(cudaGetDevice(&_deviceNumber));
 
+    _worldSize = {settings.generalSettings.worldSizeX, settings.generalSettings.worldSizeY};
+    _cudaSpotFactorGrid = new PeriodicGridData();
+    _cudaFlowFieldGrid = new PeriodicGridData();
     setSimulationParameters(settings.simulationParameters);
     setSimulationParametersSpots(settings.simulationParametersSpots);
     setGpuConstants(gpuSettings);
@@ -153,6 +170,8 @@ _CudaSimulation::~_CudaSimulation()
     _cudaMonitorData->free();
     _cudaSimulationResult->free();
     _cudaSelectionResult->free();
+    _cudaSpotFactorGrid->free();
+    _cudaFlowFieldGrid->free();
 
     CudaMemoryManager::getInstance().freeMemory(_cudaAccessTO->cells);
     CudaMemoryManager::getInstance().freeMemory(_cudaAccessTO->particles);
@@ -170,6 +189,8 @@ _CudaSimulation::~_CudaSimulation()
     delete _cudaSimulationData;
     delete _cudaRenderingData;
     delete _cudaMonitorData;
+    delete _cudaSpotFactorGrid;
+    delete _cudaFlowFieldGrid;
 }
 
 void* _CudaSimulation::registerImageResource(GLuint image)
@@ -345,27 +366,44 @@ auto _CudaSimulation::getArraySizes() const -> ArraySizes
         _cudaSimulationData->entities.tokens.getSize_host()};
 }
 
-OverallStatistics _CudaSimulation::getMonitorData()
+void _CudaSimulation::requestMonitorData()
 {
-    KERNEL_CALL_HOST(cudaGetCudaMonitorData, *_cudaSimulationData, *_cudaMonitorData);
-    
-    OverallStatistics result;
+    std::lock_guard<std::mutex> lock(_mutexForMonitorData);
 
-    auto monitorData = _cudaMonitorData->getMonitorData(getCurrentTimestep());
+    //device data must not be overwritten during a pending transfer
+    _cudaMonitorData->waitForCopyToHost();
+    KERNEL_CALL_HOST(
+        cudaGetCudaMonitorData, *_cudaSimulationData, *_cudaSimulationResult, *_cudaMonitorData, getCurrentTimestep());
+    _cudaMonitorData->beginCopyToHost();
+}
+
+OverallStatistics _CudaSimulation::fetchMonitorData()
+{
+    std::lock_guard<std::mutex> lock(_mutexForMonitorData);
+
+    //the calling thread may not have selected the device yet
+    CHECK_FOR_CUDA_ERROR(cudaSetDevice(_deviceNumber));
+    auto monitorData = _cudaMonitorData->getMonitorData();
+
+    OverallStatistics result;
     result.timeStep = monitorData.timeStep;
     result.numCells = monitorData.numCells;
     result.numParticles = monitorData.numParticles;
     result.numTokens = monitorData.numTokens;
     result.totalInternalEnergy = monitorData.totalInternalEnergy;
-
-    auto processStatistics = _cudaSimulationResult->getStatistics();
-    result.numCreatedCells = processStatistics.createdCells;
-    result.numSuccessfulAttacks = processStatistics.sucessfulAttacks;
-    result.numFailedAttacks = processStatistics.failedAttacks;
-    result.numMuscleActivities = processStatistics.muscleActivities;
+    result.numCreatedCells = monitorData.numCreatedCells;
+    result.numSuccessfulAttacks = monitorData.numSuccessfulAttacks;
+    result.numFailedAttacks = monitorData.numFailedAttacks;
+    result.numMuscleActivities = monitorData.numMuscleActivities;
     return result;
 }
 
+OverallStatistics _CudaSimulation::getMonitorData()
+{
+    requestMonitorData();
+    return fetchMonitorData();
+}
+
 uint64_t _CudaSimulation::getCurrentTimestep() const
 {
     return _currentTimestep.load();
@@ -386,12 +424,35 @@ void _CudaSimulation::setSimulationParametersSpots(SimulationParametersSpots con
 {
     CHECK_FOR_CUDA_ERROR(cudaMemcpyToSymbol(
         cudaSimulationParametersSpots, &spots, sizeof(SimulationParametersSpots), 0, cudaMemcpyHostToDevice));
+    updateSpotFactorGrid(spots);
 }
 
 void _CudaSimulation::setFlowFieldSettings(FlowFieldSettings const& settings)
 {
     CHECK_FOR_CUDA_ERROR(
         cudaMemcpyToSymbol(cudaFlowFieldSettings, &settings, sizeof(FlowFieldSettings), 0, cudaMemcpyHostToDevice));
+    updateFlowFieldGrid(settings);
+}
+
+void _CudaSimulation::setSimulationParameters(
+    SimulationParameters const& parameters,
+    std::vector<ByteRange> const& ranges)
+{
+    uploadRanges(cudaSimulationParameters, parameters, ranges);
+}
+
+void _CudaSimulation::setSimulationParametersSpots(
+    SimulationParametersSpots const& spots,
+    std::vector<ByteRange> const& ranges)
+{
+    uploadRanges(cudaSimulationParametersSpots, spots, ranges);
+    updateSpotFactorGrid(spots);
+}
+
+void _CudaSimulation::setFlowFieldSettings(FlowFieldSettings const& settings, std::vector<ByteRange> const& ranges)
+{
+    uploadRanges(cudaFlowFieldSettings, settings, ranges);
+    updateFlowFieldGrid(settings);
 }
 
 
@@ -452,3 +513,24 @@ void _CudaSimulation::resizeArrays(ArraySizes const& additionals)
         auto const memorySizeAfter = CudaMemoryManager::getInstance().getSizeOfAcquiredMemory();
     loggingService->logMessage(Priority::Important, std::to_string(memorySizeAfter / (1024 * 1024)) + " MB GPU memory acquired");
 }
+
+void _CudaSimulation::updateSpotFactorGrid(SimulationParametersSpots const& spots)
+{
+    if (!_spotFactorGrid.update(spots, _worldSize)) {
+        return;
+    }
+    _cudaSpotFactorGrid->upload(_spotFactorGrid.getGrid());
+    CHECK_FOR_CUDA_ERROR(cudaMemcpyToSymbol(
+        cudaSpotFactorGrid, _cudaSpotFactorGrid, sizeof(PeriodicGridData), 0, cudaMemcpyHostToDevice));
+}
+
+//the grid is built when the flow field is activated for the first time
+void _CudaSimulation::updateFlowFieldGrid(FlowFieldSettings const& settings)
+{
+    if (!settings.active || !_flowFieldGrid.update(FlowFieldGrid::getCenters(settings), _worldSize)) {
+        return;
+    }
+    _cudaFlowFieldGrid->upload(_flowFieldGrid.getGrid());
+    CHECK_FOR_CUDA_ERROR(cudaMemcpyToSymbol(
+        cudaFlowFieldGrid, _cudaFlowFieldGrid, sizeof(PeriodicGridData), 0, cudaMemcpyHostToDevice));
+}
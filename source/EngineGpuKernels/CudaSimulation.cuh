@@ -2,6 +2,8 @@
 
 #include <cstdint>
 #include <atomic>
+#include <mutex>
+#include <vector>
 
 #if defined(_WIN32)
 #define NOMINMAX
@@ -11,8 +13,10 @@
 
 #include "EngineInterface/OverallStatistics.h"
 #include "EngineInterface/Settings.h"
+#include "EngineInterface/FlowFieldGrid.h"
 #include "EngineInterface/SelectionShallowData.h"
 #include "EngineInterface/ShallowUpdateSelectionData.h"
+#include "EngineInterface/SpotFactorGrid.h"
 
 #include "Definitions.cuh"
 #include "DllExport.h"
@@ -54,6 +58,14 @@ public:
     ENGINEGPUKERNELS_EXPORT void setSimulationParametersSpots(SimulationParametersSpots const& spots);
     ENGINEGPUKERNELS_EXPORT void setFlowFieldSettings(FlowFieldSettings const& settings);
 
+    //upload only the given memory ranges of the settings
+    ENGINEGPUKERNELS_EXPORT void
+    setSimulationParameters(SimulationParameters const& parameters, std::vector<ByteRange> const& ranges);
+    ENGINEGPUKERNELS_EXPORT void
+    setSimulationParametersSpots(SimulationParametersSpots const& spots, std::vector<ByteRange> const& ranges);
+    ENGINEGPUKERNELS_EXPORT void
+    setFlowFieldSettings(FlowFieldSettings const& settings, std::vector<ByteRange> const& ranges);
+
     struct ArraySizes
     {
         int cellArraySize;
@@ -62,6 +74,10 @@ public:
     };
     ENGINEGPUKERNELS_EXPORT ArraySizes getArraySizes() const;
 
+    //monitor data is gathered by requestMonitorData() and can be fetched from another thread while the next time step
+    //is calculated, fetchMonitorData() returns the data of the last request and waits for its transfer if necessary
+    ENGINEGPUKERNELS_EXPORT void requestMonitorData();
+    ENGINEGPUKERNELS_EXPORT OverallStatistics fetchMonitorData();
     ENGINEGPUKERNELS_EXPORT OverallStatistics getMonitorData();
     ENGINEGPUKERNELS_EXPORT uint64_t getCurrentTimestep() const;
     ENGINEGPUKERNELS_EXPORT void setCurrentTimestep(uint64_t timestep);
@@ -73,12 +89,22 @@ public:
 private:
     void automaticResizeArrays();
     void resizeArrays(ArraySizes const& additionals);
+    void updateSpotFactorGrid(SimulationParametersSpots const& spots);
+    void updateFlowFieldGrid(FlowFieldSettings const& settings);
 
     std::atomic<uint64_t> _currentTimestep;
+    int _deviceNumber = 0;
+    std::mutex _mutexForMonitorData;
     SimulationData* _cudaSimulationData;
     RenderingData* _cudaRenderingData;
     SimulationResult* _cudaSimulationResult;
     SelectionResult* _cudaSelectionResult;
     DataAccessTO* _cudaAccessTO;
     CudaMonitorData* _cudaMonitorData;
+    PeriodicGridData* _cudaSpotFactorGrid;  //host copy of the descriptor in constant memory
+    PeriodicGridData* _cudaFlowFieldGrid;
+
+    IntVector2D _worldSize;
+    SpotFactorGrid _spotFactorGrid;
+    FlowFieldGrid _flowFieldGrid;
 };
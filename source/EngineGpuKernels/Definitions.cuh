@@ -15,6 +15,7 @@ struct DataAccessTO;
 struct SimulationParameters;
 struct GpuSettings;
 class CudaMonitorData;
+struct PeriodicGridData;
 
 struct ApplyForceData
 {
@@ -4,6 +4,7 @@
 #include "sm_60_atomic_functions.h"
 
 #include "SimulationData.cuh"
+#include "SimulationResult.cuh"
 #include "CudaMonitorData.cuh"
 
 /************************************************************************/
@@ -47,14 +48,20 @@ __global__ void getEnergyForMonitorData(SimulationData data, CudaMonitorData mon
 /* Main      															*/
 /************************************************************************/
 
-__global__ void cudaGetCudaMonitorData(SimulationData data, CudaMonitorData monitorData)
+__global__ void
+cudaGetCudaMonitorData(SimulationData data, SimulationResult result, CudaMonitorData monitorData, uint64_t timeStep)
 {
-    monitorData.reset();
+    monitorData.reset(timeStep);
 
     monitorData.setNumCells(data.entities.cellPointers.getNumEntries());
     monitorData.setNumParticles(data.entities.particlePointers.getNumEntries());
     monitorData.setNumTokens(data.entities.tokenPointers.getNumEntries());
 
+    //process statistics are copied since the next time step already modifies them during the transfer to the host
+    auto const& statistics = result.getStatisticsOnDevice();
+    monitorData.setProcessStatistics(
+        statistics.createdCells, statistics.sucessfulAttacks, statistics.failedAttacks, statistics.muscleActivities);
+
 //    KERNEL_CALL(getEnergyForMonitorData, data, monitorData);
 }
 
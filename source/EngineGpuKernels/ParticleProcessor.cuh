@@ -97,7 +97,7 @@ __inline__ __device__ void ParticleProcessor::transformation(SimulationData& dat
         if (auto& particle = data.entities.particlePointers.at(particleIndex)) {
             
             auto cellMinEnergy =
-                SpotCalculator::calc(&SimulationParametersSpotValues::cellMinEnergy, data, particle->absPos);
+                SpotCalculator::calc(&SimulationParametersSpotValues::cellMinEnergy, particle->absPos);
             if (particle->energy >= cellMinEnergy) {
                 EntityFactory factory;
                 factory.init(&data);
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "Base/PeriodicGrid.h"
+
+#include "Base.cuh"
+#include "Definitions.cuh"
+
+/**
+ * Device counterpart of PeriodicGrid. The values reside in global memory, the struct itself is small enough to be
+ * placed in constant memory. Sampling matches PeriodicGrid::sample.
+ */
+struct PeriodicGridData
+{
+    float* values = nullptr;
+    int2 size = {0, 0};
+    float2 worldSize = {0, 0};
+    float2 invSpacing = {0, 0};
+    int numChannels = 0;
+
+    //the memory is reallocated only if the number of values changes
+    __host__ void upload(PeriodicGrid const& grid)
+    {
+        auto const& hostValues = grid.getValues();
+        if (static_cast<size_t>(size.x) * size.y * numChannels != hostValues.size()) {
+            free();
+            if (!hostValues.empty()) {
+                CudaMemoryManager::getInstance().acquireMemory<float>(hostValues.size(), values);
+            }
+        }
+        size = {grid.getSize().x, grid.getSize().y};
+        worldSize = {grid.getWorldSize().x, grid.getWorldSize().y};
+        invSpacing = {grid.getInvSpacing().x, grid.getInvSpacing().y};
+        numChannels = grid.getNumChannels();
+        if (!hostValues.empty()) {
+            CHECK_FOR_CUDA_ERROR(
+                cudaMemcpy(values, hostValues.data(), sizeof(float) * hostValues.size(), cudaMemcpyHostToDevice));
+        }
+    }
+
+    __host__ void free()
+    {
+        CudaMemoryManager::getInstance().freeMemory(values);
+        values = nullptr;
+        size = {0, 0};
+        numChannels = 0;
+    }
+
+    //writes numChannels floats to result
+    __device__ __inline__ void sample(float2 const& pos, float* result) const
+    {
+        auto gridX = (pos.x - worldSize.x * floorf(pos.x / worldSize.x)) * invSpacing.x;
+        auto gridY = (pos.y - worldSize.y * floorf(pos.y / worldSize.y)) * invSpacing.y;
+        auto x0 = static_cast<int>(gridX);
+        auto y0 = static_cast<int>(gridY);
+        auto fractionX = gridX - toFloat(x0);
+        auto fractionY = gridY - toFloat(y0);
+
+        //floating point rounding may yield exactly the grid size
+        x0 = min(x0, size.x - 1);
+        y0 = min(y0, size.y - 1);
+        auto x1 = x0 + 1 < size.x ? x0 + 1 : 0;
+        auto y1 = y0 + 1 < size.y ? y0 + 1 : 0;
+
+        auto values00 = values + (x0 + y0 * size.x) * numChannels;
+        auto values10 = values + (x1 + y0 * size.x) * numChannels;
+        auto values01 = values + (x0 + y1 * size.x) * numChannels;
+        auto values11 = values + (x1 + y1 * size.x) * numChannels;
+        for (int channel = 0; channel < numChannels; ++channel) {
+            auto upper = values00[channel] + (values10[channel] - values00[channel]) * fractionX;
+            auto lower = values01[channel] + (values11[channel] - values01[channel]) * fractionX;
+            result[channel] = upper + (lower - upper) * fractionY;
+        }
+    }
+};
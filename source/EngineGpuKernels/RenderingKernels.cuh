@@ -73,8 +73,6 @@ __global__ void drawBackground(
         imageSize.x - max(toInt((rectLowerRight.x - worldSize.x) * zoom), 0),
         imageSize.y - max(toInt((rectLowerRight.y - worldSize.y) * zoom), 0)};
 
-    MapInfo map;
-    map.init(worldSize);
     auto spaceColor = colorToFloat3(Const::SpaceColor);
     auto spotColor1 = colorToFloat3(cudaSimulationParametersSpots.spots[0].color);
     auto spotColor2 = colorToFloat3(cudaSimulationParametersSpots.spots[1].color);
@@ -89,35 +87,13 @@ __global__ void drawBackground(
         } else {
             if (0 == cudaSimulationParametersSpots.numSpots) {
                 drawPixel(imageData, index, spaceColor);
-            }
-            if (1 == cudaSimulationParametersSpots.numSpots) {
-                float2 worldPos = {toFloat(x) / zoom + rectUpperLeft.x, toFloat(y) / zoom + rectUpperLeft.y};
-                auto distance = map.mapDistance(
-                    worldPos,
-                    {cudaSimulationParametersSpots.spots[0].posX, cudaSimulationParametersSpots.spots[0].posY});
-                auto coreRadius = cudaSimulationParametersSpots.spots[0].coreRadius;
-                auto fadeoutRadius = cudaSimulationParametersSpots.spots[0].fadeoutRadius + 1;
-                auto factor = distance < coreRadius ? 0.0f : min(1.0f, (distance - coreRadius) / fadeoutRadius);
-                auto resultingColor = mix(spaceColor, spotColor1, factor);
-                drawPixel(imageData, index, resultingColor);
-            }
-            if (2 == cudaSimulationParametersSpots.numSpots) {
+            } else {
                 float2 worldPos = {toFloat(x) / zoom + rectUpperLeft.x, toFloat(y) / zoom + rectUpperLeft.y};
-                auto distance1 = map.mapDistance(
-                    worldPos,
-                    {cudaSimulationParametersSpots.spots[0].posX, cudaSimulationParametersSpots.spots[0].posY});
-                auto distance2 = map.mapDistance(
-                    worldPos,
-                    {cudaSimulationParametersSpots.spots[1].posX, cudaSimulationParametersSpots.spots[1].posY});
-
-                auto coreRadius1 = cudaSimulationParametersSpots.spots[0].coreRadius;
-                auto fadeoutRadius1 = cudaSimulationParametersSpots.spots[0].fadeoutRadius + 1;
-                auto factor1 = distance1 < coreRadius1 ? 0.0f : min(1.0f, (distance1 - coreRadius1) / fadeoutRadius1);
-                auto coreRadius2 = cudaSimulationParametersSpots.spots[1].coreRadius;
-                auto fadeoutRadius2 = cudaSimulationParametersSpots.spots[1].fadeoutRadius + 1;
-                auto factor2 = distance2 < coreRadius2 ? 0.0f : min(1.0f, (distance2 - coreRadius2) / fadeoutRadius2);
-
-                auto resultingColor = mix(spaceColor, spotColor1, spotColor2, factor1, factor2);
+                float factors[2];
+                cudaSpotFactorGrid.sample(worldPos, factors);
+                auto resultingColor = 1 == cudaSimulationParametersSpots.numSpots
+                    ? mix(spaceColor, spotColor1, factors[0])
+                    : mix(spaceColor, spotColor1, spotColor2, factors[0], factors[1]);
                 drawPixel(imageData, index, resultingColor);
             }
 
@@ -37,6 +37,8 @@ public:
         return result;
     }
 
+    __device__ Statistics const& getStatisticsOnDevice() const { return *_statistics; }
+
     __device__ void setArrayResizeNeeded(bool value) { *_arrayResizingNeeded = value; }
 
     __device__ void resetStatistics() { *_statistics = Statistics(); }
@@ -49,9 +49,9 @@ __inline__ __device__ void TokenProcessor::movement(SimulationData& data, int nu
             auto tokenBranchNumber = token->getTokenBranchNumber();
 
             auto cellMinEnergy =
-                SpotCalculator::calc(&SimulationParametersSpotValues::cellMinEnergy, data, cell->absPos);
+                SpotCalculator::calc(&SimulationParametersSpotValues::cellMinEnergy, cell->absPos);
             auto tokenMutationRate =
-                SpotCalculator::calc(&SimulationParametersSpotValues::tokenMutationRate, data, cell->absPos);
+                SpotCalculator::calc(&SimulationParametersSpotValues::tokenMutationRate, cell->absPos);
 
             for (int i = 0; i < cell->numConnections; ++i) {
                 auto const& connectedCell = cell->connections[i].cell;
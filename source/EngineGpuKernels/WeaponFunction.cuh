@@ -39,7 +39,7 @@ __inline__ __device__ void WeaponFunction::processing(Token* token, SimulationDa
                 auto energyToTransfer = otherCell->energy * cudaSimulationParameters.cellFunctionWeaponStrength + 1.0f;
 
                 auto cellFunctionWeaponGeometryDeviationExponent = SpotCalculator::calc(
-                    &SimulationParametersSpotValues::cellFunctionWeaponGeometryDeviationExponent, data, cell->absPos);
+                    &SimulationParametersSpotValues::cellFunctionWeaponGeometryDeviationExponent, cell->absPos);
 
                 if (abs(cellFunctionWeaponGeometryDeviationExponent) > FP_PRECISION) {
                     auto d = otherCell->absPos - cell->absPos;
@@ -53,7 +53,7 @@ __inline__ __device__ void WeaponFunction::processing(Token* token, SimulationDa
                 }
 
                 auto cellFunctionWeaponColorPenalty = SpotCalculator::calc(
-                    &SimulationParametersSpotValues::cellFunctionWeaponColorPenalty, data, cell->absPos);
+                    &SimulationParametersSpotValues::cellFunctionWeaponColorPenalty, cell->absPos);
 
                 auto homogene = isHomogene(cell);
                 auto otherHomogene = isHomogene(otherCell);
@@ -99,7 +99,7 @@ __inline__ __device__ void WeaponFunction::processing(Token* token, SimulationDa
         result.incFailedAttack();
     }
     auto cellFunctionWeaponEnergyCost =
-        SpotCalculator::calc(&SimulationParametersSpotValues::cellFunctionWeaponEnergyCost, data, cell->absPos);
+        SpotCalculator::calc(&SimulationParametersSpotValues::cellFunctionWeaponEnergyCost, cell->absPos);
     if (cellFunctionWeaponEnergyCost > 0) {
         auto const cellEnergy = cell->energy;
         auto& pos = cell->absPos;
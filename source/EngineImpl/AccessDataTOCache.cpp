@@ -1,32 +1,43 @@
 #include "AccessDataTOCache.h"
 
+#include "Base/Tracing.h"
+
+namespace
+{
+    size_t const MaxFreeEntries = 2;
+}
+
 _AccessDataTOCache::_AccessDataTOCache(GpuSettings const& gpuConstants)
     : _gpuConstants(gpuConstants)
 {}
 
 _AccessDataTOCache::~_AccessDataTOCache()
 {
-    for (DataAccessTO const& dataTO : _freeDataTOs) {
-        deleteDataTO(dataTO);
+    for (auto const& entry : _freeEntries) {
+        deleteDataTO(entry.dataTO);
     }
-    for (DataAccessTO const& dataTO : _usedDataTOs) {
-        deleteDataTO(dataTO);
+    for (auto const& entry : _usedEntries) {
+        deleteDataTO(entry.dataTO);
     }
 }
 
 DataAccessTO _AccessDataTOCache::getDataTO(ArraySizes const& arraySizes)
 {
-    if (!_arraySizes || * _arraySizes != arraySizes) {
-        for (DataAccessTO const& dataTO : _freeDataTOs) {
-            deleteDataTO(dataTO);
-        }
-        for (DataAccessTO const& dataTO : _usedDataTOs) {
-            deleteDataTO(dataTO);
+    TRACE_SCOPE("AccessDataTOCache", "get data");
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    //smaller buffers are outdated since the arrays only grow
+    for (auto const& entry : _freeEntries) {
+        if (!entry.arraySizes.isSufficientFor(arraySizes)) {
+            deleteDataTO(entry.dataTO);
         }
-        _freeDataTOs.clear();
-        _usedDataTOs.clear();
-        _arraySizes = arraySizes;
     }
+    _freeEntries.erase(
+        std::remove_if(
+            _freeEntries.begin(),
+            _freeEntries.end(),
+            [&](Entry const& entry) { return !entry.arraySizes.isSufficientFor(arraySizes); }),
+        _freeEntries.end());
 
     auto clear = [](auto& result) {
             *result.numCells = 0;
@@ -35,43 +46,53 @@ DataAccessTO _AccessDataTOCache::getDataTO(ArraySizes const& arraySizes)
             *result.numStringBytes = 0;
     };
 
-    DataAccessTO result;
-    if (!_freeDataTOs.empty()) {
-        result = *_freeDataTOs.begin();
-        _freeDataTOs.erase(_freeDataTOs.begin());
-        _usedDataTOs.emplace_back(result);
+    auto freeEntry = std::find_if(_freeEntries.begin(), _freeEntries.end(), [&](Entry const& entry) {
+        return entry.arraySizes.isSufficientFor(arraySizes);
+    });
+    if (freeEntry != _freeEntries.end()) {
+        auto result = freeEntry->dataTO;
+        _usedEntries.emplace_back(*freeEntry);
+        _freeEntries.erase(freeEntry);
 
         clear(result);
         return result;
     }
-    result = getNewDataTO();
-    _usedDataTOs.emplace_back(result);
+    auto result = getNewDataTO(arraySizes);
+    _usedEntries.emplace_back(Entry{result, arraySizes});
     clear(result);
     return result;
 }
 
 void _AccessDataTOCache::releaseDataTO(DataAccessTO const& dataTO)
 {
-    auto usedDataTO = std::find_if(_usedDataTOs.begin(), _usedDataTOs.end(), [&dataTO](DataAccessTO const& usedDataTO) {
-        return usedDataTO == dataTO;
+    TRACE_SCOPE("AccessDataTOCache", "release data");
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    auto usedEntry = std::find_if(_usedEntries.begin(), _usedEntries.end(), [&dataTO](Entry const& entry) {
+        return entry.dataTO == dataTO;
     });
-    if (usedDataTO != _usedDataTOs.end()) {
-        _freeDataTOs.emplace_back(*usedDataTO);
-        _usedDataTOs.erase(usedDataTO);
+    if (usedEntry != _usedEntries.end()) {
+        if (_freeEntries.size() < MaxFreeEntries) {
+            _freeEntries.emplace_back(*usedEntry);
+        } else {
+            deleteDataTO(usedEntry->dataTO);
+        }
+        _usedEntries.erase(usedEntry);
     }
 }
 
-DataAccessTO _AccessDataTOCache::getNewDataTO()
+DataAccessTO _AccessDataTOCache::getNewDataTO(ArraySizes const& arraySizes)
 {
+    TRACE_SCOPE("AccessDataTOCache", "allocate data");
     try {
         DataAccessTO result;
         result.numCells = new int;
         result.numParticles = new int;
         result.numTokens = new int;
         result.numStringBytes = new int;
-        result.cells = new CellAccessTO[_arraySizes->cellArraySize];
-        result.particles = new ParticleAccessTO[_arraySizes->particleArraySize];
-        result.tokens = new TokenAccessTO[_arraySizes->tokenArraySize];
+        result.cells = new CellAccessTO[arraySizes.cellArraySize];
+        result.particles = new ParticleAccessTO[arraySizes.particleArraySize];
+        result.tokens = new TokenAccessTO[arraySizes.tokenArraySize];
         result.stringBytes = new char[Const::MetadataMemorySize];
         return result;
     } catch (std::bad_alloc const&) {
@@ -1,11 +1,17 @@
 #pragma once
 
+#include <mutex>
+
 #include "Base/Definitions.h"
 
 #include "EngineGpuKernels/AccessTOs.cuh"
 
 #include "Definitions.h"
 
+/**
+ * Thread-safe pool of host buffers for data transfers. A buffer may be used on a different thread than the one which
+ * acquired it, e.g. for converting its content while the worker thread continues with the next time step.
+ */
 class _AccessDataTOCache
 {
 public:
@@ -25,17 +31,28 @@ public:
         }
 
         bool operator!=(ArraySizes const& other) const { return !operator==(other); };
+
+        bool isSufficientFor(ArraySizes const& other) const
+        {
+            return cellArraySize >= other.cellArraySize && particleArraySize >= other.particleArraySize
+                && tokenArraySize >= other.tokenArraySize;
+        }
     };
-    DataAccessTO getDataTO(ArraySizes const& arraySizes);
+    DataAccessTO getDataTO(ArraySizes const& arraySizes);   //returned buffer can hold at least the given sizes
     void releaseDataTO(DataAccessTO const& dataTO);
 
 private:
-    DataAccessTO getNewDataTO();
+    struct Entry
+    {
+        DataAccessTO dataTO;
+        ArraySizes arraySizes;
+    };
+    DataAccessTO getNewDataTO(ArraySizes const& arraySizes);
     void deleteDataTO(DataAccessTO const& dataTO);
 
     GpuSettings _gpuConstants;
-    std::vector<DataAccessTO> _freeDataTOs;
-    std::vector<DataAccessTO> _usedDataTOs;
-    boost::optional<ArraySizes> _arraySizes;
-};
 
+    std::mutex _mutex;
+    std::vector<Entry> _freeEntries;
+    std::vector<Entry> _usedEntries;
+};
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "Base/FieldTable.h"
+
+/**
+ * Host-side mirror of a settings struct in GPU constant memory. Updates are collected until the worker fetches them
+ * once per time step, so that rapid changes are coalesced and only the memory of changed fields is uploaded.
+ * Not thread-safe, access has to be synchronized by the owner.
+ */
+template <typename T>
+class CoalescedUpload
+{
+public:
+    //value which is present in GPU memory, e.g. after a complete upload
+    void reset(T const& uploadedValue)
+    {
+        _uploadedValue = uploadedValue;
+        _pendingValue = boost::none;
+    }
+
+    //returns false if value is already pending or uploaded
+    bool set(T const& value)
+    {
+        if (_pendingValue && *_pendingValue == value) {
+            return false;
+        }
+        if (value == _uploadedValue) {
+            _pendingValue = boost::none;  //changes have been reverted before the upload
+            return false;
+        }
+        _pendingValue = value;
+        return true;
+    }
+
+    bool hasPendingValue() const { return _pendingValue.has_value(); }
+
+    //memory ranges of getUploadedValue() which have to be uploaded, the pending value becomes the uploaded value
+    std::vector<ByteRange> fetch()
+    {
+        if (!_pendingValue) {
+            return {};
+        }
+        auto result = FieldTable::diffByteRanges(*_pendingValue, _uploadedValue);
+        _uploadedValue = *_pendingValue;
+        _pendingValue = boost::none;
+        return result;
+    }
+
+    T const& getUploadedValue() const { return _uploadedValue; }
+    T const& getLatestValue() const { return _pendingValue ? *_pendingValue : _uploadedValue; }
+
+private:
+    T _uploadedValue = T();
+    boost::optional<T> _pendingValue;
+};
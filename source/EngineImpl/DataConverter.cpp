@@ -5,6 +5,7 @@
 
 #include "Base/NumberGenerator.h"
 #include "Base/Exceptions.h"
+#include "Base/Tracing.h"
 #include "EngineInterface/Descriptions.h"
 #include "EngineInterface/ChangeDescriptions.h"
 
@@ -20,9 +21,18 @@ DataConverter::DataConverter(
 DataDescription DataConverter::convertAccessTOtoDataDescription(DataAccessTO const& dataTO)
 {
 	DataDescription result;
+    convertAccessTOtoDataDescription(dataTO, result);
+    return result;
+}
+
+void DataConverter::convertAccessTOtoDataDescription(DataAccessTO const& dataTO, DataDescription& result)
+{
+    TRACE_SCOPE("DataConverter", "convert to data description");
+
+    //descriptions are constructed in place so that they use the allocator of result
+    result.clear();
 
     //cells
-    std::vector<ClusterDescription> clusters;
     std::unordered_set<int> freeCellIndices;
     for (int i = 0; i < *dataTO.numCells; ++i) {
         freeCellIndices.insert(i);
@@ -32,52 +42,48 @@ DataDescription DataConverter::convertAccessTOtoDataDescription(DataAccessTO con
     int clusterDescIndex = 0;
     while (!freeCellIndices.empty()) {
         auto freeCellIndex = *freeCellIndices.begin();
-        auto createClusterData = scanAndCreateClusterDescription(dataTO, freeCellIndex, freeCellIndices);
-        clusters.emplace_back(createClusterData.cluster);
+        auto& cluster = result.emplaceCluster();
+        auto clusterCellTOIndexToCellDescIndex =
+            scanAndCreateClusterDescription(dataTO, freeCellIndex, freeCellIndices, cluster);
 
         //update index maps
         cellTOIndexToCellDescIndex.insert(
-            createClusterData.cellTOIndexToCellDescIndex.begin(), createClusterData.cellTOIndexToCellDescIndex.end());
-        for (auto const& cellTOIndex : createClusterData.cellTOIndexToCellDescIndex | boost::adaptors::map_keys) {
+            clusterCellTOIndexToCellDescIndex.begin(), clusterCellTOIndexToCellDescIndex.end());
+        for (auto const& cellTOIndex : clusterCellTOIndexToCellDescIndex | boost::adaptors::map_keys) {
             cellTOIndexToClusterDescIndex.emplace(cellTOIndex, clusterDescIndex);
         }
         ++clusterDescIndex;
     }
-    result.addClusters(clusters);
 
     //tokens
     for (int i = 0; i < *dataTO.numTokens; ++i) {
         TokenAccessTO const& token = dataTO.tokens[i];
 
-        std::string data(_parameters.tokenMemorySize, 0);
-        for (int i = 0; i < _parameters.tokenMemorySize; ++i) {
-            data[i] = token.memory[i];
-        }
         auto clusterDescIndex = cellTOIndexToClusterDescIndex.at(token.cellIndex);
         auto cellDescIndex = cellTOIndexToCellDescIndex.at(token.cellIndex);
         CellDescription& cell = result.clusters.at(clusterDescIndex).cells.at(cellDescIndex);
 
-        cell.addToken(TokenDescription().setEnergy(token.energy).setData(data));
+        cell.tokens.emplace_back()
+            .setEnergy(token.energy)
+            .setData(std::string_view(token.memory, _parameters.tokenMemorySize));
     }
 
     //particles
-    std::vector<ParticleDescription> particles;
+    result.particles.reserve(*dataTO.numParticles);
     for (int i = 0; i < *dataTO.numParticles; ++i) {
         ParticleAccessTO const& particle = dataTO.particles[i];
-        particles.emplace_back(ParticleDescription()
-                                   .setId(particle.id)
-                                   .setPos({particle.pos.x, particle.pos.y})
-                                   .setVel({particle.vel.x, particle.vel.y})
-                                   .setEnergy(particle.energy)
-                                   .setMetadata(ParticleMetadata().setColor(particle.metadata.color)));
+        result.emplaceParticle()
+            .setId(particle.id)
+            .setPos({particle.pos.x, particle.pos.y})
+            .setVel({particle.vel.x, particle.vel.y})
+            .setEnergy(particle.energy)
+            .setMetadata(ParticleMetadata().setColor(particle.metadata.color));
     }
-    result.addParticles(particles);
-
-    return result;
 }
 
 OverlayDescription DataConverter::convertAccessTOtoOverlayDescription(DataAccessTO const& dataTO)
 {
+    TRACE_SCOPE("DataConverter", "convert to overlay description");
     OverlayDescription result;
     result.elements.reserve(*dataTO.numCells + *dataTO.numParticles);
     for (int i = 0; i < *dataTO.numCells; ++i) {
@@ -103,6 +109,7 @@ OverlayDescription DataConverter::convertAccessTOtoOverlayDescription(DataAccess
 
 void DataConverter::convertDataDescriptionToAccessTO(DataAccessTO& result, DataChangeDescription const& description)
 {
+    TRACE_SCOPE("DataConverter", "convert to access data");
     unordered_map<uint64_t, int> cellIndexByIds;
     for (auto const& cell : description.cells) {
         if (cell.isAdded()) {
@@ -125,15 +132,7 @@ void DataConverter::convertDataDescriptionToAccessTO(DataAccessTO& result, DataC
 
 namespace
 {
-    std::string convertToString(char const* data, int size) {
-        std::string result(size, 0);
-        for (int i = 0; i < size; ++i) {
-            result[i] = data[i];
-        }
-        return result;
-    }
-
-    void convertToArray(std::string const& source, char* target, int size)
+    void convertToArray(std::string_view source, char* target, int size)
     {
         for (int i = 0; i < size; ++i) {
             if (i < source.size()) {
@@ -157,25 +156,24 @@ namespace
     }
 }
 
-auto DataConverter::scanAndCreateClusterDescription(
+std::unordered_map<int, int> DataConverter::scanAndCreateClusterDescription(
     DataAccessTO const& dataTO,
     int startCellIndex,
-    std::unordered_set<int>& freeCellIndices) const
-    -> CreateClusterReturnData
+    std::unordered_set<int>& freeCellIndices,
+    ClusterDescription& cluster) const
 {
-    CreateClusterReturnData result; 
+    std::unordered_map<int, int> result;
 
     std::unordered_set<int> currentCellIndices;
     currentCellIndices.insert(startCellIndex);
     std::unordered_set<int> scannedCellIndices = currentCellIndices;
 
-    std::vector<CellDescription> cells;
     std::unordered_set<int> nextCellIndices;
     int cellDescIndex = 0;
     do {
         for (auto const& currentCellIndex : currentCellIndices) {
-            cells.emplace_back(createCellDescription(dataTO, currentCellIndex));
-            result.cellTOIndexToCellDescIndex.emplace(currentCellIndex, cellDescIndex);
+            createCellDescription(dataTO, currentCellIndex, cluster.emplaceCell());
+            result.emplace(currentCellIndex, cellDescIndex);
             auto const& cellTO = dataTO.cells[currentCellIndex];
             for (int i = 0; i < cellTO.numConnections; ++i) {
                 auto connectionTO = cellTO.connections[i];
@@ -192,61 +190,48 @@ auto DataConverter::scanAndCreateClusterDescription(
 
     setInplaceDifference(freeCellIndices, scannedCellIndices);
 
-    result.cluster.id = NumberGenerator::getInstance().getId();
-    result.cluster.addCells(cells);
-
+    cluster.id = NumberGenerator::getInstance().getId();
     return result;
 }
 
-CellDescription DataConverter::createCellDescription(DataAccessTO const& dataTO, int cellIndex) const
+void DataConverter::createCellDescription(DataAccessTO const& dataTO, int cellIndex, CellDescription& result) const
 {
-    CellDescription result;
-
     auto const& cellTO = dataTO.cells[cellIndex];
     result.id = cellTO.id;
     result.pos = RealVector2D(cellTO.pos.x, cellTO.pos.y);
     result.vel = RealVector2D(cellTO.vel.x, cellTO.vel.y);
     result.energy = cellTO.energy;
     result.maxConnections = cellTO.maxConnections;
-    std::vector<ConnectionDescription> connections;
+    result.connections.reserve(cellTO.numConnections);
     for (int i = 0; i < cellTO.numConnections; ++i) {
         auto const& connectionTO = cellTO.connections[i];
         ConnectionDescription connection;
         connection.cellId = dataTO.cells[connectionTO.cellIndex].id;
         connection.distance = connectionTO.distance;
         connection.angleFromPrevious = connectionTO.angleFromPrevious;
-        connections.emplace_back(connection);
+        result.connections.emplace_back(connection);
     }
-    result.connections = connections;
     result.tokenBlocked = cellTO.tokenBlocked;
     result.tokenBranchNumber = cellTO.branchNumber;
 
     auto const& metadataTO = cellTO.metadata;
-    auto metadata = CellMetadata().setColor(metadataTO.color);
+    result.metadata.setColor(metadataTO.color);
     if (metadataTO.nameLen > 0) {
-        auto const name = std::string(&dataTO.stringBytes[metadataTO.nameStringIndex], metadataTO.nameLen);
-        metadata.setName(name);
+        result.metadata.setName(std::string_view(&dataTO.stringBytes[metadataTO.nameStringIndex], metadataTO.nameLen));
     }
     if (metadataTO.descriptionLen > 0) {
-        auto const description =
-            std::string(&dataTO.stringBytes[metadataTO.descriptionStringIndex], metadataTO.descriptionLen);
-        metadata.setDescription(description);
+        result.metadata.setDescription(
+            std::string_view(&dataTO.stringBytes[metadataTO.descriptionStringIndex], metadataTO.descriptionLen));
     }
     if (metadataTO.sourceCodeLen > 0) {
-        auto const sourceCode =
-            std::string(&dataTO.stringBytes[metadataTO.sourceCodeStringIndex], metadataTO.sourceCodeLen);
-        metadata.setSourceCode(sourceCode);
+        result.metadata.setSourceCode(
+            std::string_view(&dataTO.stringBytes[metadataTO.sourceCodeStringIndex], metadataTO.sourceCodeLen));
     }
-    result.metadata = metadata;
 
-    auto feature = CellFeatureDescription()
-                       .setType(static_cast<Enums::CellFunction::Type>(cellTO.cellFunctionType))
-                       .setConstData(convertToString(cellTO.staticData, cellTO.numStaticBytes))
-                       .setVolatileData(convertToString(cellTO.mutableData, cellTO.numMutableBytes));
-    result.cellFeature = feature;
+    result.cellFeature.setType(static_cast<Enums::CellFunction::Type>(cellTO.cellFunctionType))
+        .setConstData(std::string_view(cellTO.staticData, cellTO.numStaticBytes))
+        .setVolatileData(std::string_view(cellTO.mutableData, cellTO.numMutableBytes));
     result.tokenUsages = cellTO.tokenUsages;
-
-    return result;
 }
 
 void DataConverter::addParticle(DataAccessTO const& dataTO, ParticleDescription const& particleDesc)
@@ -261,12 +246,16 @@ void DataConverter::addParticle(DataAccessTO const& dataTO, ParticleDescription
     particleTO.metadata.color = particleDesc.metadata.color;
 }
 
-int DataConverter::convertStringAndReturnStringIndex(DataAccessTO const& dataTO, std::string const& s)
+int DataConverter::convertStringAndReturnStringIndex(DataAccessTO const& dataTO, std::string_view s)
+{
+    return convertStringAndReturnStringIndex(dataTO, s.data(), static_cast<int>(s.size()));
+}
+
+int DataConverter::convertStringAndReturnStringIndex(DataAccessTO const& dataTO, char const* data, int len)
 {
     auto result = *dataTO.numStringBytes;
-    int len = static_cast<int>(s.size());
     for (int i = 0; i < len; ++i) {
-        dataTO.stringBytes[result + i] = s.at(i);
+        dataTO.stringBytes[result + i] = data[i];
     }
     (*dataTO.numStringBytes) += len;
     return result;
@@ -280,59 +269,43 @@ void DataConverter::addCell(
     int cellIndex = (*dataTO.numCells)++;
     CellAccessTO& cellTO = dataTO.cells[cellIndex];
     cellTO.id = cellDesc.id == 0 ? NumberGenerator::getInstance().getId() : cellDesc.id;
-	cellTO.pos= { cellDesc.pos->x, cellDesc.pos->y };
-    cellTO.vel = {cellDesc.vel->x, cellDesc.vel->y};
-    cellTO.energy = toFloat(*cellDesc.energy);
-	cellTO.maxConnections = *cellDesc.maxConnections;
-    cellTO.branchNumber = cellDesc.tokenBranchNumber.getOptionalValue().get_value_or(0);
-    cellTO.tokenBlocked = cellDesc.tokenBlocked.getOptionalValue().get_value_or(false);
-    cellTO.tokenUsages = cellDesc.tokenUsages.getOptionalValue().get_value_or(0);
-    auto const& cellFunction = cellDesc.cellFeatures.getOptionalValue().get_value_or(CellFeatureDescription());
+    cellTO.pos = {cellDesc.pos.x, cellDesc.pos.y};
+    cellTO.vel = {cellDesc.vel.x, cellDesc.vel.y};
+    cellTO.energy = toFloat(cellDesc.energy);
+    cellTO.maxConnections = cellDesc.maxConnections;
+    cellTO.branchNumber = cellDesc.tokenBranchNumber;
+    cellTO.tokenBlocked = cellDesc.tokenBlocked;
+    cellTO.tokenUsages = cellDesc.tokenUsages;
+    auto const& cellFunction = cellDesc.cellFeatures;
     cellTO.cellFunctionType = cellFunction.getType();
     cellTO.numStaticBytes = std::min(static_cast<int>(cellFunction.constData.size()), MAX_CELL_STATIC_BYTES);
     cellTO.numMutableBytes = std::min(static_cast<int>(cellFunction.volatileData.size()), MAX_CELL_MUTABLE_BYTES);
     convertToArray(cellFunction.constData, cellTO.staticData, MAX_CELL_STATIC_BYTES);
     convertToArray(cellFunction.volatileData, cellTO.mutableData, MAX_CELL_MUTABLE_BYTES);
-    if (cellDesc.connectingCells.getOptionalValue()) {
-		cellTO.numConnections = toInt(cellDesc.connectingCells->size());
-	}
-	else {
-		cellTO.numConnections = 0;
-	}
-    if (cellDesc.metadata.getOptionalValue()) {
-        auto& metadataTO = cellTO.metadata;
-        metadataTO.color = cellDesc.metadata->color;
-        metadataTO.nameLen = toInt(cellDesc.metadata->name.size());
-        if (metadataTO.nameLen > 0) {
-            metadataTO.nameStringIndex = convertStringAndReturnStringIndex(dataTO, cellDesc.metadata->name);
-        }
-        metadataTO.descriptionLen = toInt(cellDesc.metadata->description.size());
-        if (metadataTO.descriptionLen > 0) {
-            metadataTO.descriptionStringIndex =
-                convertStringAndReturnStringIndex(dataTO, cellDesc.metadata->description);
-        }
-        metadataTO.sourceCodeLen = toInt(cellDesc.metadata->computerSourcecode.size());
-        if (metadataTO.sourceCodeLen > 0) {
-            metadataTO.sourceCodeStringIndex =
-                convertStringAndReturnStringIndex(dataTO, cellDesc.metadata->computerSourcecode);
-        }
+    cellTO.numConnections = toInt(cellDesc.connectingCells.size());
+
+    auto& metadataTO = cellTO.metadata;
+    metadataTO.color = cellDesc.metadata.color;
+    metadataTO.nameLen = toInt(cellDesc.metadata.name.size());
+    if (metadataTO.nameLen > 0) {
+        metadataTO.nameStringIndex = convertStringAndReturnStringIndex(dataTO, cellDesc.metadata.name);
     }
-    else {
-        cellTO.metadata.color = 0;
-        cellTO.metadata.nameLen = 0;
-        cellTO.metadata.descriptionLen = 0;
-        cellTO.metadata.sourceCodeLen= 0;
+    metadataTO.descriptionLen = toInt(cellDesc.metadata.description.size());
+    if (metadataTO.descriptionLen > 0) {
+        metadataTO.descriptionStringIndex = convertStringAndReturnStringIndex(dataTO, cellDesc.metadata.description);
+    }
+    metadataTO.sourceCodeLen = toInt(cellDesc.metadata.computerSourcecode.size());
+    if (metadataTO.sourceCodeLen > 0) {
+        metadataTO.sourceCodeStringIndex =
+            convertStringAndReturnStringIndex(dataTO, cellDesc.metadata.computerSourcecode);
     }
 
-    if (cellDesc.tokens.getOptionalValue()) {
-        for (int i = 0; i < cellDesc.tokens->size(); ++i) {
-            TokenDescription const& tokenDesc = cellDesc.tokens->at(i);
-            int tokenIndex = (*dataTO.numTokens)++;
-            TokenAccessTO& tokenTO = dataTO.tokens[tokenIndex];
-            tokenTO.energy = toFloat(tokenDesc.energy);
-            tokenTO.cellIndex = cellIndex;
-            convertToArray(tokenDesc.data, tokenTO.memory, _parameters.tokenMemorySize);
-        }
+    for (auto const& tokenDesc : cellDesc.tokens) {
+        int tokenIndex = (*dataTO.numTokens)++;
+        TokenAccessTO& tokenTO = dataTO.tokens[tokenIndex];
+        tokenTO.energy = toFloat(tokenDesc.energy);
+        tokenTO.cellIndex = cellIndex;
+        convertToArray(tokenDesc.data, tokenTO.memory, _parameters.tokenMemorySize);
     }
 	cellIndexTOByIds.insert_or_assign(cellTO.id, cellIndex);
 }
@@ -342,17 +315,15 @@ void DataConverter::setConnections(
     CellChangeDescription const& cellToAdd,
     unordered_map<uint64_t, int> const& cellIndexByIds)
 {
-	if (cellToAdd.connectingCells.getOptionalValue()) {
-		int index = 0;
-        auto& cellTO = dataTO.cells[cellIndexByIds.at(cellToAdd.id)];
-        for (ConnectionChangeDescription const& connection : *cellToAdd.connectingCells) {
-            cellTO.connections[index].cellIndex = cellIndexByIds.at(connection.cellId);
-            cellTO.connections[index].distance = toFloat(connection.distance);
-            cellTO.connections[index].angleFromPrevious = toFloat(connection.angleFromPrevious);
-            ++index;
-		}
-        cellTO.numConnections = index;
-	}
+    int index = 0;
+    auto& cellTO = dataTO.cells[cellIndexByIds.at(cellToAdd.id)];
+    for (ConnectionChangeDescription const& connection : cellToAdd.connectingCells) {
+        cellTO.connections[index].cellIndex = cellIndexByIds.at(connection.cellId);
+        cellTO.connections[index].distance = toFloat(connection.distance);
+        cellTO.connections[index].angleFromPrevious = toFloat(connection.angleFromPrevious);
+        ++index;
+    }
+    cellTO.numConnections = index;
 }
 
 namespace
@@ -363,3 +334,230 @@ namespace
 		output.y = input.y;
 	}
 }
+
+namespace
+{
+    void convertToArray(char const* source, int sourceSize, char* target, int size)
+    {
+        for (int i = 0; i < size; ++i) {
+            target[i] = i < sourceSize ? source[i] : 0;
+        }
+    }
+
+    void addString(StringColumn& column, DataAccessTO const& dataTO, int stringIndex, int len)
+    {
+        //string index is undefined for empty strings
+        if (len > 0) {
+            column.add(&dataTO.stringBytes[stringIndex], len);
+        } else {
+            column.add(nullptr, 0);
+        }
+    }
+}
+
+ColumnarDataDescription DataConverter::convertAccessTOtoColumnarDataDescription(DataAccessTO const& dataTO)
+{
+    TRACE_SCOPE("DataConverter", "convert to columnar data description");
+    ColumnarDataDescription result;
+
+    //group tokens by their cells
+    std::vector<int> tokenOffsets(*dataTO.numCells + 1, 0);
+    for (int i = 0; i < *dataTO.numTokens; ++i) {
+        ++tokenOffsets[dataTO.tokens[i].cellIndex + 1];
+    }
+    for (int i = 0; i < *dataTO.numCells; ++i) {
+        tokenOffsets[i + 1] += tokenOffsets[i];
+    }
+    std::vector<int> sortedTokenIndices(*dataTO.numTokens);
+    {
+        auto insertPositions = tokenOffsets;
+        for (int i = 0; i < *dataTO.numTokens; ++i) {
+            sortedTokenIndices[insertPositions[dataTO.tokens[i].cellIndex]++] = i;
+        }
+    }
+
+    int numConnections = 0;
+    for (int i = 0; i < *dataTO.numCells; ++i) {
+        numConnections += dataTO.cells[i].numConnections;
+    }
+    result.reserve(0, *dataTO.numCells, numConnections, *dataTO.numTokens, *dataTO.numParticles);
+
+    //cells of a cluster are collected by a breadth-first search over the connections
+    std::vector<bool> scannedCellIndices(*dataTO.numCells, false);
+    std::vector<int> cellIndexQueue;
+    cellIndexQueue.reserve(*dataTO.numCells);
+    for (int startCellIndex = 0; startCellIndex < *dataTO.numCells; ++startCellIndex) {
+        if (scannedCellIndices[startCellIndex]) {
+            continue;
+        }
+        result.addCluster(NumberGenerator::getInstance().getId());
+        scannedCellIndices[startCellIndex] = true;
+        auto queueIndex = cellIndexQueue.size();
+        cellIndexQueue.emplace_back(startCellIndex);
+        while (queueIndex < cellIndexQueue.size()) {
+            auto cellIndex = cellIndexQueue[queueIndex++];
+            addColumnarCell(result, dataTO, cellIndex, tokenOffsets, sortedTokenIndices);
+
+            auto const& cellTO = dataTO.cells[cellIndex];
+            for (int i = 0; i < cellTO.numConnections; ++i) {
+                auto connectingCellIndex = cellTO.connections[i].cellIndex;
+                if (!scannedCellIndices[connectingCellIndex]) {
+                    scannedCellIndices[connectingCellIndex] = true;
+                    cellIndexQueue.emplace_back(connectingCellIndex);
+                }
+            }
+        }
+    }
+
+    //particles
+    for (int i = 0; i < *dataTO.numParticles; ++i) {
+        ParticleAccessTO const& particle = dataTO.particles[i];
+        result.particleIds.emplace_back(particle.id);
+        result.particlePositions.emplace_back(particle.pos.x, particle.pos.y);
+        result.particleVelocities.emplace_back(particle.vel.x, particle.vel.y);
+        result.particleEnergies.emplace_back(particle.energy);
+        result.particleColors.emplace_back(particle.metadata.color);
+    }
+
+    return result;
+}
+
+void DataConverter::convertColumnarDataDescriptionToAccessTO(
+    DataAccessTO& result,
+    ColumnarDataDescription const& description)
+{
+    TRACE_SCOPE("DataConverter", "convert columnar data to access data");
+    unordered_map<uint64_t, int> cellIndexByIds;
+    cellIndexByIds.reserve(description.getNumCells());
+
+    std::vector<int> cellTOIndices(description.getNumCells());
+    for (int index = 0; index < description.getNumCells(); ++index) {
+        int cellIndex = (*result.numCells)++;
+        cellTOIndices[index] = cellIndex;
+
+        CellAccessTO& cellTO = result.cells[cellIndex];
+        auto id = description.cellIds[index];
+        cellTO.id = id == 0 ? NumberGenerator::getInstance().getId() : id;
+        cellTO.pos = {description.cellPositions[index].x, description.cellPositions[index].y};
+        cellTO.vel = {description.cellVelocities[index].x, description.cellVelocities[index].y};
+        cellTO.energy = toFloat(description.cellEnergies[index]);
+        cellTO.maxConnections = description.cellMaxConnections[index];
+        cellTO.branchNumber = description.cellTokenBranchNumbers[index];
+        cellTO.tokenBlocked = description.cellTokenBlocked[index] != 0;
+        cellTO.tokenUsages = description.cellTokenUsages[index];
+        cellTO.cellFunctionType = description.cellFunctionTypes[index];
+
+        auto const& constData = description.cellConstData;
+        auto const& volatileData = description.cellVolatileData;
+        cellTO.numStaticBytes = std::min(constData.getLength(index), MAX_CELL_STATIC_BYTES);
+        cellTO.numMutableBytes = std::min(volatileData.getLength(index), MAX_CELL_MUTABLE_BYTES);
+        convertToArray(constData.getData(index), constData.getLength(index), cellTO.staticData, MAX_CELL_STATIC_BYTES);
+        convertToArray(
+            volatileData.getData(index), volatileData.getLength(index), cellTO.mutableData, MAX_CELL_MUTABLE_BYTES);
+        cellTO.numConnections = 0;
+
+        auto& metadataTO = cellTO.metadata;
+        metadataTO.color = description.cellColors[index];
+        metadataTO.nameLen = description.cellNames.getLength(index);
+        if (metadataTO.nameLen > 0) {
+            metadataTO.nameStringIndex = convertStringAndReturnStringIndex(
+                result, description.cellNames.getData(index), metadataTO.nameLen);
+        }
+        metadataTO.descriptionLen = description.cellDescriptions.getLength(index);
+        if (metadataTO.descriptionLen > 0) {
+            metadataTO.descriptionStringIndex = convertStringAndReturnStringIndex(
+                result, description.cellDescriptions.getData(index), metadataTO.descriptionLen);
+        }
+        metadataTO.sourceCodeLen = description.cellSourceCodes.getLength(index);
+        if (metadataTO.sourceCodeLen > 0) {
+            metadataTO.sourceCodeStringIndex = convertStringAndReturnStringIndex(
+                result, description.cellSourceCodes.getData(index), metadataTO.sourceCodeLen);
+        }
+
+        for (int i = description.cellTokenOffsets[index]; i < description.cellTokenOffsets[index + 1]; ++i) {
+            int tokenIndex = (*result.numTokens)++;
+            TokenAccessTO& tokenTO = result.tokens[tokenIndex];
+            tokenTO.energy = toFloat(description.tokenEnergies[i]);
+            tokenTO.cellIndex = cellIndex;
+            convertToArray(
+                description.tokenData.getData(i),
+                description.tokenData.getLength(i),
+                tokenTO.memory,
+                _parameters.tokenMemorySize);
+        }
+        cellIndexByIds.insert_or_assign(cellTO.id, cellIndex);
+    }
+
+    //connections can only be resolved for cells with given ids
+    for (int index = 0; index < description.getNumCells(); ++index) {
+        if (description.cellIds[index] == 0) {
+            continue;
+        }
+        auto& cellTO = result.cells[cellTOIndices[index]];
+        int connectionIndex = 0;
+        for (int i = description.cellConnectionOffsets[index]; i < description.cellConnectionOffsets[index + 1]; ++i) {
+            auto& connectionTO = cellTO.connections[connectionIndex];
+            connectionTO.cellIndex = cellIndexByIds.at(description.connectionCellIds[i]);
+            connectionTO.distance = description.connectionDistances[i];
+            connectionTO.angleFromPrevious = description.connectionAnglesFromPrevious[i];
+            ++connectionIndex;
+        }
+        cellTO.numConnections = connectionIndex;
+    }
+
+    for (int index = 0; index < description.getNumParticles(); ++index) {
+        auto particleIndex = (*result.numParticles)++;
+        ParticleAccessTO& particleTO = result.particles[particleIndex];
+        auto id = description.particleIds[index];
+        particleTO.id = id == 0 ? NumberGenerator::getInstance().getId() : id;
+        particleTO.pos = {description.particlePositions[index].x, description.particlePositions[index].y};
+        particleTO.vel = {description.particleVelocities[index].x, description.particleVelocities[index].y};
+        particleTO.energy = toFloat(description.particleEnergies[index]);
+        particleTO.metadata.color = description.particleColors[index];
+    }
+}
+
+void DataConverter::addColumnarCell(
+    ColumnarDataDescription& result,
+    DataAccessTO const& dataTO,
+    int cellIndex,
+    std::vector<int> const& tokenOffsets,
+    std::vector<int> const& sortedTokenIndices) const
+{
+    auto const& cellTO = dataTO.cells[cellIndex];
+    result.cellIds.emplace_back(cellTO.id);
+    result.cellPositions.emplace_back(cellTO.pos.x, cellTO.pos.y);
+    result.cellVelocities.emplace_back(cellTO.vel.x, cellTO.vel.y);
+    result.cellEnergies.emplace_back(cellTO.energy);
+    result.cellMaxConnections.emplace_back(cellTO.maxConnections);
+    result.cellTokenBlocked.emplace_back(cellTO.tokenBlocked);
+    result.cellTokenBranchNumbers.emplace_back(cellTO.branchNumber);
+    result.cellTokenUsages.emplace_back(cellTO.tokenUsages);
+    result.cellFunctionTypes.emplace_back(
+        CellFeatureDescription().setType(static_cast<Enums::CellFunction::Type>(cellTO.cellFunctionType)).getType());
+    result.cellConstData.add(cellTO.staticData, cellTO.numStaticBytes);
+    result.cellVolatileData.add(cellTO.mutableData, cellTO.numMutableBytes);
+
+    auto const& metadataTO = cellTO.metadata;
+    result.cellColors.emplace_back(metadataTO.color);
+    addString(result.cellNames, dataTO, metadataTO.nameStringIndex, metadataTO.nameLen);
+    addString(result.cellDescriptions, dataTO, metadataTO.descriptionStringIndex, metadataTO.descriptionLen);
+    addString(result.cellSourceCodes, dataTO, metadataTO.sourceCodeStringIndex, metadataTO.sourceCodeLen);
+
+    for (int i = 0; i < cellTO.numConnections; ++i) {
+        auto const& connectionTO = cellTO.connections[i];
+        result.connectionCellIds.emplace_back(dataTO.cells[connectionTO.cellIndex].id);
+        result.connectionDistances.emplace_back(connectionTO.distance);
+        result.connectionAnglesFromPrevious.emplace_back(connectionTO.angleFromPrevious);
+    }
+    result.cellConnectionOffsets.emplace_back(result.getNumConnections());
+
+    for (int i = tokenOffsets[cellIndex]; i < tokenOffsets[cellIndex + 1]; ++i) {
+        auto const& token = dataTO.tokens[sortedTokenIndices[i]];
+        result.tokenEnergies.emplace_back(token.energy);
+        result.tokenData.add(token.memory, _parameters.tokenMemorySize);
+    }
+    result.cellTokenOffsets.emplace_back(result.getNumTokens());
+
+    ++result.clusterCellOffsets.back();
+}
@@ -3,6 +3,7 @@
 #include "EngineInterface/Definitions.h"
 #include "EngineInterface/Descriptions.h"
 #include "EngineInterface/ChangeDescriptions.h"
+#include "EngineInterface/ColumnarDescriptions.h"
 #include "EngineInterface/OverlayDescriptions.h"
 #include "EngineInterface/SimulationParameters.h"
 #include "EngineGpuKernels/AccessTOs.cuh"
@@ -16,20 +17,28 @@ public:
     DataConverter(SimulationParameters const& parameters, GpuSettings const& gpuConstants);
 
     DataDescription convertAccessTOtoDataDescription(DataAccessTO const& dataTO);
+    void convertAccessTOtoDataDescription(DataAccessTO const& dataTO, DataDescription& result);  //keeps allocator
     OverlayDescription convertAccessTOtoOverlayDescription(DataAccessTO const& dataTO);
     void convertDataDescriptionToAccessTO(DataAccessTO& result, DataChangeDescription const& description);
 
+    //columnar variants avoid the intermediate per-cell descriptions
+    ColumnarDataDescription convertAccessTOtoColumnarDataDescription(DataAccessTO const& dataTO);
+    void convertColumnarDataDescriptionToAccessTO(DataAccessTO& result, ColumnarDataDescription const& description);
+
 private:
-	struct CreateClusterReturnData
-    {
-        ClusterDescription cluster;
-        std::unordered_map<int, int> cellTOIndexToCellDescIndex;
-	};
-    CreateClusterReturnData scanAndCreateClusterDescription(
+    //returns the mapping of cell indices in dataTO to cell indices in cluster
+    std::unordered_map<int, int> scanAndCreateClusterDescription(
         DataAccessTO const& dataTO,
         int startCellIndex,
-        std::unordered_set<int>& freeCellIndices) const;
-    CellDescription createCellDescription(DataAccessTO const& dataTO, int cellIndex) const;
+        std::unordered_set<int>& freeCellIndices,
+        ClusterDescription& cluster) const;
+    void createCellDescription(DataAccessTO const& dataTO, int cellIndex, CellDescription& result) const;
+    void addColumnarCell(
+        ColumnarDataDescription& result,
+        DataAccessTO const& dataTO,
+        int cellIndex,
+        std::vector<int> const& tokenOffsets,
+        std::vector<int> const& sortedTokenIndices) const;
 
 	void addCell(
         DataAccessTO const& dataTO,
@@ -42,7 +51,8 @@ private:
         CellChangeDescription const& cellToAdd,
         unordered_map<uint64_t, int> const& cellIndexByIds);
 
-    int convertStringAndReturnStringIndex(DataAccessTO const& dataTO, std::string const& s);
+    int convertStringAndReturnStringIndex(DataAccessTO const& dataTO, std::string_view s);
+    int convertStringAndReturnStringIndex(DataAccessTO const& dataTO, char const* data, int len);
 
 private:
 	SimulationParameters _parameters;
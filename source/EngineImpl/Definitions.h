@@ -7,3 +7,6 @@ using SimulationController = boost::shared_ptr<_SimulationController>;
 
 class _AccessDataTOCache;
 using AccessDataTOCache = boost::shared_ptr<_AccessDataTOCache>;
+
+class _HostStageExecutor;
+using HostStageExecutor = boost::shared_ptr<_HostStageExecutor>;
@@ -2,16 +2,26 @@
 
 #include <chrono>
 
+#include "Base/Tracing.h"
 #include "EngineGpuKernels/AccessTOs.cuh"
 #include "EngineInterface/ChangeDescriptions.h"
 #include "AccessDataTOCache.h"
 #include "DataConverter.h"
+#include "HostStageExecutor.h"
 
 namespace
 {
     std::chrono::milliseconds const FrameTimeout(30);
     std::chrono::milliseconds const MonitorUpdate(30);
 
+    void checkCanceled(bool shutdown, AsyncOperationState const& state)
+    {
+        if (shutdown) {
+            throw AsyncOperationCanceledException();
+        }
+        state.checkCanceled();
+    }
+
     class CudaAccess
     {
     public:
@@ -20,12 +30,24 @@ namespace
             std::condition_variable& conditionForWorkerLoop,
             std::atomic<bool>& accessFlag,
             std::atomic<bool> const& isSimulationRunning,
+            std::timed_mutex& mutexForDirectAccess,
             ExceptionData const& exceptionData,
             boost::optional<std::chrono::milliseconds> const& maxDuration = boost::none)
             : _accessFlag(accessFlag)
             , _conditionForWorkerLoop(conditionForWorkerLoop)
+            , _directAccessLock(mutexForDirectAccess, std::defer_lock)
         {
+            TRACE_SCOPE("EngineWorker", "wait for access");
             if (!isSimulationRunning.load()) {
+
+                //worker thread may still process queued jobs => wait until it is finished
+                if (!_directAccessLock.try_lock_for(maxDuration.value_or(std::chrono::milliseconds(5000)))) {
+                    if (maxDuration) {
+                        _isTimeout = true;
+                        return;
+                    }
+                    throw std::runtime_error("GPU Timeout");
+                }
                 return;
             }
             std::mutex mutex;
@@ -64,6 +86,7 @@ namespace
 
         std::atomic<bool>& _accessFlag;
         std::condition_variable& _conditionForWorkerLoop;
+        std::unique_lock<std::timed_mutex> _directAccessLock;
 
         bool _isTimeout = false;
     };
@@ -76,10 +99,17 @@ void EngineWorker::initCuda()
 
 void EngineWorker::newSimulation(uint64_t timestep, Settings const& settings, GpuSettings const& gpuSettings)
 {
-    _settings = settings;
     _gpuConstants = gpuSettings;
     _dataTOCache = boost::make_shared<_AccessDataTOCache>(gpuSettings);
+    _hostStageExecutor = boost::make_shared<_HostStageExecutor>(_isHostStagePipelining.load());
     _cudaSimulation = boost::make_shared<_CudaSimulation>(timestep, settings, gpuSettings);
+    {
+        std::unique_lock<std::mutex> uniqueLock(_mutexForAsyncJobs);
+        _simulationParametersUpload.reset(settings.simulationParameters);
+        _simulationParametersSpotsUpload.reset(settings.simulationParametersSpots);
+        _flowFieldSettingsUpload.reset(settings.flowFieldSettings);
+        _parameterSchedules = ParameterSchedules();
+    }
 
     if (_imageResourceToRegister) {
         _cudaResource = _cudaSimulation->registerImageResource(*_imageResourceToRegister);
@@ -89,8 +119,14 @@ void EngineWorker::newSimulation(uint64_t timestep, Settings const& settings, Gp
 
 void EngineWorker::clear()
 {
+    TRACE_SCOPE("EngineWorker", "clear");
     CudaAccess access(
-        _conditionForAccess, _conditionForWorkerLoop, _requireAccess, _isSimulationRunning, _exceptionData);
+        _conditionForAccess,
+        _conditionForWorkerLoop,
+        _requireAccess,
+        _isSimulationRunning,
+        _mutexForDirectAccess,
+        _exceptionData);
     return _cudaSimulation->clear();
 }
 
@@ -103,7 +139,12 @@ void EngineWorker::registerImageResource(GLuint image)
     } else {
 
         CudaAccess access(
-            _conditionForAccess, _conditionForWorkerLoop, _requireAccess, _isSimulationRunning, _exceptionData);
+            _conditionForAccess,
+            _conditionForWorkerLoop,
+            _requireAccess,
+            _isSimulationRunning,
+            _mutexForDirectAccess,
+            _exceptionData);
 
         _cudaResource = _cudaSimulation->registerImageResource(image);
     }
@@ -115,11 +156,13 @@ void EngineWorker::tryDrawVectorGraphics(
     IntVector2D const& imageSize,
     double zoom)
 {
+    TRACE_SCOPE("EngineWorker", "draw vector graphics");
     CudaAccess access(
         _conditionForAccess,
         _conditionForWorkerLoop,
         _requireAccess,
         _isSimulationRunning,
+        _mutexForDirectAccess,
         _exceptionData,
         FrameTimeout);
 
@@ -139,15 +182,23 @@ boost::optional<OverlayDescription> EngineWorker::tryDrawVectorGraphicsAndReturn
     IntVector2D const& imageSize,
     double zoom)
 {
-    CudaAccess access(
-        _conditionForAccess,
-        _conditionForWorkerLoop,
-        _requireAccess,
-        _isSimulationRunning,
-        _exceptionData,
-        FrameTimeout);
+    TRACE_SCOPE("EngineWorker", "draw vector graphics and overlay");
+    DataAccessTO dataTO;
+    boost::optional<DataConverter> converter;
+    {
+        CudaAccess access(
+            _conditionForAccess,
+            _conditionForWorkerLoop,
+            _requireAccess,
+            _isSimulationRunning,
+            _mutexForDirectAccess,
+            _exceptionData,
+            FrameTimeout);
+        if (access.isTimeout()) {
+            return boost::none;
+        }
+        converter = createDataConverter();
 
-    if (!access.isTimeout()) {
         _cudaSimulation->drawVectorGraphics(
             {rectUpperLeft.x, rectUpperLeft.y},
             {rectLowerRight.x, rectLowerRight.y},
@@ -156,40 +207,81 @@ boost::optional<OverlayDescription> EngineWorker::tryDrawVectorGraphicsAndReturn
             zoom);
 
         auto arraySizes = _cudaSimulation->getArraySizes();
-        DataAccessTO dataTO = _dataTOCache->getDataTO(
+        dataTO = _dataTOCache->getDataTO(
             {arraySizes.cellArraySize, arraySizes.particleArraySize, arraySizes.tokenArraySize});
 
         _cudaSimulation->getOverlayData(
             {toInt(rectUpperLeft.x), toInt(rectUpperLeft.y)},
             int2{toInt(rectLowerRight.x), toInt(rectLowerRight.y)},
             dataTO);
+    }
 
-        DataConverter converter(_settings.simulationParameters, _gpuConstants);
-        auto result = converter.convertAccessTOtoOverlayDescription(dataTO);
-        _dataTOCache->releaseDataTO(dataTO);
+    //worker thread can already continue while the overlay is converted
+    auto result = converter->convertAccessTOtoOverlayDescription(dataTO);
+    _dataTOCache->releaseDataTO(dataTO);
 
-        return result;
-    }
-    return boost::none;
+    return result;
 }
 
 DataDescription EngineWorker::getSimulationData(IntVector2D const& rectUpperLeft, IntVector2D const& rectLowerRight)
 {
-    CudaAccess access(
-        _conditionForAccess, _conditionForWorkerLoop, _requireAccess, _isSimulationRunning, _exceptionData);
-
-    auto arraySizes = _cudaSimulation->getArraySizes();
-    DataAccessTO dataTO =
-        _dataTOCache->getDataTO({arraySizes.cellArraySize, arraySizes.particleArraySize, arraySizes.tokenArraySize});
-    _cudaSimulation->getSimulationData(
-        {rectUpperLeft.x, rectUpperLeft.y}, int2{rectLowerRight.x, rectLowerRight.y}, dataTO);
-
-    DataConverter converter(_settings.simulationParameters, _gpuConstants);
+    DataDescription result;
+    getSimulationData(rectUpperLeft, rectLowerRight, result);
+    return result;
+}
 
-    auto result = converter.convertAccessTOtoDataDescription(dataTO);
+void EngineWorker::getSimulationData(
+    IntVector2D const& rectUpperLeft,
+    IntVector2D const& rectLowerRight,
+    DataDescription& result)
+{
+    TRACE_SCOPE("EngineWorker", "get simulation data");
+    DataAccessTO dataTO;
+    auto converter = createDataConverter();
+    {
+        CudaAccess access(
+            _conditionForAccess,
+            _conditionForWorkerLoop,
+            _requireAccess,
+            _isSimulationRunning,
+            _mutexForDirectAccess,
+            _exceptionData);
+        dataTO = readSimulationData(rectUpperLeft, rectLowerRight);
+    }
+    converter.convertAccessTOtoDataDescription(dataTO, result);
     _dataTOCache->releaseDataTO(dataTO);
+}
 
-    return result;
+AsyncOperation<DataDescription> EngineWorker::getSimulationData_async(
+    IntVector2D const& rectUpperLeft,
+    IntVector2D const& rectLowerRight)
+{
+    auto promise = boost::make_shared<std::promise<DataDescription>>();
+    auto state = boost::make_shared<AsyncOperationState>();
+    enqueueDataJob({[] { return true; }, [=](bool shutdown) {
+                        TRACE_SCOPE("EngineWorker", "get simulation data async");
+                        try {
+                            checkCanceled(shutdown, *state);
+                            auto dataTO = readSimulationData(rectUpperLeft, rectLowerRight);
+                            state->progress.store(0.5f);
+
+                            //conversion runs while the worker thread calculates the next time step
+                            auto converter = createDataConverter();
+                            _hostStageExecutor->execute([=]() mutable {
+                                try {
+                                    state->checkCanceled();
+                                    promise->set_value(converter.convertAccessTOtoDataDescription(dataTO));
+                                    state->progress.store(1.0f);
+                                } catch (...) {
+                                    promise->set_exception(std::current_exception());
+                                }
+                                _dataTOCache->releaseDataTO(dataTO);
+                            });
+                        } catch (...) {
+                            promise->set_exception(std::current_exception());
+                        }
+                    }});
+    return AsyncOperation<DataDescription>(promise->get_future(), state);
 }
 
 OverallStatistics EngineWorker::getMonitorData() const
@@ -204,50 +296,156 @@ OverallStatistics EngineWorker::getMonitorData() const
     result.numSuccessfulAttacks = _numSuccessfulAttacks.load();
     result.numFailedAttacks = _numFailedAttacks.load();
     result.numMuscleActivities = _numMuscleActivities.load();
+    result.numParameterUploads = _numParameterUploads.load();
+    result.parameterUploadBytes = _parameterUploadBytes.load();
     return result;
 }
 
-void EngineWorker::setSimulationData(DataChangeDescription const& dataToUpdate)
+void EngineWorker::updateMonitorData()
 {
     CudaAccess access(
-        _conditionForAccess, _conditionForWorkerLoop, _requireAccess, _isSimulationRunning, _exceptionData);
-    int numCells = 0;
-    int numParticles = 0;
-    int numTokens = 0;
-    for (auto const& cell : dataToUpdate.cells) {
-        if (cell.isAdded()) {
-            ++numCells;
-            if (cell->tokens.getOptionalValue()) {
-                numTokens += toInt(cell->tokens.getValue().size());
-            }
-        }
+        _conditionForAccess,
+        _conditionForWorkerLoop,
+        _requireAccess,
+        _isSimulationRunning,
+        _mutexForDirectAccess,
+        _exceptionData);
+    _cudaSimulation->requestMonitorData();
+    _lastMonitorUpdate = std::chrono::steady_clock::now();
+    publishMonitorData();
+}
+
+void EngineWorker::setSimulationData(DataChangeDescription const& dataToUpdate)
+{
+    TRACE_SCOPE("EngineWorker", "set simulation data");
+    auto dataTO = prepareSimulationData(createDataConverter(), dataToUpdate);
+    {
+        CudaAccess access(
+            _conditionForAccess,
+            _conditionForWorkerLoop,
+            _requireAccess,
+            _isSimulationRunning,
+            _mutexForDirectAccess,
+            _exceptionData);
+        uploadSimulationData(dataTO);
     }
-    for (auto const& particle : dataToUpdate.particles) {
-        if (particle.isAdded()) {
-            ++numParticles;
-        }
+    _dataTOCache->releaseDataTO(dataTO);
+}
+
+ColumnarDataDescription EngineWorker::getColumnarSimulationData(
+    IntVector2D const& rectUpperLeft,
+    IntVector2D const& rectLowerRight)
+{
+    TRACE_SCOPE("EngineWorker", "get columnar simulation data");
+    DataAccessTO dataTO;
+    auto converter = createDataConverter();
+    {
+        CudaAccess access(
+            _conditionForAccess,
+            _conditionForWorkerLoop,
+            _requireAccess,
+            _isSimulationRunning,
+            _mutexForDirectAccess,
+            _exceptionData);
+        dataTO = readSimulationData(rectUpperLeft, rectLowerRight);
     }
-    _cudaSimulation->resizeArraysIfNecessary({numCells, numParticles, numTokens});
+    auto result = converter.convertAccessTOtoColumnarDataDescription(dataTO);
+    _dataTOCache->releaseDataTO(dataTO);
+    return result;
+}
 
-    auto arraySizes = _cudaSimulation->getArraySizes();
-    DataAccessTO dataTO = _dataTOCache->getDataTO(
-        {arraySizes.cellArraySize, arraySizes.particleArraySize, arraySizes.tokenArraySize});
-    int2 worldSize{_settings.generalSettings.worldSizeX, _settings.generalSettings.worldSizeY};
+void EngineWorker::addColumnarSimulationData(ColumnarDataDescription const& dataToAdd)
+{
+    TRACE_SCOPE("EngineWorker", "add columnar simulation data");
+    auto dataTO =
+        _dataTOCache->getDataTO({dataToAdd.getNumCells(), dataToAdd.getNumParticles(), dataToAdd.getNumTokens()});
+    auto converter = createDataConverter();
+    converter.convertColumnarDataDescriptionToAccessTO(dataTO, dataToAdd);
+    {
+        CudaAccess access(
+            _conditionForAccess,
+            _conditionForWorkerLoop,
+            _requireAccess,
+            _isSimulationRunning,
+            _mutexForDirectAccess,
+            _exceptionData);
+        uploadSimulationData(dataTO);
+    }
+    _dataTOCache->releaseDataTO(dataTO);
+}
 
-    DataConverter converter(_settings.simulationParameters, _gpuConstants);
-    converter.convertDataDescriptionToAccessTO(dataTO, dataToUpdate);
+AsyncOperation<void> EngineWorker::setSimulationData_async(DataChangeDescription const& dataToUpdate)
+{
+    auto data = boost::make_shared<DataChangeDescription>(dataToUpdate);
+    return setSimulationDataIntern_async(
+        [=](DataConverter const& converter) { return prepareSimulationData(converter, *data); });
+}
 
-    _dataTOCache->releaseDataTO(dataTO);
+AsyncOperation<void> EngineWorker::setSimulationData_async(
+    DataDescription data,
+    std::function<void(DataDescription&)> const& preprocessing)
+{
+    auto description = boost::make_shared<DataDescription>(std::move(data));
+    return setSimulationDataIntern_async([=](DataConverter const& converter) {
+        preprocessing(*description);
+        return prepareSimulationData(converter, DataChangeDescription(*description));
+    });
+}
 
-    _cudaSimulation->setSimulationData(dataTO);
-    updateMonitorDataIntern();
+AsyncOperation<void> EngineWorker::setSimulationDataIntern_async(
+    std::function<DataAccessTO(DataConverter const&)> const& prepare)
+{
+    auto promise = boost::make_shared<std::promise<void>>();
+    auto state = boost::make_shared<AsyncOperationState>();
+
+    //conversion runs on the helper thread, the upload is performed by the worker thread after the conversion
+    auto preparedData = boost::make_shared<std::promise<DataAccessTO>>();
+    auto preparedDataFuture = preparedData->get_future().share();
+    auto converter = createDataConverter();
+    _hostStageExecutor->execute([=] {
+        try {
+            state->checkCanceled();
+            preparedData->set_value(prepare(converter));
+            state->progress.store(0.5f);
+        } catch (...) {
+            preparedData->set_exception(std::current_exception());
+        }
+        notifyWorkerLoop();
+    });
+
+    enqueueDataJob(
+        {[=] { return preparedDataFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready; },
+         [=](bool shutdown) {
+             TRACE_SCOPE("EngineWorker", "set simulation data async");
+             boost::optional<DataAccessTO> dataTO;
+             try {
+                 dataTO = preparedDataFuture.get();
+                 checkCanceled(shutdown, *state);
+                 uploadSimulationData(*dataTO);
+                 promise->set_value();
+                 state->progress.store(1.0f);
+             } catch (...) {
+                 promise->set_exception(std::current_exception());
+             }
+             if (dataTO) {
+                 _dataTOCache->releaseDataTO(*dataTO);
+             }
+         }});
+    return AsyncOperation<void>(promise->get_future(), state);
 }
 
 void EngineWorker::calcSingleTimestep()
 {
+    TRACE_SCOPE("EngineWorker", "calc single time step");
     CudaAccess access(
-        _conditionForAccess, _conditionForWorkerLoop, _requireAccess, _isSimulationRunning, _exceptionData);
+        _conditionForAccess,
+        _conditionForWorkerLoop,
+        _requireAccess,
+        _isSimulationRunning,
+        _mutexForDirectAccess,
+        _exceptionData);
 
+    applyParameterSchedules();
     _cudaSimulation->calcCudaTimestep();
     updateMonitorDataIntern();
 }
@@ -255,7 +453,7 @@ void EngineWorker::calcSingleTimestep()
 void EngineWorker::beginShutdown()
 {
     _isShutdown.store(true);
-    _conditionForWorkerLoop.notify_all();
+    notifyWorkerLoop();
 }
 
 void EngineWorker::endShutdown()
@@ -264,6 +462,19 @@ void EngineWorker::endShutdown()
     _isShutdown = false;
     _requireAccess = false;
 
+    //pending host stages are finished first since queued data jobs may wait for them
+    _hostStageExecutor.reset();
+
+    //worker thread is terminated => remaining jobs will not be executed anymore
+    std::deque<DataJob> dataJobs;
+    {
+        std::unique_lock<std::mutex> uniqueLock(_mutexForAsyncJobs);
+        std::swap(dataJobs, _dataJobs);
+    }
+    for (auto const& dataJob : dataJobs) {
+        dataJob.execute(true);
+    }
+
     _cudaSimulation.reset();
 }
 
@@ -278,6 +489,11 @@ void EngineWorker::setTpsRestriction(int value)
     _tpsRestriction.store(value);
 }
 
+void EngineWorker::setHostStagePipelining(bool value)
+{
+    _isHostStagePipelining.store(value);
+}
+
 float EngineWorker::getTps() const
 {
     return _tps.load();
@@ -291,7 +507,12 @@ uint64_t EngineWorker::getCurrentTimestep() const
 void EngineWorker::setCurrentTimestep(uint64_t value)
 {
     CudaAccess access(
-        _conditionForAccess, _conditionForWorkerLoop, _requireAccess, _isSimulationRunning, _exceptionData);
+        _conditionForAccess,
+        _conditionForWorkerLoop,
+        _requireAccess,
+        _isSimulationRunning,
+        _mutexForDirectAccess,
+        _exceptionData);
     _cudaSimulation->setCurrentTimestep(value);
 }
 
@@ -299,7 +520,9 @@ void EngineWorker::setSimulationParameters_async(SimulationParameters const& par
 {
     {
         std::unique_lock<std::mutex> uniqueLock(_mutexForAsyncJobs);
-        _updateSimulationParametersJob = parameters;
+        if (!_simulationParametersUpload.set(parameters)) {
+            return;
+        }
     }
     _conditionForWorkerLoop.notify_all();
 }
@@ -308,7 +531,9 @@ void EngineWorker::setSimulationParametersSpots_async(SimulationParametersSpots
 {
     {
         std::unique_lock<std::mutex> uniqueLock(_mutexForAsyncJobs);
-        _updateSimulationParametersSpotsJob = spots;
+        if (!_simulationParametersSpotsUpload.set(spots)) {
+            return;
+        }
     }
     _conditionForWorkerLoop.notify_all();
 }
@@ -326,7 +551,18 @@ void EngineWorker::setFlowFieldSettings_async(FlowFieldSettings const& flowField
 {
     {
         std::unique_lock<std::mutex> uniqueLock(_mutexForAsyncJobs);
-        _flowFieldSettings = flowFieldSettings;
+        if (!_flowFieldSettingsUpload.set(flowFieldSettings)) {
+            return;
+        }
+    }
+    _conditionForWorkerLoop.notify_all();
+}
+
+void EngineWorker::setParameterSchedules_async(ParameterSchedules const& schedules)
+{
+    {
+        std::unique_lock<std::mutex> uniqueLock(_mutexForAsyncJobs);
+        _parameterSchedules = schedules;
     }
     _conditionForWorkerLoop.notify_all();
 }
@@ -347,49 +583,96 @@ void EngineWorker::applyForce_async(
 void EngineWorker::switchSelection(RealVector2D const& pos, float radius)
 {
     CudaAccess access(
-        _conditionForAccess, _conditionForWorkerLoop, _requireAccess, _isSimulationRunning, _exceptionData);
+        _conditionForAccess,
+        _conditionForWorkerLoop,
+        _requireAccess,
+        _isSimulationRunning,
+        _mutexForDirectAccess,
+        _exceptionData);
     _cudaSimulation->switchSelection(SwitchSelectionData{{pos.x, pos.y}, radius});
 }
 
 SelectionShallowData EngineWorker::getSelectionShallowData()
 {
+    TRACE_SCOPE("EngineWorker", "get selection shallow data");
     CudaAccess access(
-        _conditionForAccess, _conditionForWorkerLoop, _requireAccess, _isSimulationRunning, _exceptionData);
+        _conditionForAccess,
+        _conditionForWorkerLoop,
+        _requireAccess,
+        _isSimulationRunning,
+        _mutexForDirectAccess,
+        _exceptionData);
     return _cudaSimulation->getSelectionShallowData();
 }
 
+AsyncOperation<SelectionShallowData> EngineWorker::getSelectionShallowData_async()
+{
+    auto promise = boost::make_shared<std::promise<SelectionShallowData>>();
+    auto state = boost::make_shared<AsyncOperationState>();
+    enqueueDataJob({[] { return true; }, [=](bool shutdown) {
+                        TRACE_SCOPE("EngineWorker", "get selection shallow data async");
+                        try {
+                            checkCanceled(shutdown, *state);
+                            promise->set_value(_cudaSimulation->getSelectionShallowData());
+                            state->progress.store(1.0f);
+                        } catch (...) {
+                            promise->set_exception(std::current_exception());
+                        }
+                    }});
+    return AsyncOperation<SelectionShallowData>(promise->get_future(), state);
+}
+
 void EngineWorker::setSelection(RealVector2D const& startPos, RealVector2D const& endPos)
 {
     CudaAccess access(
-        _conditionForAccess, _conditionForWorkerLoop, _requireAccess, _isSimulationRunning, _exceptionData);
+        _conditionForAccess,
+        _conditionForWorkerLoop,
+        _requireAccess,
+        _isSimulationRunning,
+        _mutexForDirectAccess,
+        _exceptionData);
     _cudaSimulation->setSelection(SetSelectionData{{startPos.x, startPos.y}, {endPos.x, endPos.y}});
 }
 
 void EngineWorker::shallowUpdateSelection(ShallowUpdateSelectionData const& updateData)
 {
+    TRACE_SCOPE("EngineWorker", "shallow update selection");
     CudaAccess access(
-        _conditionForAccess, _conditionForWorkerLoop, _requireAccess, _isSimulationRunning, _exceptionData);
+        _conditionForAccess,
+        _conditionForWorkerLoop,
+        _requireAccess,
+        _isSimulationRunning,
+        _mutexForDirectAccess,
+        _exceptionData);
     _cudaSimulation->shallowUpdateSelection(updateData);
 }
 
 void EngineWorker::removeSelection()
 {
     CudaAccess access(
-        _conditionForAccess, _conditionForWorkerLoop, _requireAccess, _isSimulationRunning, _exceptionData);
+        _conditionForAccess,
+        _conditionForWorkerLoop,
+        _requireAccess,
+        _isSimulationRunning,
+        _mutexForDirectAccess,
+        _exceptionData);
     _cudaSimulation->removeSelection();
 }
 
 void EngineWorker::runThreadLoop()
 {
+    TracingService::getInstance().setThreadName("Engine worker");
     try {
-        std::unique_lock<std::mutex> uniqueLock(_mutexForLoop);
         boost::optional<std::chrono::steady_clock::time_point> startTimestepTime;
         while (true) {
-            if (!_isSimulationRunning.load()) {
+            {
+                std::unique_lock<std::mutex> asyncJobsLock(_mutexForAsyncJobs);
+                if (!isWakeUpRequired()) {
 
-                //sleep...
-                _tps.store(0);
-                _conditionForWorkerLoop.wait(uniqueLock);
+                    //sleep...
+                    _tps.store(0);
+                    _conditionForWorkerLoop.wait(asyncJobsLock, [this] { return isWakeUpRequired(); });
+                }
             }
             if (_isShutdown.load()) {
                 return;
@@ -398,6 +681,8 @@ void EngineWorker::runThreadLoop()
                 _conditionForAccess.notify_all();
             }
 
+            //callers accessing the simulation directly while it is paused have to wait
+            std::unique_lock<std::timed_mutex> directAccessLock(_mutexForDirectAccess);
             if (_isSimulationRunning.load()) {
                 if (startTimestepTime && _tpsRestriction.load() > 0) {
                     long long int actualDuration, desiredDuration;
@@ -431,7 +716,11 @@ void EngineWorker::runThreadLoop()
                 }
 
                 startTimestepTime = std::chrono::steady_clock::now();
-                _cudaSimulation->calcCudaTimestep();
+                applyParameterSchedules();
+                {
+                    TRACE_SCOPE("EngineWorker", "calc time step");
+                    _cudaSimulation->calcCudaTimestep();
+                }
                 updateMonitorDataIntern();
                 ++_timestepsSinceTimepoint;
             }
@@ -446,13 +735,13 @@ void EngineWorker::runThreadLoop()
 void EngineWorker::runSimulation()
 {
     _isSimulationRunning.store(true);
-    _conditionForWorkerLoop.notify_all();
+    notifyWorkerLoop();
 }
 
 void EngineWorker::pauseSimulation()
 {
     _isSimulationRunning.store(false);
-    _conditionForWorkerLoop.notify_all();
+    notifyWorkerLoop();
 }
 
 bool EngineWorker::isSimulationRunning() const
@@ -460,45 +749,55 @@ bool EngineWorker::isSimulationRunning() const
     return _isSimulationRunning.load();
 }
 
-void EngineWorker::updateMonitorDataIntern()
+void EngineWorker::updateMonitorDataIntern(bool afterMinDuration)
 {
     auto now = std::chrono::steady_clock::now();
-    if (!_lastMonitorUpdate || now - *_lastMonitorUpdate > MonitorUpdate) {
-
-        auto data = _cudaSimulation->getMonitorData();
-        _timeStep.store(data.timeStep);
-        _numCells.store(data.numCells);
-        _numParticles.store(data.numParticles);
-        _numTokens.store(data.numTokens);
-        _totalInternalEnergy.store(data.totalInternalEnergy);
-        _numCreatedCells.store(data.numCreatedCells);
-        _numSuccessfulAttacks.store(data.numSuccessfulAttacks);
-        _numFailedAttacks.store(data.numFailedAttacks);
-        _numMuscleActivities.store(data.numMuscleActivities);
+    if (!afterMinDuration || !_lastMonitorUpdate || now - *_lastMonitorUpdate > MonitorUpdate) {
+        TRACE_SCOPE("EngineWorker", "request monitor data");
 
+        //consistency point: the monitor data is gathered between two time steps, its transfer to the host and the
+        //publishing overlap with the next time step
+        _cudaSimulation->requestMonitorData();
         _lastMonitorUpdate = now;
+        _hostStageExecutor->execute([this] {
+            try {
+                publishMonitorData();
+            } catch (std::exception const& e) {
+                std::unique_lock<std::mutex> uniqueLock(_exceptionData.mutex);
+                _exceptionData.errorMessage = e.what();
+            }
+        });
     }
 }
 
+void EngineWorker::publishMonitorData()
+{
+    TRACE_SCOPE("EngineWorker", "publish monitor data");
+
+    //fetching and publishing is not interleaved so that older data cannot overwrite newer data
+    std::unique_lock<std::mutex> uniqueLock(_mutexForMonitorData);
+    auto data = _cudaSimulation->fetchMonitorData();
+    _timeStep.store(data.timeStep);
+    _numCells.store(data.numCells);
+    _numParticles.store(data.numParticles);
+    _numTokens.store(data.numTokens);
+    _totalInternalEnergy.store(data.totalInternalEnergy);
+    _numCreatedCells.store(data.numCreatedCells);
+    _numSuccessfulAttacks.store(data.numSuccessfulAttacks);
+    _numFailedAttacks.store(data.numFailedAttacks);
+    _numMuscleActivities.store(data.numMuscleActivities);
+}
+
 void EngineWorker::processJobs()
 {
+    TRACE_SCOPE("EngineWorker", "process jobs");
     std::unique_lock<std::mutex> asyncJobsLock(_mutexForAsyncJobs);
-    if (_updateSimulationParametersJob) {
-        _cudaSimulation->setSimulationParameters(*_updateSimulationParametersJob);
-        _updateSimulationParametersJob = boost::none;
-    }
-    if (_updateSimulationParametersSpotsJob) {
-        _cudaSimulation->setSimulationParametersSpots(*_updateSimulationParametersSpotsJob);
-        _updateSimulationParametersSpotsJob = boost::none;
-    }
+    uploadChangedSettings();
     if (_updateGpuSettingsJob) {
         _cudaSimulation->setGpuConstants(*_updateGpuSettingsJob);
+        _gpuConstants = *_updateGpuSettingsJob;
         _updateGpuSettingsJob = boost::none;
     }
-    if (_flowFieldSettings) {
-        _cudaSimulation->setFlowFieldSettings(*_flowFieldSettings);
-        _flowFieldSettings = boost::none;
-    }
     if (!_applyForceJobs.empty()) {
         for (auto const& applyForceJob : _applyForceJobs) {
             _cudaSimulation->applyForce(
@@ -510,4 +809,138 @@ void EngineWorker::processJobs()
         }
         _applyForceJobs.clear();
     }
+
+    //data jobs are executed in order of submission as soon as their host stages are completed
+    //they may take long and should not block callers which only want to enqueue further jobs
+    std::vector<DataJob> dataJobs;
+    while (!_dataJobs.empty() && _dataJobs.front().isReady()) {
+        dataJobs.emplace_back(std::move(_dataJobs.front()));
+        _dataJobs.pop_front();
+    }
+    asyncJobsLock.unlock();
+    for (auto const& dataJob : dataJobs) {
+        dataJob.execute(false);
+    }
+}
+
+void EngineWorker::applyParameterSchedules()
+{
+    std::unique_lock<std::mutex> asyncJobsLock(_mutexForAsyncJobs);
+    if (_parameterSchedules.isEmpty()) {
+        return;
+    }
+    TRACE_SCOPE("EngineWorker", "apply parameter schedules");
+
+    //values for the upcoming time step, unchanged values are not uploaded
+    Settings settings = Settings();
+    settings.simulationParameters = _simulationParametersUpload.getLatestValue();
+    settings.simulationParametersSpots = _simulationParametersSpotsUpload.getLatestValue();
+    settings.flowFieldSettings = _flowFieldSettingsUpload.getLatestValue();
+    _parameterSchedules.apply(_cudaSimulation->getCurrentTimestep(), settings);
+    _simulationParametersUpload.set(settings.simulationParameters);
+    _simulationParametersSpotsUpload.set(settings.simulationParametersSpots);
+    _flowFieldSettingsUpload.set(settings.flowFieldSettings);
+    uploadChangedSettings();
+}
+
+void EngineWorker::uploadChangedSettings()
+{
+    if (_simulationParametersUpload.hasPendingValue()) {
+        auto ranges = _simulationParametersUpload.fetch();
+        _cudaSimulation->setSimulationParameters(_simulationParametersUpload.getUploadedValue(), ranges);
+        countParameterUploads(ranges);
+    }
+    if (_simulationParametersSpotsUpload.hasPendingValue()) {
+        auto ranges = _simulationParametersSpotsUpload.fetch();
+        _cudaSimulation->setSimulationParametersSpots(_simulationParametersSpotsUpload.getUploadedValue(), ranges);
+        countParameterUploads(ranges);
+    }
+    if (_flowFieldSettingsUpload.hasPendingValue()) {
+        auto ranges = _flowFieldSettingsUpload.fetch();
+        _cudaSimulation->setFlowFieldSettings(_flowFieldSettingsUpload.getUploadedValue(), ranges);
+        countParameterUploads(ranges);
+    }
+}
+
+void EngineWorker::countParameterUploads(std::vector<ByteRange> const& ranges)
+{
+    uint64_t bytes = 0;
+    for (auto const& range : ranges) {
+        bytes += range.size;
+    }
+    _numParameterUploads.fetch_add(ranges.size());
+    _parameterUploadBytes.fetch_add(bytes);
+}
+
+bool EngineWorker::isWakeUpRequired() const
+{
+    if (_isSimulationRunning.load() || _isShutdown.load() || _requireAccess.load()) {
+        return true;
+    }
+    return (!_dataJobs.empty() && _dataJobs.front().isReady()) || _simulationParametersUpload.hasPendingValue()
+        || _simulationParametersSpotsUpload.hasPendingValue() || _flowFieldSettingsUpload.hasPendingValue()
+        || _updateGpuSettingsJob || !_applyForceJobs.empty();
+}
+
+void EngineWorker::notifyWorkerLoop()
+{
+    //the worker thread evaluates its wake-up condition under this lock, hence it either sees the new state or is
+    //already waiting when notified
+    {
+        std::unique_lock<std::mutex> uniqueLock(_mutexForAsyncJobs);
+    }
+    _conditionForWorkerLoop.notify_all();
+}
+
+void EngineWorker::enqueueDataJob(DataJob const& job)
+{
+    {
+        std::unique_lock<std::mutex> uniqueLock(_mutexForAsyncJobs);
+        _dataJobs.emplace_back(job);
+    }
+    _conditionForWorkerLoop.notify_all();
+}
+
+DataAccessTO EngineWorker::readSimulationData(IntVector2D const& rectUpperLeft, IntVector2D const& rectLowerRight)
+{
+    auto arraySizes = _cudaSimulation->getArraySizes();
+    DataAccessTO result =
+        _dataTOCache->getDataTO({arraySizes.cellArraySize, arraySizes.particleArraySize, arraySizes.tokenArraySize});
+    _cudaSimulation->getSimulationData(
+        {rectUpperLeft.x, rectUpperLeft.y}, int2{rectLowerRight.x, rectLowerRight.y}, result);
+    return result;
+}
+
+DataConverter EngineWorker::createDataConverter() const
+{
+    std::unique_lock<std::mutex> uniqueLock(_mutexForAsyncJobs);
+    return DataConverter(_simulationParametersUpload.getUploadedValue(), _gpuConstants);
+}
+
+DataAccessTO EngineWorker::prepareSimulationData(DataConverter converter, DataChangeDescription const& dataToUpdate)
+{
+    int numCells = 0;
+    int numParticles = 0;
+    int numTokens = 0;
+    for (auto const& cell : dataToUpdate.cells) {
+        if (cell.isAdded()) {
+            ++numCells;
+            numTokens += toInt(cell->tokens.size());
+        }
+    }
+    for (auto const& particle : dataToUpdate.particles) {
+        if (particle.isAdded()) {
+            ++numParticles;
+        }
+    }
+    auto result = _dataTOCache->getDataTO({numCells, numParticles, numTokens});
+    converter.convertDataDescriptionToAccessTO(result, dataToUpdate);
+    return result;
+}
+
+void EngineWorker::uploadSimulationData(DataAccessTO const& dataTO)
+{
+    _cudaSimulation->resizeArraysIfNecessary({*dataTO.numCells, *dataTO.numParticles, *dataTO.numTokens});
+    _cudaSimulation->setSimulationData(dataTO);
+    updateMonitorDataIntern();
 }
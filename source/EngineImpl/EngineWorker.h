@@ -1,6 +1,8 @@
 #pragma once
 
 #include <atomic>
+#include <deque>
+#include <functional>
 #include <mutex>
 #include <condition_variable>
 
@@ -12,20 +14,27 @@
 
 #include "Base/Definitions.h"
 
+#include "EngineInterface/AsyncOperation.h"
 #include "EngineInterface/Definitions.h"
 #include "EngineInterface/SimulationParameters.h"
 #include "EngineInterface/GpuSettings.h"
 #include "EngineInterface/OverallStatistics.h"
 #include "EngineInterface/OverlayDescriptions.h"
+#include "EngineInterface/ParameterSchedule.h"
+#include "EngineInterface/ColumnarDescriptions.h"
 #include "EngineInterface/FlowFieldSettings.h"
 #include "EngineInterface/Settings.h"
 #include "EngineInterface/SelectionShallowData.h"
 #include "EngineInterface/ShallowUpdateSelectionData.h"
 #include "EngineGpuKernels/Definitions.h"
 
+#include "CoalescedUpload.h"
 #include "Definitions.h"
 #include "DllExport.h"
 
+struct DataAccessTO;
+class DataConverter;
+
 struct ExceptionData
 {
     mutable std::mutex mutex;
@@ -54,10 +63,27 @@ public:
         double zoom);
 
     DataDescription getSimulationData(IntVector2D const& rectUpperLeft, IntVector2D const& rectLowerRight);
+    void getSimulationData(IntVector2D const& rectUpperLeft, IntVector2D const& rectLowerRight, DataDescription& result);
     OverallStatistics getMonitorData() const;
+    void updateMonitorData();
 
     void setSimulationData(DataChangeDescription const& dataToUpdate);
 
+    ColumnarDataDescription getColumnarSimulationData(
+        IntVector2D const& rectUpperLeft,
+        IntVector2D const& rectLowerRight);
+    void addColumnarSimulationData(ColumnarDataDescription const& dataToAdd);
+
+    //queued behind the current time step and executed by the worker thread
+    AsyncOperation<DataDescription> getSimulationData_async(
+        IntVector2D const& rectUpperLeft,
+        IntVector2D const& rectLowerRight);
+    AsyncOperation<void> setSimulationData_async(DataChangeDescription const& dataToUpdate);
+    AsyncOperation<void> setSimulationData_async(
+        DataDescription data,
+        std::function<void(DataDescription&)> const& preprocessing);
+    AsyncOperation<SelectionShallowData> getSelectionShallowData_async();
+
     void calcSingleTimestep();
 
     void beginShutdown(); //caller should wait for termination of thread
@@ -65,6 +91,7 @@ public:
 
     int getTpsRestriction() const;
     void setTpsRestriction(int value);
+    void setHostStagePipelining(bool value);  //takes effect with the next simulation
 
     float getTps() const;
     uint64_t getCurrentTimestep() const;
@@ -74,6 +101,7 @@ public:
     void setSimulationParametersSpots_async(SimulationParametersSpots const& spots);
     void setGpuSettings_async(GpuSettings const& gpuSettings);
     void setFlowFieldSettings_async(FlowFieldSettings const& flowFieldSettings);
+    void setParameterSchedules_async(ParameterSchedules const& schedules);
 
     void applyForce_async(RealVector2D const& start, RealVector2D const& end, RealVector2D const& force, float radius);
 
@@ -89,27 +117,50 @@ public:
     bool isSimulationRunning() const;
 
 private:
-    void updateMonitorDataIntern();
+    void updateMonitorDataIntern(bool afterMinDuration = true);
+    void publishMonitorData();
     void processJobs();
+    void applyParameterSchedules();
+    void uploadChangedSettings();  //requires lock on _mutexForAsyncJobs
+    void countParameterUploads(std::vector<ByteRange> const& ranges);
+
+    struct DataJob
+    {
+        std::function<bool()> isReady;  //false while a preceding host stage is not completed
+        std::function<void(bool shutdown)> execute;
+    };
+    bool isWakeUpRequired() const;  //requires lock on _mutexForAsyncJobs
+    void notifyWorkerLoop();  //for state changes outside of _mutexForAsyncJobs
+    void enqueueDataJob(DataJob const& job);
+
+    //GPU stages need access to the simulation, host stages can run concurrently to the next time step
+    //host stages use converters created beforehand since the settings may change in the meantime
+    DataConverter createDataConverter() const;
+    DataAccessTO readSimulationData(IntVector2D const& rectUpperLeft, IntVector2D const& rectLowerRight);
+    DataAccessTO prepareSimulationData(DataConverter converter, DataChangeDescription const& dataToUpdate);
+    void uploadSimulationData(DataAccessTO const& dataTO);
+    AsyncOperation<void> setSimulationDataIntern_async(
+        std::function<DataAccessTO(DataConverter const&)> const& prepare);
 
     CudaSimulation _cudaSimulation;
 
     //sync
-    mutable std::mutex _mutexForLoop;
-    std::condition_variable _conditionForWorkerLoop;
+    std::condition_variable _conditionForWorkerLoop;  //waited on with _mutexForAsyncJobs
     std::condition_variable _conditionForAccess;
 
     std::atomic<bool> _isSimulationRunning{false};
     std::atomic<bool> _isShutdown{false};
     std::atomic<bool> _requireAccess{false};
+    std::timed_mutex _mutexForDirectAccess;  //held by worker thread during time step and jobs
     ExceptionData _exceptionData;
 
     //async jobs
     mutable std::mutex _mutexForAsyncJobs;
-    boost::optional<SimulationParameters> _updateSimulationParametersJob;
-    boost::optional<SimulationParametersSpots> _updateSimulationParametersSpotsJob;
+    CoalescedUpload<SimulationParameters> _simulationParametersUpload;
+    CoalescedUpload<SimulationParametersSpots> _simulationParametersSpotsUpload;
     boost::optional<GpuSettings> _updateGpuSettingsJob;
-    boost::optional<FlowFieldSettings> _flowFieldSettings;
+    CoalescedUpload<FlowFieldSettings> _flowFieldSettingsUpload;
+    ParameterSchedules _parameterSchedules;
     boost::optional<GLuint> _imageResourceToRegister;
 
     struct ApplyForceJob
@@ -121,6 +172,8 @@ private:
     };
     std::vector<ApplyForceJob> _applyForceJobs;
 
+    std::deque<DataJob> _dataJobs;
+
     //time step measurements
     std::atomic<int> _tpsRestriction{0};  //0 = no restriction
     std::atomic<float> _tps;
@@ -128,10 +181,11 @@ private:
     int _timestepsSinceTimepoint = 0;
   
     //settings
-    Settings _settings;
-    GpuSettings _gpuConstants;
+    GpuSettings _gpuConstants;  //protected by _mutexForAsyncJobs while the worker thread is running
+    std::atomic<bool> _isHostStagePipelining{true};
 
     //monitor data
+    std::mutex _mutexForMonitorData;
     boost::optional<std::chrono::steady_clock::time_point> _lastMonitorUpdate;
     std::atomic<uint64_t> _timeStep{0};
     std::atomic<int> _numCells{0};
@@ -142,8 +196,11 @@ private:
     std::atomic<int> _numSuccessfulAttacks{0};
     std::atomic<int> _numFailedAttacks{0};
     std::atomic<int> _numMuscleActivities{0};
+    std::atomic<uint64_t> _numParameterUploads{0};
+    std::atomic<uint64_t> _parameterUploadBytes{0};
 
     //internals
     void* _cudaResource;
     AccessDataTOCache _dataTOCache;
+    HostStageExecutor _hostStageExecutor;
 };
\ No newline at end of file
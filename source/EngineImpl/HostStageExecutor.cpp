@@ -0,0 +1,58 @@
+#include "HostStageExecutor.h"
+
+#include "Base/Tracing.h"
+
+_HostStageExecutor::_HostStageExecutor(bool isPipelined)
+{
+    if (isPipelined) {
+        _thread = std::thread(&_HostStageExecutor::runThreadLoop, this);
+    }
+}
+
+_HostStageExecutor::~_HostStageExecutor()
+{
+    if (!_thread.joinable()) {
+        return;
+    }
+    {
+        std::unique_lock<std::mutex> uniqueLock(_mutex);
+        _isShutdown = true;
+    }
+    _condition.notify_all();
+    _thread.join();
+}
+
+void _HostStageExecutor::execute(std::function<void()> const& stage)
+{
+    if (!_thread.joinable()) {
+        TRACE_SCOPE("HostStageExecutor", "execute stage");
+        stage();
+        return;
+    }
+    {
+        std::unique_lock<std::mutex> uniqueLock(_mutex);
+        _stages.emplace_back(stage);
+    }
+    _condition.notify_all();
+}
+
+void _HostStageExecutor::runThreadLoop()
+{
+    TracingService::getInstance().setThreadName("Host stages");
+    while (true) {
+        std::function<void()> stage;
+        {
+            std::unique_lock<std::mutex> uniqueLock(_mutex);
+            _condition.wait(uniqueLock, [this] { return _isShutdown || !_stages.empty(); });
+            if (_stages.empty()) {
+                return;
+            }
+            stage = std::move(_stages.front());
+            _stages.pop_front();
+        }
+
+        //stages are responsible for forwarding their exceptions to the caller
+        TRACE_SCOPE("HostStageExecutor", "execute stage");
+        stage();
+    }
+}
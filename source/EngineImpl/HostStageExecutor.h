@@ -0,0 +1,33 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "Definitions.h"
+
+/**
+ * Helper thread for the host-side stages of engine jobs, e.g. data conversions. They run while the worker thread
+ * already calculates the next time step. Stages are executed in the order of submission.
+ * Without pipelining, stages are executed directly by the calling thread, which serves as a baseline for measurements.
+ */
+class _HostStageExecutor
+{
+public:
+    _HostStageExecutor(bool isPipelined = true);
+    ~_HostStageExecutor();  //pending stages are executed before the thread terminates
+
+    void execute(std::function<void()> const& stage);
+
+private:
+    void runThreadLoop();
+
+    std::mutex _mutex;
+    std::condition_variable _condition;
+    std::deque<std::function<void()>> _stages;
+    bool _isShutdown = false;
+
+    std::thread _thread;
+};
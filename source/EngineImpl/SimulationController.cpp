@@ -1,5 +1,6 @@
 #include "SimulationController.h"
 
+#include "Base/Tracing.h"
 #include "EngineInterface/Descriptions.h"
 
 void _SimulationController::initCuda()
@@ -12,6 +13,7 @@ void _SimulationController::newSimulation(uint64_t timestep, Settings const& set
     _settings = settings;
     _origSettings = _settings;
     _symbolMap = symbolMap;
+    _parameterSchedules = ParameterSchedules();
     _worker.newSimulation(timestep, settings, _gpuSettings);
     _origGpuSettings = _gpuSettings;
 
@@ -38,6 +40,7 @@ void _SimulationController::tryDrawVectorGraphics(
     IntVector2D const& imageSize,
     double zoom)
 {
+    TRACE_SCOPE("SimulationController", "draw vector graphics");
     _worker.tryDrawVectorGraphics(rectUpperLeft, rectLowerRight, imageSize, zoom);
 }
 
@@ -47,22 +50,71 @@ boost::optional<OverlayDescription> _SimulationController::tryDrawVectorGraphics
     IntVector2D const& imageSize,
     double zoom)
 {
+    TRACE_SCOPE("SimulationController", "draw vector graphics and overlay");
     return _worker.tryDrawVectorGraphicsAndReturnOverlay(rectUpperLeft, rectLowerRight, imageSize, zoom);
 }
 
 DataDescription _SimulationController::getSimulationData(IntVector2D const& rectUpperLeft, IntVector2D const& rectLowerRight)
 {
+    TRACE_SCOPE("SimulationController", "get simulation data");
     return _worker.getSimulationData(rectUpperLeft, rectLowerRight);
 }
 
+void _SimulationController::getSimulationData(
+    IntVector2D const& rectUpperLeft,
+    IntVector2D const& rectLowerRight,
+    DataDescription& result)
+{
+    TRACE_SCOPE("SimulationController", "get simulation data");
+    _worker.getSimulationData(rectUpperLeft, rectLowerRight, result);
+}
+
 void _SimulationController::setSimulationData(DataChangeDescription const& dataToUpdate)
 {
+    TRACE_SCOPE("SimulationController", "set simulation data");
     _worker.setSimulationData(dataToUpdate);
     _isSelectionInvalid = true;
 }
 
+ColumnarDataDescription _SimulationController::getColumnarSimulationData(
+    IntVector2D const& rectUpperLeft,
+    IntVector2D const& rectLowerRight)
+{
+    TRACE_SCOPE("SimulationController", "get columnar simulation data");
+    return _worker.getColumnarSimulationData(rectUpperLeft, rectLowerRight);
+}
+
+void _SimulationController::addColumnarSimulationData(ColumnarDataDescription const& dataToAdd)
+{
+    TRACE_SCOPE("SimulationController", "add columnar simulation data");
+    _worker.addColumnarSimulationData(dataToAdd);
+    _isSelectionInvalid = true;
+}
+
+AsyncOperation<DataDescription> _SimulationController::getSimulationData_async(
+    IntVector2D const& rectUpperLeft,
+    IntVector2D const& rectLowerRight)
+{
+    return _worker.getSimulationData_async(rectUpperLeft, rectLowerRight);
+}
+
+AsyncOperation<void> _SimulationController::setSimulationData_async(DataChangeDescription const& dataToUpdate)
+{
+    _isSelectionInvalid = true;
+    return _worker.setSimulationData_async(dataToUpdate);
+}
+
+AsyncOperation<void> _SimulationController::setSimulationData_async(
+    DataDescription data,
+    std::function<void(DataDescription&)> const& preprocessing)
+{
+    _isSelectionInvalid = true;
+    return _worker.setSimulationData_async(std::move(data), preprocessing);
+}
+
 void _SimulationController::calcSingleTimestep()
 {
+    TRACE_SCOPE("SimulationController", "calc single time step");
     _worker.calcSingleTimestep();
     _isSelectionInvalid = true;
 }
@@ -104,7 +156,7 @@ void _SimulationController::setCurrentTimestep(uint64_t value)
 
 SimulationParameters _SimulationController::getSimulationParameters() const
 {
-    return _settings.simulationParameters;
+    return getScheduledSettings().simulationParameters;
 }
 
 SimulationParameters _SimulationController::getOriginalSimulationParameters() const
@@ -112,16 +164,22 @@ SimulationParameters _SimulationController::getOriginalSimulationParameters() co
     return _origSettings.simulationParameters;
 }
 
-void _SimulationController::setSimulationParameters_async(
-    SimulationParameters const& parameters)
+void _SimulationController::setSimulationParameters_async(SimulationParameters const& parameters)
 {
-    _settings.simulationParameters = parameters;
-    _worker.setSimulationParameters_async(parameters);
+    auto settings = _settings;
+    settings.simulationParameters = parameters;
+    _parameterSchedules.copyScheduledFields(_settings, settings);  //writes to scheduled fields are ignored
+    if (_settings.simulationParameters == settings.simulationParameters) {
+        return;
+    }
+    _settings.simulationParameters = settings.simulationParameters;
+    applyParameterSchedules(settings);
+    _worker.setSimulationParameters_async(settings.simulationParameters);
 }
 
 SimulationParametersSpots _SimulationController::getSimulationParametersSpots() const
 {
-    return _settings.simulationParametersSpots;
+    return getScheduledSettings().simulationParametersSpots;
 }
 
 SimulationParametersSpots _SimulationController::getOriginalSimulationParametersSpots() const
@@ -136,8 +194,15 @@ void _SimulationController::setOriginalSimulationParametersSpot(SimulationParame
 
 void _SimulationController::setSimulationParametersSpots_async(SimulationParametersSpots const& value)
 {
-    _settings.simulationParametersSpots = value;
-    _worker.setSimulationParametersSpots_async(value);
+    auto settings = _settings;
+    settings.simulationParametersSpots = value;
+    _parameterSchedules.copyScheduledFields(_settings, settings);  //writes to scheduled fields are ignored
+    if (_settings.simulationParametersSpots == settings.simulationParametersSpots) {
+        return;
+    }
+    _settings.simulationParametersSpots = settings.simulationParametersSpots;
+    applyParameterSchedules(settings);
+    _worker.setSimulationParametersSpots_async(settings.simulationParametersSpots);
 }
 
 GpuSettings _SimulationController::getGpuSettings() const
@@ -158,7 +223,7 @@ void _SimulationController::setGpuSettings_async(GpuSettings const& gpuSettings)
 
 FlowFieldSettings _SimulationController::getFlowFieldSettings() const
 {
-    return _settings.flowFieldSettings;
+    return getScheduledSettings().flowFieldSettings;
 }
 
 FlowFieldSettings _SimulationController::getOriginalFlowFieldSettings() const
@@ -173,8 +238,27 @@ void _SimulationController::setOriginalFlowFieldCenter(FlowCenter const& value,
 
 void _SimulationController::setFlowFieldSettings_async(FlowFieldSettings const& flowFieldSettings)
 {
-    _settings.flowFieldSettings = flowFieldSettings;
-    _worker.setFlowFieldSettings_async(flowFieldSettings);
+    auto settings = _settings;
+    settings.flowFieldSettings = flowFieldSettings;
+    _parameterSchedules.copyScheduledFields(_settings, settings);  //writes to scheduled fields are ignored
+    if (_settings.flowFieldSettings == settings.flowFieldSettings) {
+        return;
+    }
+    _settings.flowFieldSettings = settings.flowFieldSettings;
+    applyParameterSchedules(settings);
+    _worker.setFlowFieldSettings_async(settings.flowFieldSettings);
+}
+
+void _SimulationController::setParameterSchedules_async(std::vector<ParameterSchedule> const& schedules)
+{
+    _parameterSchedules = ParameterSchedules(schedules);
+
+    //the GPU keeps the last scheduled values => fields which are no longer scheduled get their unscheduled values back
+    auto settings = getScheduledSettings();
+    _worker.setSimulationParameters_async(settings.simulationParameters);
+    _worker.setSimulationParametersSpots_async(settings.simulationParametersSpots);
+    _worker.setFlowFieldSettings_async(settings.flowFieldSettings);
+    _worker.setParameterSchedules_async(_parameterSchedules);
 }
 
 void _SimulationController::applyForce_async(
@@ -193,11 +277,18 @@ void _SimulationController::switchSelection(RealVector2D const& pos, float radiu
 
 SelectionShallowData _SimulationController::getSelectionShallowData()
 {
+    TRACE_SCOPE("SimulationController", "get selection shallow data");
     return _worker.getSelectionShallowData();
 }
 
+AsyncOperation<SelectionShallowData> _SimulationController::getSelectionShallowData_async()
+{
+    return _worker.getSelectionShallowData_async();
+}
+
 void _SimulationController::shallowUpdateSelection(ShallowUpdateSelectionData const& updateData)
 {
+    TRACE_SCOPE("SimulationController", "shallow update selection");
     _worker.shallowUpdateSelection(updateData);
 }
 
@@ -233,7 +324,7 @@ IntVector2D _SimulationController::getWorldSize() const
 
 Settings _SimulationController::getSettings() const
 {
-    return _settings;
+    return getScheduledSettings();
 }
 
 SymbolMap _SimulationController::getSymbolMap() const
@@ -246,6 +337,11 @@ OverallStatistics _SimulationController::getStatistics() const
     return _worker.getMonitorData();
 }
 
+void _SimulationController::updateStatistics()
+{
+    _worker.updateMonitorData();
+}
+
 boost::optional<int> _SimulationController::getTpsRestriction() const
 {
     auto result = _worker.getTpsRestriction();
@@ -257,7 +353,26 @@ void _SimulationController::setTpsRestriction(boost::optional<int> const& value)
     _worker.setTpsRestriction(value ? *value : 0);
 }
 
+void _SimulationController::setHostStagePipelining(bool value)
+{
+    _worker.setHostStagePipelining(value);
+}
+
 float _SimulationController::getTps() const
 {
     return _worker.getTps();
 }
+
+Settings _SimulationController::getScheduledSettings() const
+{
+    auto result = _settings;
+    applyParameterSchedules(result);
+    return result;
+}
+
+void _SimulationController::applyParameterSchedules(Settings& settings) const
+{
+    if (!_parameterSchedules.isEmpty()) {
+        _parameterSchedules.apply(getCurrentTimestep(), settings);
+    }
+}
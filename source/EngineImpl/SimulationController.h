@@ -8,6 +8,8 @@
 #include "EngineInterface/SelectionShallowData.h"
 #include "EngineInterface/ShallowUpdateSelectionData.h"
 #include "EngineInterface/OverlayDescriptions.h"
+#include "EngineInterface/ColumnarDescriptions.h"
+#include "EngineInterface/ParameterSchedule.h"
 #include "EngineWorker.h"
 
 #include "Definitions.h"
@@ -40,9 +42,29 @@ public:
 
     ENGINEIMPL_EXPORT DataDescription
     getSimulationData(IntVector2D const& rectUpperLeft, IntVector2D const& rectLowerRight);
+    //builds into the given description and keeps its allocator, e.g. the one of a DescriptionArena
+    ENGINEIMPL_EXPORT void
+    getSimulationData(IntVector2D const& rectUpperLeft, IntVector2D const& rectLowerRight, DataDescription& result);
 
     ENGINEIMPL_EXPORT void setSimulationData(DataChangeDescription const& dataToUpdate);
 
+    //columnar variants for large worlds, the given data is added to the simulation
+    ENGINEIMPL_EXPORT ColumnarDataDescription
+    getColumnarSimulationData(IntVector2D const& rectUpperLeft, IntVector2D const& rectLowerRight);
+    ENGINEIMPL_EXPORT void addColumnarSimulationData(ColumnarDataDescription const& dataToAdd);
+
+    /**
+     * Non-blocking variants which are executed by the worker thread after the current time step.
+     * The returned operations can be polled, canceled and report their progress.
+     */
+    ENGINEIMPL_EXPORT AsyncOperation<DataDescription>
+    getSimulationData_async(IntVector2D const& rectUpperLeft, IntVector2D const& rectLowerRight);
+    ENGINEIMPL_EXPORT AsyncOperation<void> setSimulationData_async(DataChangeDescription const& dataToUpdate);
+
+    //preprocessing runs on a helper thread before the conversion, e.g. for transformations of whole worlds
+    ENGINEIMPL_EXPORT AsyncOperation<void>
+    setSimulationData_async(DataDescription data, std::function<void(DataDescription&)> const& preprocessing);
+
     ENGINEIMPL_EXPORT void calcSingleTimestep();
     ENGINEIMPL_EXPORT void runSimulation();
     ENGINEIMPL_EXPORT void pauseSimulation();
@@ -72,11 +94,17 @@ public:
     ENGINEIMPL_EXPORT void setOriginalFlowFieldCenter(FlowCenter const& value, int index);
     ENGINEIMPL_EXPORT void setFlowFieldSettings_async(FlowFieldSettings const& flowFieldSettings);
 
+    //scheduled fields are evaluated by the worker before each time step, the getters return the scheduled values
+    //and writes to scheduled fields via the setters are ignored
+    //throws std::invalid_argument for invalid schedules, an empty vector removes all schedules
+    ENGINEIMPL_EXPORT void setParameterSchedules_async(std::vector<ParameterSchedule> const& schedules);
+
     ENGINEIMPL_EXPORT void
     applyForce_async(RealVector2D const& start, RealVector2D const& end, RealVector2D const& force, float radius);
 
     ENGINEIMPL_EXPORT void switchSelection(RealVector2D const& pos, float radius);
     ENGINEIMPL_EXPORT SelectionShallowData getSelectionShallowData();
+    ENGINEIMPL_EXPORT AsyncOperation<SelectionShallowData> getSelectionShallowData_async();
     ENGINEIMPL_EXPORT void shallowUpdateSelection(ShallowUpdateSelectionData const& updateData);
     ENGINEIMPL_EXPORT void setSelection(RealVector2D const& startPos, RealVector2D const& endPos);
     ENGINEIMPL_EXPORT void removeSelection();
@@ -87,13 +115,21 @@ public:
     ENGINEIMPL_EXPORT Settings getSettings() const;
     ENGINEIMPL_EXPORT SymbolMap getSymbolMap() const;
     ENGINEIMPL_EXPORT OverallStatistics getStatistics() const;
+    ENGINEIMPL_EXPORT void updateStatistics();  //getStatistics() is otherwise refreshed at most every 30 ms
 
     ENGINEIMPL_EXPORT boost::optional<int> getTpsRestriction() const;
     ENGINEIMPL_EXPORT void setTpsRestriction(boost::optional<int> const& value);
 
     ENGINEIMPL_EXPORT float getTps() const;
 
+    //host stages such as data conversions run concurrently to the time steps, takes effect with the next simulation
+    ENGINEIMPL_EXPORT void setHostStagePipelining(bool value);
+
 private:
+    //_settings holds the unscheduled values, scheduled fields are evaluated for the current time step
+    Settings getScheduledSettings() const;
+    void applyParameterSchedules(Settings& settings) const;
+
     bool _isSelectionInvalid = false;
 
     Settings _origSettings;
@@ -101,6 +137,7 @@ private:
     GpuSettings _gpuSettings; 
     GpuSettings _origGpuSettings;
     SymbolMap _symbolMap;
+    ParameterSchedules _parameterSchedules;
 
     EngineWorker _worker;
     std::thread* _thread = nullptr;
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <stdexcept>
+
+#include <boost/shared_ptr.hpp>
+
+class AsyncOperationCanceledException : public std::runtime_error
+{
+public:
+    AsyncOperationCanceledException()
+        : std::runtime_error("operation canceled")
+    {}
+};
+
+struct AsyncOperationState
+{
+    std::atomic<bool> canceled{false};
+    std::atomic<float> progress{0};  //between 0 and 1
+
+    void checkCanceled() const
+    {
+        if (canceled.load()) {
+            throw AsyncOperationCanceledException();
+        }
+    }
+};
+
+/**
+ * Handle for an operation which is queued behind the current time step of the engine worker.
+ * Canceling takes effect at the next checkpoint of the operation. In this case get() throws an
+ * AsyncOperationCanceledException.
+ */
+template <typename T>
+class AsyncOperation
+{
+public:
+    AsyncOperation() = default;
+    AsyncOperation(std::future<T>&& future, boost::shared_ptr<AsyncOperationState> const& state)
+        : _future(std::move(future))
+        , _state(state)
+    {}
+
+    bool isValid() const { return _future.valid(); }
+    bool isReady() const { return _future.wait_for(std::chrono::seconds(0)) == std::future_status::ready; }
+
+    //blocks until the operation is finished and rethrows its exception if any
+    T get() { return _future.get(); }
+
+    void cancel() { _state->canceled.store(true); }
+    float getProgress() const { return _state->progress.load(); }
+
+private:
+    std::future<T> _future;
+    boost::shared_ptr<AsyncOperationState> _state;
+};
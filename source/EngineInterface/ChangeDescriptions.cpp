@@ -1,14 +1,18 @@
 #include "ChangeDescriptions.h"
 
-#include <boost/range/adaptors.hpp>
+#include <cstring>
+#include <functional>
 
+#include "Base/FlatHashMap.h"
+#include "Base/Parallel.h"
+#include "Base/Tracing.h"
 
 namespace
 {
-    boost::optional<std::list<ConnectionChangeDescription>> convert(
-        std::vector<ConnectionDescription> const& connections)
+    ConnectionChangeDescriptions convert(DescriptionVector<ConnectionDescription> const& connections)
 	{
-        std::list<ConnectionChangeDescription> result;
+        ConnectionChangeDescriptions result;
+        result.reserve(connections.size());
         for (auto const& connection : connections) {
             ConnectionChangeDescription connectionChange;
             connectionChange.cellId = connection.cellId;
@@ -18,11 +22,91 @@ namespace
         }
         return result;
     }
+
+    bool isEqual(
+        DescriptionVector<ConnectionDescription> const& connections1,
+        DescriptionVector<ConnectionDescription> const& connections2)
+    {
+        if (connections1.size() != connections2.size()) {
+            return false;
+        }
+        for (int i = 0; i < connections1.size(); ++i) {
+            auto const& connection1 = connections1.at(i);
+            auto const& connection2 = connections2.at(i);
+            if (connection1.cellId != connection2.cellId || connection1.distance != connection2.distance
+                || connection1.angleFromPrevious != connection2.angleFromPrevious) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    int const MinCellsPerChunk = 4096;
+
+    class Hasher
+    {
+    public:
+        template <typename T>
+        Hasher& add(T const& value)
+        {
+            static_assert(std::is_arithmetic_v<T>);
+            uint64_t bits = 0;
+            std::memcpy(&bits, &value, sizeof(T));
+            _hash = (_hash ^ bits) * 0x100000001b3ull;
+            _hash ^= _hash >> 29;
+            return *this;
+        }
+        Hasher& add(DescriptionString const& value) { return add(std::hash<std::string_view>()(value)); }
+        Hasher& add(RealVector2D const& value) { return add(value.x).add(value.y); }
+
+        uint64_t getHash() const { return _hash; }
+
+    private:
+        uint64_t _hash = 0xcbf29ce484222325ull;
+    };
+
+    uint64_t calcHash(ClusterDescription const& cluster)
+    {
+        Hasher hasher;
+        hasher.add(cluster.id).add(cluster.cells.size());
+        for (auto const& cell : cluster.cells) {
+            hasher.add(cell.id).add(cell.pos).add(cell.vel).add(cell.energy).add(cell.maxConnections);
+            hasher.add(cell.connections.size());
+            for (auto const& connection : cell.connections) {
+                hasher.add(connection.cellId).add(connection.distance).add(connection.angleFromPrevious);
+            }
+            hasher.add(cell.tokenBlocked).add(cell.tokenBranchNumber).add(cell.tokenUsages);
+            hasher.add(cell.metadata.computerSourcecode)
+                .add(cell.metadata.name)
+                .add(cell.metadata.description)
+                .add(cell.metadata.color);
+            hasher.add(static_cast<int>(cell.cellFeature.getType()))
+                .add(cell.cellFeature.constData)
+                .add(cell.cellFeature.volatileData);
+            hasher.add(cell.tokens.size());
+            for (auto const& token : cell.tokens) {
+                hasher.add(token.energy).add(token.data);
+            }
+        }
+        return hasher.getHash();
+    }
+
+    std::vector<uint64_t> calcHashes(DescriptionVector<ClusterDescription> const& clusters)
+    {
+        std::vector<uint64_t> result(clusters.size());
+        Parallel::forEachChunk(toInt(clusters.size()), 64, [&](int, int begin, int end) {
+            for (int index = begin; index < end; ++index) {
+                result.at(index) = calcHash(clusters.at(index));
+            }
+        });
+        return result;
+    }
 }
 
 CellChangeDescription::CellChangeDescription(CellDescription const & desc)
 {
 	id = desc.id;
+    changedFields = Field::ALL;
 	pos = desc.pos;
     vel = desc.vel;
     energy = desc.energy;
@@ -36,54 +120,90 @@ CellChangeDescription::CellChangeDescription(CellDescription const & desc)
     tokenUsages = desc.tokenUsages;
 }
 
-CellChangeDescription::CellChangeDescription(CellDescription const & before, CellDescription const & after)
+CellChangeDescription::CellChangeDescription(
+    CellDescription const& before,
+    CellDescription const& after,
+    bool keepOldValues)
 {
 	id = after.id;
-	pos = ValueTracker<RealVector2D>(before.pos, after.pos);
-    vel = ValueTracker<RealVector2D>(before.vel, after.vel);
-    energy = ValueTracker<double>(before.energy, after.energy);
-	maxConnections = ValueTracker<int>(before.maxConnections, after.maxConnections);
-    connectingCells =
-        ValueTracker<std::list<ConnectionChangeDescription>>(convert(before.connections), convert(after.connections));
-    tokenBlocked = ValueTracker<bool>(before.tokenBlocked, after.tokenBlocked);
-	tokenBranchNumber = ValueTracker<int>(before.tokenBranchNumber, after.tokenBranchNumber);
-	metadata = ValueTracker<CellMetadata>(before.metadata, after.metadata);
-	cellFeatures = ValueTracker<CellFeatureDescription>(before.cellFeature, after.cellFeature);
-	tokens = ValueTracker<vector<TokenDescription>>(before.tokens, after.tokens);
-    tokenUsages = ValueTracker<int>(before.tokenUsages, after.tokenUsages);
-}
-
-bool CellChangeDescription::isEmpty() const
-{
-    return !pos && !energy && !maxConnections && !connectingCells && !tokenBlocked && !tokenBranchNumber && !metadata
-        && !cellFeatures && !tokens;
+    if (before.pos != after.pos) {
+        setPos(after.pos);
+    }
+    if (before.vel != after.vel) {
+        setVel(after.vel);
+    }
+    if (before.energy != after.energy) {
+        setEnergy(after.energy);
+    }
+    if (before.maxConnections != after.maxConnections) {
+        setMaxConnections(after.maxConnections);
+    }
+    if (!isEqual(before.connections, after.connections)) {
+        setConnectingCells(convert(after.connections));
+    }
+    if (before.tokenBlocked != after.tokenBlocked) {
+        setFlagTokenBlocked(after.tokenBlocked);
+    }
+    if (before.tokenBranchNumber != after.tokenBranchNumber) {
+        setTokenBranchNumber(after.tokenBranchNumber);
+    }
+    if (before.metadata != after.metadata) {
+        setMetadata(after.metadata);
+    }
+    if (before.cellFeature != after.cellFeature) {
+        setCellFunction(after.cellFeature);
+    }
+    if (before.tokens != after.tokens) {
+        setTokens(after.tokens);
+    }
+    if (before.tokenUsages != after.tokenUsages) {
+        setTokenUsages(after.tokenUsages);
+    }
+    if (keepOldValues && !isEmpty()) {
+        oldValues = boost::make_shared<CellDescription const>(before);
+    }
 }
 
 ParticleChangeDescription::ParticleChangeDescription(ParticleDescription const & desc)
 {
 	id = desc.id;
+    changedFields = Field::ALL;
 	pos = desc.pos;
 	vel = desc.vel;
 	energy = desc.energy;
 	metadata = desc.metadata;
 }
 
-ParticleChangeDescription::ParticleChangeDescription(ParticleDescription const & before, ParticleDescription const & after)
+ParticleChangeDescription::ParticleChangeDescription(
+    ParticleDescription const& before,
+    ParticleDescription const& after,
+    bool keepOldValues)
 {
 	id = after.id;
-	pos = ValueTracker<RealVector2D>(before.pos, after.pos);
-	vel = ValueTracker<RealVector2D>(before.vel, after.vel);
-	energy = ValueTracker<double>(before.energy, after.energy);
-	metadata = ValueTracker<ParticleMetadata>(before.metadata, after.metadata);
-}
-
-bool ParticleChangeDescription::isEmpty() const
-{
-    return !pos && !vel && !energy && !metadata;
+    if (before.pos != after.pos) {
+        setPos(after.pos);
+    }
+    if (before.vel != after.vel) {
+        setVel(after.vel);
+    }
+    if (before.energy != after.energy) {
+        setEnergy(after.energy);
+    }
+    if (before.metadata != after.metadata) {
+        setMetadata(after.metadata);
+    }
+    if (keepOldValues && !isEmpty()) {
+        oldValues = boost::make_shared<ParticleDescription const>(before);
+    }
 }
 
 DataChangeDescription::DataChangeDescription(DataDescription const & desc)
 {
+    int numCells = 0;
+    for (auto const& cluster : desc.clusters) {
+        numCells += toInt(cluster.cells.size());
+    }
+    reserve(numCells, toInt(desc.particles.size()));
     for (auto const& cluster : desc.clusters) {
         for (auto const& cell : cluster.cells) {
             addNewCell(cell);
@@ -96,65 +216,110 @@ DataChangeDescription::DataChangeDescription(DataDescription const & desc)
 
 DataChangeDescription::DataChangeDescription(DataDescription const & dataBefore, DataDescription const & dataAfter)
 {
-    std::vector<CellDescription> cellsBefore;
-    std::vector<CellDescription> cellsAfter;
-    for (auto const& cluster : dataBefore.clusters) {
-        cellsBefore.insert(cellsBefore.begin(), cluster.cells.begin(), cluster.cells.end());
+    TRACE_SCOPE("DataChangeDescription", "calc difference");
+
+    //clusters with same id and hash are considered unchanged and skipped
+    auto hashesBefore = calcHashes(dataBefore.clusters);
+    auto hashesAfter = calcHashes(dataAfter.clusters);
+    FlatHashMap<int> clusterBeforeIndicesByIds;
+    clusterBeforeIndicesByIds.reserve(toInt(dataBefore.clusters.size()));
+    for (int index = 0; index < dataBefore.clusters.size(); ++index) {
+        clusterBeforeIndicesByIds.insert_or_assign(dataBefore.clusters.at(index).id, index);
+    }
+    std::vector<bool> unchangedClustersBefore(dataBefore.clusters.size(), false);
+    std::vector<bool> unchangedClustersAfter(dataAfter.clusters.size(), false);
+    for (int index = 0; index < dataAfter.clusters.size(); ++index) {
+        if (auto indexBefore = clusterBeforeIndicesByIds.find(dataAfter.clusters.at(index).id)) {
+            if (hashesBefore.at(*indexBefore) == hashesAfter.at(index)) {
+                unchangedClustersBefore.at(*indexBefore) = true;
+                unchangedClustersAfter.at(index) = true;
+            }
+        }
+    }
+
+    //remaining cells are matched by id
+    std::vector<CellDescription const*> cellsBefore;
+    std::vector<CellDescription const*> cellsAfter;
+    for (int index = 0; index < dataBefore.clusters.size(); ++index) {
+        if (!unchangedClustersBefore.at(index)) {
+            for (auto const& cell : dataBefore.clusters.at(index).cells) {
+                cellsBefore.emplace_back(&cell);
+            }
+        }
+    }
+    for (int index = 0; index < dataAfter.clusters.size(); ++index) {
+        if (!unchangedClustersAfter.at(index)) {
+            for (auto const& cell : dataAfter.clusters.at(index).cells) {
+                cellsAfter.emplace_back(&cell);
+            }
+        }
     }
-    for (auto const& cluster : dataAfter.clusters) {
-        cellsAfter.insert(cellsAfter.begin(), cluster.cells.begin(), cluster.cells.end());
+    FlatHashMap<int> cellAfterIndicesByIds;
+    cellAfterIndicesByIds.reserve(toInt(cellsAfter.size()));
+    for (int index = 0; index < cellsAfter.size(); ++index) {
+        cellAfterIndicesByIds.insert_or_assign(cellsAfter.at(index)->id, index);
+    }
+    std::vector<bool> matchedCellsAfter(cellsAfter.size(), false);
+    std::vector<int> cellAfterIndicesByBeforeIndex(cellsBefore.size(), -1);
+    for (int index = 0; index < cellsBefore.size(); ++index) {
+        if (auto indexAfter = cellAfterIndicesByIds.find(cellsBefore.at(index)->id)) {
+            cellAfterIndicesByBeforeIndex.at(index) = *indexAfter;
+            matchedCellsAfter.at(*indexAfter) = true;
+        }
     }
 
-    unordered_map<uint64_t, int> cellsAfterIndicesByIds;
+    //matched cells are compared in parallel chunks
+    std::vector<std::vector<StateTracker<CellChangeDescription>>> cellChangesByChunk(
+        Parallel::getNumChunks(toInt(cellsBefore.size()), MinCellsPerChunk));
+    Parallel::forEachChunk(toInt(cellsBefore.size()), MinCellsPerChunk, [&](int chunk, int begin, int end) {
+        auto& cellChanges = cellChangesByChunk.at(chunk);
+        for (int index = begin; index < end; ++index) {
+            auto const& cellBefore = *cellsBefore.at(index);
+            auto cellAfterIndex = cellAfterIndicesByBeforeIndex.at(index);
+            if (cellAfterIndex == -1) {
+                cellChanges.emplace_back(
+                    CellChangeDescription().setId(cellBefore.id).setPos(cellBefore.pos),
+                    StateTracker<CellChangeDescription>::State::Deleted);
+                continue;
+            }
+            CellChangeDescription change(cellBefore, *cellsAfter.at(cellAfterIndex));
+            if (!change.isEmpty()) {
+                cellChanges.emplace_back(std::move(change), StateTracker<CellChangeDescription>::State::Modified);
+            }
+        }
+    });
+    for (auto& cellChanges : cellChangesByChunk) {
+        cells.insert(
+            cells.end(), std::make_move_iterator(cellChanges.begin()), std::make_move_iterator(cellChanges.end()));
+    }
     for (int index = 0; index < cellsAfter.size(); ++index) {
-        cellsAfterIndicesByIds.insert_or_assign(cellsAfter.at(index).id, index);
-	}
-
-	for (auto const& cellBefore : cellsBefore) {
-        auto cellIdAfterIt = cellsAfterIndicesByIds.find(cellBefore.id);
-        if (cellIdAfterIt == cellsAfterIndicesByIds.end()) {
-            addDeletedCell(CellChangeDescription().setId(cellBefore.id).setPos(cellBefore.pos));
-		}
-		else {
-			int cellAfterIndex = cellIdAfterIt->second;
-            auto const& cellAfter = cellsAfter.at(cellAfterIndex);
-			CellChangeDescription change(cellBefore, cellAfter);
-			if (!change.isEmpty()) {
-				addModifiedCell(change);
-			}
-			cellsAfterIndicesByIds.erase(cellBefore.id);
-		}
-	}
-
-	for (auto const& cellAfterIndex : cellsAfterIndicesByIds | boost::adaptors::map_values) {
-        auto const& cellAfter = cellsAfter.at(cellAfterIndex);
-        CellChangeDescription change(cellAfter);
-        addNewCell(change);
-	}
-
-	unordered_map<uint64_t, int> particleAfterIndicesByIds;
+        if (!matchedCellsAfter.at(index)) {
+            addNewCell(CellChangeDescription(*cellsAfter.at(index)));
+        }
+    }
+
+    FlatHashMap<int> particleAfterIndicesByIds;
+    particleAfterIndicesByIds.reserve(toInt(dataAfter.particles.size()));
     for (int index = 0; index < dataAfter.particles.size(); ++index) {
         particleAfterIndicesByIds.insert_or_assign(dataAfter.particles.at(index).id, index);
     }
-
+    std::vector<bool> matchedParticlesAfter(dataAfter.particles.size(), false);
     for (auto const& particleBefore : dataBefore.particles) {
-        auto particleIdAfterIt = particleAfterIndicesByIds.find(particleBefore.id);
-        if (particleIdAfterIt == particleAfterIndicesByIds.end()) {
+        auto particleAfterIndex = particleAfterIndicesByIds.find(particleBefore.id);
+        if (!particleAfterIndex) {
             addDeletedParticle(ParticleChangeDescription().setId(particleBefore.id).setPos(particleBefore.pos));
         } else {
-            int particleAfterIndex = particleIdAfterIt->second;
-            auto const& particleAfter = dataAfter.particles.at(particleAfterIndex);
+            auto const& particleAfter = dataAfter.particles.at(*particleAfterIndex);
             ParticleChangeDescription change(particleBefore, particleAfter);
             if (!change.isEmpty()) {
-                addModifiedParticle(change);
+                addModifiedParticle(std::move(change));
             }
-            particleAfterIndicesByIds.erase(particleBefore.id);
+            matchedParticlesAfter.at(*particleAfterIndex) = true;
         }
     }
-
-    for (auto const& particleAfterIndexById : particleAfterIndicesByIds) {
-        auto const& particleAfter = dataAfter.particles.at(particleAfterIndexById.second);
-        addNewParticle(ParticleChangeDescription(particleAfter));
+    for (int index = 0; index < dataAfter.particles.size(); ++index) {
+        if (!matchedParticlesAfter.at(index)) {
+            addNewParticle(ParticleChangeDescription(dataAfter.particles.at(index)));
+        }
     }
 }
-
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <boost/container/small_vector.hpp>
+
 #include "Base/Tracker.h"
 
 #include "Descriptions.h"
@@ -25,63 +27,189 @@ struct ConnectionChangeDescription
     bool operator!=(ConnectionChangeDescription const& other) const { return !(*this == other); }
 };
 
+int const MaxInlineConnections = 6;  //maximum number of cell bonds in the engine
+using ConnectionChangeDescriptions = boost::container::small_vector<ConnectionChangeDescription, MaxInlineConnections>;
+
+/**
+ * Change record of a cell. Only the fields flagged in changedFields are meaningful. The previous values are only
+ * kept on request (e.g. for undo) in oldValues.
+ */
 struct CellChangeDescription
 {
+    struct Field
+    {
+        enum Type : uint16_t
+        {
+            POS = 1 << 0,
+            VEL = 1 << 1,
+            ENERGY = 1 << 2,
+            MAX_CONNECTIONS = 1 << 3,
+            CONNECTIONS = 1 << 4,
+            TOKEN_BLOCKED = 1 << 5,
+            TOKEN_BRANCH_NUMBER = 1 << 6,
+            METADATA = 1 << 7,
+            CELL_FEATURE = 1 << 8,
+            TOKENS = 1 << 9,
+            TOKEN_USAGES = 1 << 10,
+            ALL = (1 << 11) - 1
+        };
+    };
+
 	uint64_t id = 0;
+    uint16_t changedFields = 0;
+
+    RealVector2D pos;
+    RealVector2D vel;
+    double energy = 0;
+    int maxConnections = 0;
+    ConnectionChangeDescriptions connectingCells;
+    bool tokenBlocked = false;
+    int tokenBranchNumber = 0;
+    CellMetadata metadata;
+    CellFeatureDescription cellFeatures;
+    DescriptionVector<TokenDescription> tokens;
+    int tokenUsages = 0;
 
-	ValueTracker<RealVector2D> pos;
-    ValueTracker<RealVector2D> vel;
-    ValueTracker<double> energy;
-	ValueTracker<int> maxConnections;
-    ValueTracker<std::list<ConnectionChangeDescription>> connectingCells;
-	ValueTracker<bool> tokenBlocked;
-	ValueTracker<int> tokenBranchNumber;
-	ValueTracker<CellMetadata> metadata;
-	ValueTracker<CellFeatureDescription> cellFeatures;
-	ValueTracker<vector<TokenDescription>> tokens;
-    ValueTracker<int> tokenUsages;
+    boost::shared_ptr<CellDescription const> oldValues;
 
 	ENGINEINTERFACE_EXPORT CellChangeDescription() = default;
     ENGINEINTERFACE_EXPORT CellChangeDescription(CellDescription const& desc);
-    ENGINEINTERFACE_EXPORT CellChangeDescription(CellDescription const& before, CellDescription const& after);
+    ENGINEINTERFACE_EXPORT CellChangeDescription(
+        CellDescription const& before,
+        CellDescription const& after,
+        bool keepOldValues = false);
+
+    bool isChanged(Field::Type field) const { return (changedFields & field) != 0; }
+    bool isEmpty() const { return changedFields == 0; }
 
-	ENGINEINTERFACE_EXPORT bool isEmpty() const;
 	CellChangeDescription& setId(uint64_t value) { id = value; return *this; }
-	CellChangeDescription& setPos(RealVector2D const& value) { pos = value; return *this; }
-	CellChangeDescription& setEnergy(double value) { energy = value; return *this; }
-	CellChangeDescription& setMaxConnections(int value) { maxConnections = value; return *this; }
-    CellChangeDescription& setConnectingCells(list<ConnectionChangeDescription> const& value)
+    CellChangeDescription& setPos(RealVector2D const& value)
+    {
+        pos = value;
+        changedFields |= Field::POS;
+        return *this;
+    }
+    CellChangeDescription& setVel(RealVector2D const& value)
+    {
+        vel = value;
+        changedFields |= Field::VEL;
+        return *this;
+    }
+    CellChangeDescription& setEnergy(double value)
+    {
+        energy = value;
+        changedFields |= Field::ENERGY;
+        return *this;
+    }
+    CellChangeDescription& setMaxConnections(int value)
+    {
+        maxConnections = value;
+        changedFields |= Field::MAX_CONNECTIONS;
+        return *this;
+    }
+    CellChangeDescription& setConnectingCells(ConnectionChangeDescriptions value)
+    {
+        connectingCells = std::move(value);
+        changedFields |= Field::CONNECTIONS;
+        return *this;
+    }
+    CellChangeDescription& setFlagTokenBlocked(bool value)
+    {
+        tokenBlocked = value;
+        changedFields |= Field::TOKEN_BLOCKED;
+        return *this;
+    }
+    CellChangeDescription& setTokenBranchNumber(int value)
+    {
+        tokenBranchNumber = value;
+        changedFields |= Field::TOKEN_BRANCH_NUMBER;
+        return *this;
+    }
+    CellChangeDescription& setMetadata(CellMetadata value)
+    {
+        metadata = std::move(value);
+        changedFields |= Field::METADATA;
+        return *this;
+    }
+    CellChangeDescription& setCellFunction(CellFeatureDescription value)
+    {
+        cellFeatures = std::move(value);
+        changedFields |= Field::CELL_FEATURE;
+        return *this;
+    }
+    CellChangeDescription& setTokens(DescriptionVector<TokenDescription> value)
     {
-        connectingCells = value;
+        tokens = std::move(value);
+        changedFields |= Field::TOKENS;
+        return *this;
+    }
+    CellChangeDescription& setTokenUsages(int value)
+    {
+        tokenUsages = value;
+        changedFields |= Field::TOKEN_USAGES;
         return *this;
     }
-	CellChangeDescription& setFlagTokenBlocked(bool value) { tokenBlocked = value; return *this; }
-	CellChangeDescription& setTokenBranchNumber(int value) { tokenBranchNumber = value; return *this; }
-	CellChangeDescription& setMetadata(CellMetadata const& value) { metadata = value; return *this; }
-	CellChangeDescription& setCellFunction(CellFeatureDescription const& value) { cellFeatures = value; return *this; }
-    CellChangeDescription& setTokenUsages(int value) { tokenUsages = value; return *this; }
 };
 
 struct ParticleChangeDescription
 {
+    struct Field
+    {
+        enum Type : uint8_t
+        {
+            POS = 1 << 0,
+            VEL = 1 << 1,
+            ENERGY = 1 << 2,
+            METADATA = 1 << 3,
+            ALL = (1 << 4) - 1
+        };
+    };
+
 	uint64_t id = 0;
+    uint8_t changedFields = 0;
 
-	ValueTracker<RealVector2D> pos;
-	ValueTracker<RealVector2D> vel;
-	ValueTracker<double> energy;
-	ValueTracker<ParticleMetadata> metadata;
+    RealVector2D pos;
+    RealVector2D vel;
+    double energy = 0;
+    ParticleMetadata metadata;
+
+    boost::shared_ptr<ParticleDescription const> oldValues;
 
 	ENGINEINTERFACE_EXPORT ParticleChangeDescription() = default;
     ENGINEINTERFACE_EXPORT ParticleChangeDescription(ParticleDescription const& desc);
     ENGINEINTERFACE_EXPORT ParticleChangeDescription(
         ParticleDescription const& before,
-        ParticleDescription const& after);
+        ParticleDescription const& after,
+        bool keepOldValues = false);
+
+    bool isChanged(Field::Type field) const { return (changedFields & field) != 0; }
+    bool isEmpty() const { return changedFields == 0; }
 
-	ENGINEINTERFACE_EXPORT bool isEmpty() const;
 	ParticleChangeDescription& setId(uint64_t value) { id = value; return *this; }
-	ParticleChangeDescription& setPos(RealVector2D const& value) { pos = value; return *this; }
-	ParticleChangeDescription& setVel(RealVector2D const& value) { vel = value; return *this; }
-	ParticleChangeDescription& setEnergy(double value) { energy = value; return *this; }
+    ParticleChangeDescription& setPos(RealVector2D const& value)
+    {
+        pos = value;
+        changedFields |= Field::POS;
+        return *this;
+    }
+    ParticleChangeDescription& setVel(RealVector2D const& value)
+    {
+        vel = value;
+        changedFields |= Field::VEL;
+        return *this;
+    }
+    ParticleChangeDescription& setEnergy(double value)
+    {
+        energy = value;
+        changedFields |= Field::ENERGY;
+        return *this;
+    }
+    ParticleChangeDescription& setMetadata(ParticleMetadata const& value)
+    {
+        metadata = value;
+        changedFields |= Field::METADATA;
+        return *this;
+    }
 };
 
 struct DataChangeDescription
@@ -93,17 +221,16 @@ struct DataChangeDescription
     ENGINEINTERFACE_EXPORT DataChangeDescription(DataDescription const& desc);
     ENGINEINTERFACE_EXPORT DataChangeDescription(DataDescription const& dataBefore, DataDescription const& dataAfter);
 
-	DataChangeDescription& addNewCell(CellChangeDescription const& value)
-	{
-		cells.emplace_back(StateTracker<CellChangeDescription>(value, StateTracker<CellChangeDescription>::State::Added));
-		return *this;
-	}
-	DataChangeDescription& addModifiedCell(CellChangeDescription const& value)
-	{
-        cells.emplace_back(
-            StateTracker<CellChangeDescription>(value, StateTracker<CellChangeDescription>::State::Modified));
-		return *this;
-	}
+    DataChangeDescription& addNewCell(CellChangeDescription value)
+    {
+        cells.emplace_back(std::move(value), StateTracker<CellChangeDescription>::State::Added);
+        return *this;
+    }
+    DataChangeDescription& addModifiedCell(CellChangeDescription value)
+    {
+        cells.emplace_back(std::move(value), StateTracker<CellChangeDescription>::State::Modified);
+        return *this;
+    }
     DataChangeDescription& addModifiedCell(list<CellChangeDescription> const& value)
 	{
 		for (auto const &cell : value) {
@@ -111,27 +238,32 @@ struct DataChangeDescription
 		}
 		return *this;
 	}
-    DataChangeDescription& addDeletedCell(CellChangeDescription const& value)
-	{
-        cells.emplace_back(
-            StateTracker<CellChangeDescription>(value, StateTracker<CellChangeDescription>::State::Deleted));
-		return *this;
-	}
-	DataChangeDescription& addNewParticle(ParticleChangeDescription const& value)
-	{
-		particles.emplace_back(StateTracker<ParticleChangeDescription>(value, StateTracker<ParticleChangeDescription>::State::Added));
-		return *this;
-	}
-	DataChangeDescription& addModifiedParticle(ParticleChangeDescription const& value)
-	{
-		particles.emplace_back(StateTracker<ParticleChangeDescription>(value, StateTracker<ParticleChangeDescription>::State::Modified));
-		return *this;
-	}
-	DataChangeDescription& addDeletedParticle(ParticleChangeDescription const& value)
-	{
-		particles.emplace_back(StateTracker<ParticleChangeDescription>(value, StateTracker<ParticleChangeDescription>::State::Deleted));
-		return *this;
-	}
+    DataChangeDescription& addDeletedCell(CellChangeDescription value)
+    {
+        cells.emplace_back(std::move(value), StateTracker<CellChangeDescription>::State::Deleted);
+        return *this;
+    }
+    DataChangeDescription& addNewParticle(ParticleChangeDescription value)
+    {
+        particles.emplace_back(std::move(value), StateTracker<ParticleChangeDescription>::State::Added);
+        return *this;
+    }
+    DataChangeDescription& addModifiedParticle(ParticleChangeDescription value)
+    {
+        particles.emplace_back(std::move(value), StateTracker<ParticleChangeDescription>::State::Modified);
+        return *this;
+    }
+    DataChangeDescription& addDeletedParticle(ParticleChangeDescription value)
+    {
+        particles.emplace_back(std::move(value), StateTracker<ParticleChangeDescription>::State::Deleted);
+        return *this;
+    }
+    DataChangeDescription& reserve(int numCells, int numParticles)
+    {
+        cells.reserve(numCells);
+        particles.reserve(numParticles);
+        return *this;
+    }
 	void clear()
 	{
 		cells.clear();
@@ -0,0 +1,190 @@
+#include "ColumnarDescriptions.h"
+
+#include "Base/Tracing.h"
+
+#include "Descriptions.h"
+
+ColumnarDataDescription::ColumnarDataDescription(DataDescription const& data)
+{
+    TRACE_SCOPE("ColumnarDataDescription", "convert from data description");
+    int numCells = 0;
+    int numConnections = 0;
+    int numTokens = 0;
+    for (auto const& cluster : data.clusters) {
+        numCells += toInt(cluster.cells.size());
+        for (auto const& cell : cluster.cells) {
+            numConnections += toInt(cell.connections.size());
+            numTokens += toInt(cell.tokens.size());
+        }
+    }
+    reserve(toInt(data.clusters.size()), numCells, numConnections, numTokens, toInt(data.particles.size()));
+
+    for (auto const& cluster : data.clusters) {
+        addCluster(cluster.id);
+        for (auto const& cell : cluster.cells) {
+            addCell(cell);
+        }
+    }
+    for (auto const& particle : data.particles) {
+        addParticle(particle);
+    }
+}
+
+DataDescription ColumnarDataDescription::toDataDescription() const
+{
+    TRACE_SCOPE("ColumnarDataDescription", "convert to data description");
+    DataDescription result;
+    result.clusters.reserve(getNumClusters());
+    for (int clusterIndex = 0; clusterIndex < getNumClusters(); ++clusterIndex) {
+        ClusterDescription cluster;
+        cluster.id = clusterIds[clusterIndex];
+        cluster.cells.reserve(clusterCellOffsets[clusterIndex + 1] - clusterCellOffsets[clusterIndex]);
+        for (int cellIndex = clusterCellOffsets[clusterIndex]; cellIndex < clusterCellOffsets[clusterIndex + 1];
+             ++cellIndex) {
+            cluster.cells.emplace_back(getCell(cellIndex));
+        }
+        result.clusters.emplace_back(std::move(cluster));
+    }
+
+    result.particles.reserve(getNumParticles());
+    for (int particleIndex = 0; particleIndex < getNumParticles(); ++particleIndex) {
+        result.particles.emplace_back(getParticle(particleIndex));
+    }
+    return result;
+}
+
+void ColumnarDataDescription::reserve(int numClusters, int numCells, int numConnections, int numTokens, int numParticles)
+{
+    clusterIds.reserve(numClusters);
+    clusterCellOffsets.reserve(numClusters + 1);
+
+    cellIds.reserve(numCells);
+    cellPositions.reserve(numCells);
+    cellVelocities.reserve(numCells);
+    cellEnergies.reserve(numCells);
+    cellMaxConnections.reserve(numCells);
+    cellTokenBlocked.reserve(numCells);
+    cellTokenBranchNumbers.reserve(numCells);
+    cellTokenUsages.reserve(numCells);
+    cellFunctionTypes.reserve(numCells);
+    cellConstData.reserve(numCells);
+    cellVolatileData.reserve(numCells);
+    cellColors.reserve(numCells);
+    cellNames.reserve(numCells);
+    cellDescriptions.reserve(numCells);
+    cellSourceCodes.reserve(numCells);
+
+    cellConnectionOffsets.reserve(numCells + 1);
+    connectionCellIds.reserve(numConnections);
+    connectionDistances.reserve(numConnections);
+    connectionAnglesFromPrevious.reserve(numConnections);
+
+    cellTokenOffsets.reserve(numCells + 1);
+    tokenEnergies.reserve(numTokens);
+    tokenData.reserve(numTokens);
+
+    particleIds.reserve(numParticles);
+    particlePositions.reserve(numParticles);
+    particleVelocities.reserve(numParticles);
+    particleEnergies.reserve(numParticles);
+    particleColors.reserve(numParticles);
+}
+
+void ColumnarDataDescription::clear()
+{
+    *this = ColumnarDataDescription();
+}
+
+void ColumnarDataDescription::addCluster(uint64_t id)
+{
+    clusterIds.emplace_back(id);
+    clusterCellOffsets.emplace_back(clusterCellOffsets.back());
+}
+
+void ColumnarDataDescription::addCell(CellDescription const& cell)
+{
+    cellIds.emplace_back(cell.id);
+    cellPositions.emplace_back(cell.pos);
+    cellVelocities.emplace_back(cell.vel);
+    cellEnergies.emplace_back(cell.energy);
+    cellMaxConnections.emplace_back(cell.maxConnections);
+    cellTokenBlocked.emplace_back(cell.tokenBlocked);
+    cellTokenBranchNumbers.emplace_back(cell.tokenBranchNumber);
+    cellTokenUsages.emplace_back(cell.tokenUsages);
+    cellFunctionTypes.emplace_back(cell.cellFeature.getType());
+    cellConstData.add(cell.cellFeature.constData);
+    cellVolatileData.add(cell.cellFeature.volatileData);
+    cellColors.emplace_back(cell.metadata.color);
+    cellNames.add(cell.metadata.name);
+    cellDescriptions.add(cell.metadata.description);
+    cellSourceCodes.add(cell.metadata.computerSourcecode);
+
+    for (auto const& connection : cell.connections) {
+        connectionCellIds.emplace_back(connection.cellId);
+        connectionDistances.emplace_back(connection.distance);
+        connectionAnglesFromPrevious.emplace_back(connection.angleFromPrevious);
+    }
+    cellConnectionOffsets.emplace_back(getNumConnections());
+
+    for (auto const& token : cell.tokens) {
+        tokenEnergies.emplace_back(token.energy);
+        tokenData.add(token.data);
+    }
+    cellTokenOffsets.emplace_back(getNumTokens());
+
+    ++clusterCellOffsets.back();
+}
+
+void ColumnarDataDescription::addParticle(ParticleDescription const& particle)
+{
+    particleIds.emplace_back(particle.id);
+    particlePositions.emplace_back(particle.pos);
+    particleVelocities.emplace_back(particle.vel);
+    particleEnergies.emplace_back(particle.energy);
+    particleColors.emplace_back(particle.metadata.color);
+}
+
+CellDescription ColumnarDataDescription::getCell(int index) const
+{
+    CellDescription result;
+    result.id = cellIds[index];
+    result.pos = cellPositions[index];
+    result.vel = cellVelocities[index];
+    result.energy = cellEnergies[index];
+    result.maxConnections = cellMaxConnections[index];
+    result.tokenBlocked = cellTokenBlocked[index] != 0;
+    result.tokenBranchNumber = cellTokenBranchNumbers[index];
+    result.tokenUsages = cellTokenUsages[index];
+    result.cellFeature.setType(cellFunctionTypes[index]);
+    result.cellFeature.constData = cellConstData.get(index);
+    result.cellFeature.volatileData = cellVolatileData.get(index);
+    result.metadata.color = cellColors[index];
+    result.metadata.name = cellNames.get(index);
+    result.metadata.description = cellDescriptions.get(index);
+    result.metadata.computerSourcecode = cellSourceCodes.get(index);
+
+    result.connections.reserve(cellConnectionOffsets[index + 1] - cellConnectionOffsets[index]);
+    for (int i = cellConnectionOffsets[index]; i < cellConnectionOffsets[index + 1]; ++i) {
+        ConnectionDescription connection;
+        connection.cellId = connectionCellIds[i];
+        connection.distance = connectionDistances[i];
+        connection.angleFromPrevious = connectionAnglesFromPrevious[i];
+        result.connections.emplace_back(connection);
+    }
+
+    result.tokens.reserve(cellTokenOffsets[index + 1] - cellTokenOffsets[index]);
+    for (int i = cellTokenOffsets[index]; i < cellTokenOffsets[index + 1]; ++i) {
+        result.tokens.emplace_back(TokenDescription().setEnergy(tokenEnergies[i]).setData(tokenData.get(i)));
+    }
+    return result;
+}
+
+ParticleDescription ColumnarDataDescription::getParticle(int index) const
+{
+    return ParticleDescription()
+        .setId(particleIds[index])
+        .setPos(particlePositions[index])
+        .setVel(particleVelocities[index])
+        .setEnergy(particleEnergies[index])
+        .setMetadata(ParticleMetadata().setColor(particleColors[index]));
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "Base/Definitions.h"
+
+#include "Definitions.h"
+#include "ElementaryTypes.h"
+#include "DllExport.h"
+
+/**
+ * Variable-length strings stored back to back. String i occupies the bytes [offsets[i], offsets[i + 1]).
+ */
+struct StringColumn
+{
+    std::vector<char> bytes;
+    std::vector<uint64_t> offsets = {0};
+
+    int size() const { return toInt(offsets.size()) - 1; }
+    int getLength(int index) const { return static_cast<int>(offsets[index + 1] - offsets[index]); }
+    char const* getData(int index) const { return bytes.data() + offsets[index]; }
+    std::string get(int index) const { return std::string(getData(index), getLength(index)); }
+
+    void add(std::string_view value) { add(value.data(), toInt(value.size())); }
+    void add(char const* data, int length)
+    {
+        bytes.insert(bytes.end(), data, data + length);
+        offsets.emplace_back(bytes.size());
+    }
+    void reserve(int numStrings) { offsets.reserve(numStrings + 1); }
+    void clear()
+    {
+        bytes.clear();
+        offsets = {0};
+    }
+};
+
+/**
+ * Column-oriented counterpart of DataDescription which avoids per-cell heap allocations for large worlds.
+ * Each field is stored in a contiguous array indexed by cell or particle. Cells of cluster i are
+ * [clusterCellOffsets[i], clusterCellOffsets[i + 1]), connections and tokens of cell i are stored in compressed
+ * sparse row layout via cellConnectionOffsets and cellTokenOffsets.
+ */
+struct ColumnarDataDescription
+{
+    //clusters
+    std::vector<uint64_t> clusterIds;
+    std::vector<int> clusterCellOffsets = {0};
+
+    //cells
+    std::vector<uint64_t> cellIds;
+    std::vector<RealVector2D> cellPositions;
+    std::vector<RealVector2D> cellVelocities;
+    std::vector<double> cellEnergies;
+    std::vector<int> cellMaxConnections;
+    std::vector<uint8_t> cellTokenBlocked;  //no std::vector<bool> in order to keep elements addressable
+    std::vector<int> cellTokenBranchNumbers;
+    std::vector<int> cellTokenUsages;
+    std::vector<Enums::CellFunction::Type> cellFunctionTypes;
+    StringColumn cellConstData;
+    StringColumn cellVolatileData;
+    std::vector<unsigned char> cellColors;
+    StringColumn cellNames;
+    StringColumn cellDescriptions;
+    StringColumn cellSourceCodes;
+
+    //connections
+    std::vector<int> cellConnectionOffsets = {0};
+    std::vector<uint64_t> connectionCellIds;
+    std::vector<float> connectionDistances;
+    std::vector<float> connectionAnglesFromPrevious;
+
+    //tokens
+    std::vector<int> cellTokenOffsets = {0};
+    std::vector<double> tokenEnergies;
+    StringColumn tokenData;
+
+    //particles
+    std::vector<uint64_t> particleIds;
+    std::vector<RealVector2D> particlePositions;
+    std::vector<RealVector2D> particleVelocities;
+    std::vector<double> particleEnergies;
+    std::vector<uint8_t> particleColors;
+
+    ENGINEINTERFACE_EXPORT ColumnarDataDescription() = default;
+    ENGINEINTERFACE_EXPORT explicit ColumnarDataDescription(DataDescription const& data);
+
+    ENGINEINTERFACE_EXPORT DataDescription toDataDescription() const;
+
+    int getNumClusters() const { return toInt(clusterIds.size()); }
+    int getNumCells() const { return toInt(cellIds.size()); }
+    int getNumConnections() const { return toInt(connectionCellIds.size()); }
+    int getNumTokens() const { return toInt(tokenEnergies.size()); }
+    int getNumParticles() const { return toInt(particleIds.size()); }
+    bool isEmpty() const { return cellIds.empty() && particleIds.empty(); }
+
+    ENGINEINTERFACE_EXPORT void
+    reserve(int numClusters, int numCells, int numConnections, int numTokens, int numParticles);
+    ENGINEINTERFACE_EXPORT void clear();
+
+    //cells are added to the last added cluster
+    ENGINEINTERFACE_EXPORT void addCluster(uint64_t id);
+    ENGINEINTERFACE_EXPORT void addCell(CellDescription const& cell);
+    ENGINEINTERFACE_EXPORT void addParticle(ParticleDescription const& particle);
+
+    ENGINEINTERFACE_EXPORT CellDescription getCell(int index) const;
+    ENGINEINTERFACE_EXPORT ParticleDescription getParticle(int index) const;
+};
@@ -1,8 +1,11 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <map>
+#include <memory_resource>
 #include <string>
+#include <vector>
 
 #include <boost/optional.hpp>
 #include <boost/shared_ptr.hpp>
@@ -16,6 +19,12 @@ struct ClusterDescription;
 struct CellDescription;
 struct ParticleDescription;
 
+//containers of description trees can be allocated from a memory resource, e.g. from a DescriptionArena
+using DescriptionAllocator = std::pmr::polymorphic_allocator<std::byte>;
+template <typename T>
+using DescriptionVector = std::pmr::vector<T>;
+using DescriptionString = std::pmr::string;
+
 struct DataChangeDescription;
 struct CellChangeDescription;
 struct ParticleChangeDescription;
@@ -24,6 +33,7 @@ struct GpuSettings;
 
 struct GeneralSettings;
 struct Settings;
+struct ParameterSchedule;
 
 class _Serializer;
 using Serializer = boost::shared_ptr<_Serializer>;
@@ -0,0 +1,41 @@
+#include "DescriptionArena.h"
+
+DescriptionArena::DescriptionArena(size_t initialSize)
+    : _memoryResource(std::make_unique<SynchronizedResource>(initialSize))
+{
+    auto memory = _memoryResource->allocate(sizeof(DataDescription), alignof(DataDescription));
+    _data = new (memory) DataDescription(getAllocator());
+}
+
+DescriptionArena::~DescriptionArena()
+{
+    //the destructors of the description tree would only return memory to the arena, which is released as a whole
+    _memoryResource->release();
+}
+
+DescriptionArena::SynchronizedResource::SynchronizedResource(size_t initialSize)
+    : _upstream(initialSize)
+{}
+
+void DescriptionArena::SynchronizedResource::release()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _upstream.release();
+}
+
+void* DescriptionArena::SynchronizedResource::do_allocate(size_t bytes, size_t alignment)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _upstream.allocate(bytes, alignment);
+}
+
+void DescriptionArena::SynchronizedResource::do_deallocate(void* p, size_t bytes, size_t alignment)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _upstream.deallocate(p, bytes, alignment);
+}
+
+bool DescriptionArena::SynchronizedResource::do_is_equal(std::pmr::memory_resource const& other) const noexcept
+{
+    return this == &other;
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+
+#include "Definitions.h"
+#include "Descriptions.h"
+#include "DllExport.h"
+
+/**
+ * Owns a DataDescription whose clusters, cells, tokens and strings are all allocated from a monotonic buffer.
+ * Building the description only bumps a pointer and destroying the arena frees the whole tree at once without
+ * visiting its nodes. Hence it is suited for large descriptions which are built once and then kept or dropped as a
+ * whole, e.g. snapshots.
+ * Allocations are serialized since the parallel functions of DescriptionHelper and ClusterDescription::addConnections
+ * allocate from several threads.
+ */
+class DescriptionArena
+{
+public:
+    ENGINEINTERFACE_EXPORT explicit DescriptionArena(size_t initialSize = DefaultInitialSize);
+    ENGINEINTERFACE_EXPORT ~DescriptionArena();
+
+    DescriptionArena(DescriptionArena const&) = delete;
+    DescriptionArena& operator=(DescriptionArena const&) = delete;
+
+    DescriptionAllocator getAllocator() const { return DescriptionAllocator(_memoryResource.get()); }
+
+    DataDescription& getData() { return *_data; }
+    DataDescription const& getData() const { return *_data; }
+
+private:
+    static size_t constexpr DefaultInitialSize = 1 << 20;
+
+    class SynchronizedResource : public std::pmr::memory_resource
+    {
+    public:
+        explicit SynchronizedResource(size_t initialSize);
+
+        void release();
+
+    private:
+        void* do_allocate(size_t bytes, size_t alignment) override;
+        void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+        bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override;
+
+        std::mutex _mutex;
+        std::pmr::monotonic_buffer_resource _upstream;
+    };
+
+    std::unique_ptr<SynchronizedResource> _memoryResource;
+    DataDescription* _data;  //lives in the arena and is never destructed
+};
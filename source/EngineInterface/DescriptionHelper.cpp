@@ -1,66 +1,181 @@
 #include "DescriptionHelper.h"
 
+#include <algorithm>
+
 #include "Base/NumberGenerator.h"
 #include "Base/Math.h"
+#include "Base/Parallel.h"
+#include "Base/Tracing.h"
 #include "SpaceCalculator.h"
 
-void DescriptionHelper::duplicate(DataDescription& data, IntVector2D const& origSize, IntVector2D const& size)
+namespace
 {
-    DataDescription result;
+    int const MinClustersPerChunk = 64;
+    int const MinParticlesPerChunk = 4096;
 
-    for (int incX = 0; incX < size.x; incX += origSize.x) {
-        for (int incY = 0; incY < size.y; incY += origSize.y) {
-            for (auto cluster : data.clusters) {
-                auto origPos = cluster.getClusterPosFromCells();
-                RealVector2D clusterPos = {origPos.x + incX, origPos.y + incY};
-                if (clusterPos.x < size.x && clusterPos.y < size.y) {
-                    for (auto& cell : cluster.cells) {
-                        cell.pos = RealVector2D{cell.pos.x + incX, cell.pos.y + incY};
-                    }
-                    makeValid(cluster);
-                    result.addCluster(cluster);
+    struct TileEntry
+    {
+        int tile;
+        int index;
+    };
+
+    //entries of the first tile come first
+    std::vector<TileEntry> getTileEntries(
+        std::vector<RealVector2D> const& tileOffsets,
+        std::vector<RealVector2D> const& positions,
+        IntVector2D const& size)
+    {
+        std::vector<TileEntry> result;
+        result.reserve(tileOffsets.size() * positions.size());
+        for (int tile = 0; tile < tileOffsets.size(); ++tile) {
+            auto const& offset = tileOffsets.at(tile);
+            for (int index = 0; index < positions.size(); ++index) {
+                auto const& pos = positions.at(index);
+                if (pos.x + offset.x < size.x && pos.y + offset.y < size.y) {
+                    result.emplace_back(TileEntry{tile, index});
                 }
             }
-            for (auto particle : data.particles) {
-                auto origPos = particle.pos;
-                particle.pos = RealVector2D{origPos.x + incX, origPos.y + incY};
-                if (particle.pos.x < size.x && particle.pos.y < size.y) {
-                    particle.setId(NumberGenerator::getInstance().getId());
-                    result.addParticle(particle);
-                }
+        }
+        return result;
+    }
+
+    int getNumEntriesOfFirstTile(std::vector<TileEntry> const& entries)
+    {
+        return toInt(std::find_if(entries.begin(), entries.end(), [](auto const& entry) { return entry.tile != 0; })
+                     - entries.begin());
+    }
+
+    /**
+     * Fills the tiles without an intermediate copy of the whole description: copies for further tiles are appended
+     * behind the original elements, afterwards the originals are compacted to the entries of the first tile.
+     */
+    template <typename T, typename TransformFunc>
+    void fillTilesInplace(
+        DescriptionVector<T>& elements,
+        std::vector<TileEntry> const& entries,
+        int minElementsPerChunk,
+        TransformFunc const& transform)
+    {
+        auto numOrigElements = toInt(elements.size());
+        auto numFirstTileEntries = getNumEntriesOfFirstTile(entries);
+        auto numFurtherTileEntries = toInt(entries.size()) - numFirstTileEntries;
+
+        elements.resize(numOrigElements + numFurtherTileEntries);
+        Parallel::forEachChunk(numFurtherTileEntries, minElementsPerChunk, [&](int, int begin, int end) {
+            for (int index = begin; index < end; ++index) {
+                auto const& entry = entries.at(numFirstTileEntries + index);
+                auto& element = elements.at(numOrigElements + index);
+                element = elements.at(entry.index);
+                transform(element, entry.tile);
+            }
+        });
+
+        for (int index = 0; index < numFirstTileEntries; ++index) {
+            auto const& entry = entries.at(index);
+            if (entry.index != index) {
+                elements.at(index) = std::move(elements.at(entry.index));
             }
         }
+        Parallel::forEachChunk(numFirstTileEntries, minElementsPerChunk, [&](int, int begin, int end) {
+            for (int index = begin; index < end; ++index) {
+                transform(elements.at(index), 0);
+            }
+        });
+        elements.erase(elements.begin() + numFirstTileEntries, elements.begin() + numOrigElements);
     }
-    data = result;
 }
 
-void DescriptionHelper::correctConnections(DataDescription& data, IntVector2D const& worldSize)
+void DescriptionHelper::duplicate(
+    DataDescription& data,
+    DescriptionNavigator const& navigator,
+    IntVector2D const& origSize,
+    IntVector2D const& size)
 {
-//     SpaceCalculator spaceCalculator(worldSize);
-    auto threshold = std::min(worldSize.x, worldSize.y) /3;
-    std::unordered_map<uint64_t, CellDescription&> cellById;
-    for (auto& cluster : data.clusters) {
+    TRACE_SCOPE("DescriptionHelper", "duplicate");
+    std::vector<RealVector2D> tileOffsets;
+    for (int incX = 0; incX < size.x; incX += origSize.x) {
+        for (int incY = 0; incY < size.y; incY += origSize.y) {
+            tileOffsets.emplace_back(toFloat(incX), toFloat(incY));
+        }
+    }
+
+    //clusters
+    std::vector<RealVector2D> clusterPositions(data.clusters.size());
+    Parallel::forEachChunk(toInt(data.clusters.size()), MinClustersPerChunk, [&](int, int begin, int end) {
+        for (int index = begin; index < end; ++index) {
+            clusterPositions.at(index) = data.clusters.at(index).getClusterPosFromCells();
+        }
+    });
+    auto clusterEntries = getTileEntries(tileOffsets, clusterPositions, size);
+    clusterPositions = std::vector<RealVector2D>();
+
+    //cell indices within their clusters are the same for all tiles
+    fillTilesInplace(data.clusters, clusterEntries, MinClustersPerChunk, [&](ClusterDescription& cluster, int tile) {
+        auto const& offset = tileOffsets.at(tile);
         for (auto& cell : cluster.cells) {
-            cellById.emplace(cell.id, cell);
+            cell.pos = RealVector2D{cell.pos.x + offset.x, cell.pos.y + offset.y};
         }
+        makeValid(cluster, navigator.cellIndicesByCellIds);
+    });
+
+    //particles
+    std::vector<RealVector2D> particlePositions;
+    particlePositions.reserve(data.particles.size());
+    for (auto const& particle : data.particles) {
+        particlePositions.emplace_back(particle.pos);
     }
-    for (auto& cluster : data.clusters) {
-        for (auto& cell: cluster.cells) {
-            std::vector<ConnectionDescription> newConnections;
-            float angleToAdd = 0;
-            for (auto connection : cell.connections) {
-                auto& connectingCell = cellById.at(connection.cellId);
-                if (/*spaceCalculator.distance*/Math::length(cell.pos - connectingCell.pos) > threshold) {
-                    angleToAdd += connection.angleFromPrevious;
-                } else {
-                    connection.angleFromPrevious += angleToAdd;
-                    angleToAdd = 0;
-                    newConnections.emplace_back(connection);
+    auto particleEntries = getTileEntries(tileOffsets, particlePositions, size);
+    particlePositions = std::vector<RealVector2D>();
+
+    fillTilesInplace(
+        data.particles, particleEntries, MinParticlesPerChunk, [&](ParticleDescription& particle, int tile) {
+            auto const& offset = tileOffsets.at(tile);
+            particle.pos = RealVector2D{particle.pos.x + offset.x, particle.pos.y + offset.y};
+            particle.setId(NumberGenerator::getInstance().getId());
+        });
+}
+
+void DescriptionHelper::correctConnections(
+    DataDescription& data,
+    DescriptionNavigator const& navigator,
+    IntVector2D const& worldSize)
+{
+    TRACE_SCOPE("DescriptionHelper", "correct connections");
+    SpaceCalculator spaceCalculator(worldSize);
+    auto threshold = toFloat(std::min(worldSize.x, worldSize.y) / 3);
+
+    Parallel::forEachChunk(toInt(data.clusters.size()), MinClustersPerChunk, [&](int, int begin, int end) {
+        std::vector<RealVector2D> connectingCellPositions;
+        std::vector<float> distances;
+        for (int clusterIndex = begin; clusterIndex < end; ++clusterIndex) {
+            for (auto& cell : data.clusters.at(clusterIndex).cells) {
+                connectingCellPositions.clear();
+                for (auto const& connection : cell.connections) {
+                    auto const& connectingCell =
+                        data.clusters.at(navigator.clusterIndicesByCellIds.at(connection.cellId))
+                            .cells.at(navigator.cellIndicesByCellIds.at(connection.cellId));
+                    connectingCellPositions.emplace_back(connectingCell.pos);
                 }
+                spaceCalculator.distances(cell.pos, connectingCellPositions, distances);
+
+                //angles of removed connections are added to the next connection
+                DescriptionVector<ConnectionDescription> newConnections(cell.connections.get_allocator());
+                newConnections.reserve(cell.connections.size());
+                float angleToAdd = 0;
+                for (int i = 0; i < cell.connections.size(); ++i) {
+                    auto connection = cell.connections.at(i);
+                    if (distances.at(i) > threshold) {
+                        angleToAdd += connection.angleFromPrevious;
+                    } else {
+                        connection.angleFromPrevious += angleToAdd;
+                        angleToAdd = 0;
+                        newConnections.emplace_back(connection);
+                    }
+                }
+                cell.connections = std::move(newConnections);
             }
-            cell.connections = newConnections;
         }
-    }
+    });
 }
 
 void DescriptionHelper::colorize(DataDescription& data, std::vector<int> const& colorCodes)
@@ -73,20 +188,16 @@ void DescriptionHelper::colorize(DataDescription& data, std::vector<int> const&
     }
 }
 
-void DescriptionHelper::makeValid(ClusterDescription& cluster)
+void DescriptionHelper::makeValid(ClusterDescription& cluster, FlatHashMap<int> const& cellIndicesByIds)
 {
-    auto& numberGen = NumberGenerator::getInstance();
-    cluster.id = numberGen.getId();
-    unordered_map<uint64_t, uint64_t> newByOldIds;
-    for (auto& cell : cluster.cells) {
-        uint64_t newId = numberGen.getId();
-        newByOldIds.insert_or_assign(cell.id, newId);
-        cell.id = newId;
-    }
-
-    for (auto& cell : cluster.cells) {
+    //cluster id is followed by the cell ids in the order of the cells
+    auto firstId = NumberGenerator::getInstance().reserveIds(toInt(cluster.cells.size()) + 1);
+    cluster.id = firstId;
+    for (int index = 0; index < cluster.cells.size(); ++index) {
+        auto& cell = cluster.cells.at(index);
         for (auto& connection : cell.connections) {
-            connection.cellId = newByOldIds.at(connection.cellId);
+            connection.cellId = firstId + 1 + cellIndicesByIds.at(connection.cellId);
         }
+        cell.id = firstId + 1 + index;
     }
 }
@@ -1,19 +1,26 @@
 #pragma once
 
 #include "Base/Definitions.h"
+#include "Base/FlatHashMap.h"
 #include "Descriptions.h"
 
 class DescriptionHelper
 {
 public:
-    ENGINEINTERFACE_EXPORT static void
-    duplicate(DataDescription& data, IntVector2D const& origWorldSize, IntVector2D const& worldSize);
+    //navigator has to be up to date with data, it is invalid afterwards since new ids are assigned
+    ENGINEINTERFACE_EXPORT static void duplicate(
+        DataDescription& data,
+        DescriptionNavigator const& navigator,
+        IntVector2D const& origWorldSize,
+        IntVector2D const& worldSize);
 
+    //navigator has to be up to date with data, it remains valid since only connections are removed
     ENGINEINTERFACE_EXPORT static void
-    correctConnections(DataDescription& data, IntVector2D const& worldSize);
+    correctConnections(DataDescription& data, DescriptionNavigator const& navigator, IntVector2D const& worldSize);
 
     ENGINEINTERFACE_EXPORT static void colorize(DataDescription& data, std::vector<int> const& colorCodes);
 
 private:
-    static void makeValid(ClusterDescription& cluster);
+    //assigns new ids, cellIndicesByIds maps the old cell ids to their indices within the cluster
+    static void makeValid(ClusterDescription& cluster, FlatHashMap<int> const& cellIndicesByIds);
 };
@@ -1,61 +1,120 @@
 #include "Descriptions.h"
 
+#include <algorithm>
+#include <stdexcept>
+
 #include <boost/range/adaptors.hpp>
 
 #include "Base/Math.h"
+#include "Base/Parallel.h"
 #include "Base/Physics.h"
+#include "Base/Tracing.h"
 
 #include "ChangeDescriptions.h"
 
-namespace
+CellDescription::CellDescription(allocator_type const& allocator)
+    : connections(allocator)
+    , metadata(allocator)
+    , cellFeature(allocator)
+    , tokens(allocator)
+{}
+
+CellDescription::CellDescription(CellDescription const& other, allocator_type const& allocator)
+    : id(other.id)
+    , pos(other.pos)
+    , vel(other.vel)
+    , energy(other.energy)
+    , maxConnections(other.maxConnections)
+    , connections(other.connections, allocator)
+    , tokenBlocked(other.tokenBlocked)
+    , tokenBranchNumber(other.tokenBranchNumber)
+    , metadata(other.metadata, allocator)
+    , cellFeature(other.cellFeature, allocator)
+    , tokens(other.tokens, allocator)
+    , tokenUsages(other.tokenUsages)
+{}
+
+CellDescription::CellDescription(CellDescription&& other, allocator_type const& allocator)
+    : id(other.id)
+    , pos(other.pos)
+    , vel(other.vel)
+    , energy(other.energy)
+    , maxConnections(other.maxConnections)
+    , connections(std::move(other.connections), allocator)
+    , tokenBlocked(other.tokenBlocked)
+    , tokenBranchNumber(other.tokenBranchNumber)
+    , metadata(std::move(other.metadata), allocator)
+    , cellFeature(std::move(other.cellFeature), allocator)
+    , tokens(std::move(other.tokens), allocator)
+    , tokenUsages(other.tokenUsages)
+{}
+
+CellDescription::CellDescription(CellChangeDescription const& change, allocator_type const& allocator)
+    : CellDescription(allocator)
 {
-    boost::optional<std::list<ConnectionDescription>> convert(
-        boost::optional<std::list<ConnectionChangeDescription>> const& connections)
-    {
-        if (!connections) {
-            return boost::none;
-        }
-        std::list<ConnectionDescription> result;
-        for (auto const& connectionChange : *connections) {
+    if (change.changedFields != CellChangeDescription::Field::ALL) {
+        throw std::invalid_argument("Change of cell " + std::to_string(change.id) + " does not contain all fields.");
+    }
+    applyChange(change);
+}
+
+CellDescription& CellDescription::applyChange(CellChangeDescription const& change)
+{
+    using Field = CellChangeDescription::Field;
+    id = change.id;
+    if (change.isChanged(Field::POS)) {
+        pos = change.pos;
+    }
+    if (change.isChanged(Field::VEL)) {
+        vel = change.vel;
+    }
+    if (change.isChanged(Field::ENERGY)) {
+        energy = change.energy;
+    }
+    if (change.isChanged(Field::MAX_CONNECTIONS)) {
+        maxConnections = change.maxConnections;
+    }
+    if (change.isChanged(Field::CONNECTIONS)) {
+        connections.clear();
+        connections.reserve(change.connectingCells.size());
+        for (auto const& connectionChange : change.connectingCells) {
             ConnectionDescription connection;
             connection.cellId = connectionChange.cellId;
             connection.distance = connectionChange.distance;
             connection.angleFromPrevious = connectionChange.angleFromPrevious;
-            result.emplace_back(connection);
+            connections.emplace_back(connection);
         }
-        return result;
     }
-
-}
-
-CellDescription::CellDescription(CellChangeDescription const& change)
-{
-    id = change.id;
-    pos = *static_cast<boost::optional<RealVector2D>>(change.pos);
-    energy = *static_cast<boost::optional<double>>(change.energy);
-    maxConnections = *static_cast<boost::optional<int>>(change.maxConnections);
-
-    std::list<ConnectionDescription> connectionList =
-        *convert(static_cast<boost::optional<std::list<ConnectionChangeDescription>>>(change.connectingCells));
-    connections = std::vector<ConnectionDescription>(connectionList.begin(), connectionList.end());
-    tokenBlocked = *change.tokenBlocked.getOptionalValue();  //static_cast<boost::optional<bool>> doesn't work for some reason
-    tokenBranchNumber = *static_cast<boost::optional<int>>(change.tokenBranchNumber);
-    metadata = *static_cast<boost::optional<CellMetadata>>(change.metadata);
-    cellFeature =
-        *static_cast<boost::optional<CellFeatureDescription>>(change.cellFeatures);
-    tokens = *static_cast<boost::optional<vector<TokenDescription>>>(change.tokens);
-    tokenUsages = *static_cast<boost::optional<int>>(change.tokenUsages);
+    if (change.isChanged(Field::TOKEN_BLOCKED)) {
+        tokenBlocked = change.tokenBlocked;
+    }
+    if (change.isChanged(Field::TOKEN_BRANCH_NUMBER)) {
+        tokenBranchNumber = change.tokenBranchNumber;
+    }
+    if (change.isChanged(Field::METADATA)) {
+        metadata = change.metadata;
+    }
+    if (change.isChanged(Field::CELL_FEATURE)) {
+        cellFeature = change.cellFeatures;
+    }
+    if (change.isChanged(Field::TOKENS)) {
+        tokens = change.tokens;
+    }
+    if (change.isChanged(Field::TOKEN_USAGES)) {
+        tokenUsages = change.tokenUsages;
+    }
+    return *this;
 }
 
-CellDescription& CellDescription::addToken(TokenDescription const& value)
+CellDescription& CellDescription::addToken(TokenDescription value)
 {
-    tokens.emplace_back(value);
+    tokens.emplace_back(std::move(value));
     return *this;
 }
 
-CellDescription& CellDescription::addToken(int index, TokenDescription const& value)
+CellDescription& CellDescription::addToken(int index, TokenDescription value)
 {
-    tokens.insert(tokens.begin() + index, value);
+    tokens.insert(tokens.begin() + index, std::move(value));
     return *this;
 }
 
@@ -163,6 +222,146 @@ ClusterDescription& ClusterDescription::addConnection(
     return *this;
 }
 
+namespace
+{
+    int const MinCellsPerChunk = 4096;
+
+    struct ConnectionEntry
+    {
+        float angle;
+        float distance;
+        uint64_t cellId;
+    };
+
+    //same convention as Math::angleOfVector: 0 degree points to negative y, angles increase clockwise
+    float calcAngle(RealVector2D const& delta)
+    {
+        float result;
+        Math::anglesOfVectors(&delta, &result, 1);
+        return result;
+    }
+}
+
+ClusterDescription& ClusterDescription::addConnections(std::vector<std::pair<uint64_t, uint64_t>> const& cellIdPairs)
+{
+    TRACE_SCOPE("ClusterDescription", "add connections");
+
+    auto numCells = toInt(cells.size());
+    FlatHashMap<int> cellIndicesByIds;
+    cellIndicesByIds.reserve(numCells);
+    for (int index = 0; index < numCells; ++index) {
+        cellIndicesByIds.insert_or_assign(cells[index].id, index);
+    }
+
+    //new connections of both directions in compressed sparse row layout
+    std::vector<std::pair<int, int>> cellIndexPairs;
+    cellIndexPairs.reserve(cellIdPairs.size());
+    std::vector<int> offsets(numCells + 1, 0);
+    for (auto const& [cellId1, cellId2] : cellIdPairs) {
+        auto index1 = cellIndicesByIds.at(cellId1);
+        auto index2 = cellIndicesByIds.at(cellId2);
+        if (index1 == index2) {
+            throw std::invalid_argument("Cell " + std::to_string(cellId1) + " cannot be connected to itself.");
+        }
+        cellIndexPairs.emplace_back(index1, index2);
+        ++offsets[index1 + 1];
+        ++offsets[index2 + 1];
+    }
+    for (int index = 0; index < numCells; ++index) {
+        offsets[index + 1] += offsets[index];
+        auto const& cell = cells[index];
+        CHECK(toInt(cell.connections.size()) + offsets[index + 1] - offsets[index] <= cell.maxConnections);
+    }
+    std::vector<int> otherCellIndices(offsets.back());
+    {
+        auto cursors = offsets;
+        for (auto const& [index1, index2] : cellIndexPairs) {
+            otherCellIndices[cursors[index1]++] = index2;
+            otherCellIndices[cursors[index2]++] = index1;
+        }
+    }
+    for (int index = 0; index < numCells; ++index) {
+        auto const& cell = cells[index];
+        for (int k = offsets[index]; k < offsets[index + 1]; ++k) {
+            auto otherCellId = cells[otherCellIndices[k]].id;
+            auto isNewDuplicate = std::find(
+                otherCellIndices.begin() + offsets[index], otherCellIndices.begin() + k, otherCellIndices[k])
+                != otherCellIndices.begin() + k;
+            auto isExistingDuplicate = std::any_of(
+                cell.connections.begin(), cell.connections.end(), [&](auto const& connection) {
+                    return connection.cellId == otherCellId;
+                });
+            if (isNewDuplicate || isExistingDuplicate) {
+                throw std::invalid_argument(
+                    "Cells " + std::to_string(cell.id) + " and " + std::to_string(otherCellId)
+                    + " are connected twice.");
+            }
+        }
+    }
+
+    //geometry of all new connections in one pass, the connections of a chunk are stored contiguously
+    std::vector<RealVector2D> deltas(otherCellIndices.size());
+    std::vector<float> distances(otherCellIndices.size());
+    std::vector<float> angles(otherCellIndices.size());
+    Parallel::forEachChunk(numCells, MinCellsPerChunk, [&](int, int begin, int end) {
+        for (int index = begin; index < end; ++index) {
+            auto const& pos = cells[index].pos;
+            for (int k = offsets[index]; k < offsets[index + 1]; ++k) {
+                deltas[k] = cells[otherCellIndices[k]].pos - pos;
+            }
+        }
+        auto chunkBegin = offsets[begin];
+        auto chunkSize = offsets[end] - chunkBegin;
+        Math::lengths(deltas.data() + chunkBegin, distances.data() + chunkBegin, chunkSize);
+        Math::anglesOfVectors(deltas.data() + chunkBegin, angles.data() + chunkBegin, chunkSize);
+    });
+
+    //merge with existing connections (the first one stays first as in addConnection) and sort by angle
+    Parallel::forEachChunk(numCells, MinCellsPerChunk, [&](int, int begin, int end) {
+        std::vector<ConnectionEntry> entries;
+        for (int index = begin; index < end; ++index) {
+            if (offsets[index] == offsets[index + 1]) {
+                continue;
+            }
+            auto& cell = cells[index];
+            entries.clear();
+            if (!cell.connections.empty()) {
+                auto firstCellIndex = cellIndicesByIds.find(cell.connections.front().cellId);
+                auto angle = firstCellIndex ? calcAngle(cells[*firstCellIndex].pos - cell.pos) : 0.0f;
+                for (int i = 0; i < cell.connections.size(); ++i) {
+                    auto const& connection = cell.connections[i];
+                    if (i > 0) {
+                        angle += connection.angleFromPrevious;
+                    }
+                    entries.emplace_back(ConnectionEntry{angle, connection.distance, connection.cellId});
+                }
+            }
+            for (int k = offsets[index]; k < offsets[index + 1]; ++k) {
+                entries.emplace_back(ConnectionEntry{angles[k], distances[k], cells[otherCellIndices[k]].id});
+            }
+
+            auto referenceAngle = entries.front().angle;
+            for (auto& entry : entries) {
+                entry.angle = std::fmod(entry.angle - referenceAngle + 720.0f, 360.0f);
+            }
+            entries.front().angle = 0;
+            std::stable_sort(entries.begin() + 1, entries.end(), [](auto const& entry1, auto const& entry2) {
+                return entry1.angle < entry2.angle;
+            });
+
+            cell.connections.resize(entries.size());
+            for (int i = 0; i < entries.size(); ++i) {
+                auto& connection = cell.connections[i];
+                connection.cellId = entries[i].cellId;
+                connection.distance = entries[i].distance;
+                connection.angleFromPrevious =
+                    i == 0 ? 360.0f - entries.back().angle : entries[i].angle - entries[i - 1].angle;
+            }
+        }
+    });
+    return *this;
+}
+
 RealVector2D ClusterDescription::getClusterPosFromCells() const
 {
     RealVector2D result;
@@ -191,29 +390,44 @@ CellDescription& ClusterDescription::getCellRef(uint64_t const& cellId, std::uno
 
 ParticleDescription::ParticleDescription(ParticleChangeDescription const& change)
 {
+    if (change.changedFields != ParticleChangeDescription::Field::ALL) {
+        throw std::invalid_argument(
+            "Change of particle " + std::to_string(change.id) + " does not contain all fields.");
+    }
+    applyChange(change);
+}
+
+ParticleDescription& ParticleDescription::applyChange(ParticleChangeDescription const& change)
+{
+    using Field = ParticleChangeDescription::Field;
     id = change.id;
-    pos = *static_cast<boost::optional<RealVector2D>>(change.pos);
-    vel = *static_cast<boost::optional<RealVector2D>>(change.vel);
-    energy = *static_cast<boost::optional<double>>(change.energy);
-    metadata = *static_cast<boost::optional<ParticleMetadata>>(change.metadata);
+    if (change.isChanged(Field::POS)) {
+        pos = change.pos;
+    }
+    if (change.isChanged(Field::VEL)) {
+        vel = change.vel;
+    }
+    if (change.isChanged(Field::ENERGY)) {
+        energy = change.energy;
+    }
+    if (change.isChanged(Field::METADATA)) {
+        metadata = change.metadata;
+    }
+    return *this;
 }
 
 RealVector2D DataDescription::calcCenter() const
 {
-    RealVector2D result;
-    int numEntities = 0;
+    std::vector<RealVector2D> positions;
     for (auto const& cluster : clusters) {
         for (auto const& cell : cluster.cells) {
-            result += cell.pos;
-            ++numEntities;
+            positions.emplace_back(cell.pos);
         }
     }
     for (auto const& particle : particles) {
-        result += particle.pos;
-        ++numEntities;
+        positions.emplace_back(particle.pos);
     }
-    result /= numEntities;
-    return result;
+    return Physics::calcCenterOfMass(positions.data(), toInt(positions.size()));
 }
 
 void DataDescription::shift(RealVector2D const& delta)
@@ -227,3 +441,124 @@ void DataDescription::shift(RealVector2D const& delta)
         particle.pos += delta;
     }
 }
+
+void DescriptionNavigator::update(DataDescription const& data)
+{
+    clear();
+
+    int numCells = 0;
+    for (auto const& cluster : data.clusters) {
+        numCells += toInt(cluster.cells.size());
+    }
+    clusterIdsByCellIds.reserve(numCells);
+    clusterIndicesByClusterIds.reserve(toInt(data.clusters.size()));
+    clusterIndicesByCellIds.reserve(numCells);
+    cellIndicesByCellIds.reserve(numCells);
+    particleIndicesByParticleIds.reserve(toInt(data.particles.size()));
+
+    for (int clusterIndex = 0; clusterIndex < data.clusters.size(); ++clusterIndex) {
+        indexCluster(data.clusters.at(clusterIndex), clusterIndex);
+    }
+    _numIndexedClusters = toInt(data.clusters.size());
+    indexParticles(data, 0);
+}
+
+void DescriptionNavigator::update(DataDescription const& data, DataChangeDescription const& changes)
+{
+    std::vector<int> modifiedClusterIndices;
+    for (auto const& cell : changes.cells) {
+        if (!cell.isDeleted()) {
+            continue;
+        }
+        if (auto clusterIndex = clusterIndicesByCellIds.find(cell->id)) {
+            modifiedClusterIndices.emplace_back(*clusterIndex);
+        }
+        clusterIdsByCellIds.erase(cell->id);
+        clusterIndicesByCellIds.erase(cell->id);
+        cellIndicesByCellIds.erase(cell->id);
+    }
+
+    //subsequent particles are shifted by deletions
+    auto firstModifiedParticleIndex = particleIndicesByParticleIds.size();
+    for (auto const& particle : changes.particles) {
+        if (!particle.isDeleted()) {
+            continue;
+        }
+        if (auto particleIndex = particleIndicesByParticleIds.find(particle->id)) {
+            firstModifiedParticleIndex = std::min(firstModifiedParticleIndex, *particleIndex);
+        }
+        particleIndicesByParticleIds.erase(particle->id);
+    }
+
+    if (data.clusters.size() < _numIndexedClusters) {
+        update(data);
+        return;
+    }
+    std::sort(modifiedClusterIndices.begin(), modifiedClusterIndices.end());
+    modifiedClusterIndices.erase(
+        std::unique(modifiedClusterIndices.begin(), modifiedClusterIndices.end()), modifiedClusterIndices.end());
+    for (auto const& clusterIndex : modifiedClusterIndices) {
+        if (!isClusterIndexValid(data, clusterIndex)) {
+            update(data);
+            return;
+        }
+        indexCluster(data.clusters.at(clusterIndex), clusterIndex);
+    }
+    for (int clusterIndex = _numIndexedClusters; clusterIndex < data.clusters.size(); ++clusterIndex) {
+        indexCluster(data.clusters.at(clusterIndex), clusterIndex);
+    }
+    _numIndexedClusters = toInt(data.clusters.size());
+    indexParticles(data, firstModifiedParticleIndex);
+
+    //cells may also have been added to existing clusters
+    for (auto const& cell : changes.cells) {
+        if (cell.isAdded() && cell->id != 0 && !containsCell(cell->id)) {
+            update(data);
+            return;
+        }
+    }
+    for (auto const& particle : changes.particles) {
+        if (particle.isAdded() && particle->id != 0 && !containsParticle(particle->id)) {
+            update(data);
+            return;
+        }
+    }
+}
+
+void DescriptionNavigator::clear()
+{
+    clusterIdsByCellIds.clear();
+    clusterIndicesByClusterIds.clear();
+    clusterIndicesByCellIds.clear();
+    cellIndicesByCellIds.clear();
+    particleIndicesByParticleIds.clear();
+    _numIndexedClusters = 0;
+}
+
+void DescriptionNavigator::indexCluster(ClusterDescription const& cluster, int clusterIndex)
+{
+    clusterIndicesByClusterIds.insert_or_assign(cluster.id, clusterIndex);
+    int cellIndex = 0;
+    for (auto const& cell : cluster.cells) {
+        clusterIdsByCellIds.insert_or_assign(cell.id, cluster.id);
+        clusterIndicesByCellIds.insert_or_assign(cell.id, clusterIndex);
+        cellIndicesByCellIds.insert_or_assign(cell.id, cellIndex);
+        ++cellIndex;
+    }
+}
+
+void DescriptionNavigator::indexParticles(DataDescription const& data, int startIndex)
+{
+    for (int particleIndex = startIndex; particleIndex < data.particles.size(); ++particleIndex) {
+        particleIndicesByParticleIds.insert_or_assign(data.particles.at(particleIndex).id, particleIndex);
+    }
+}
+
+bool DescriptionNavigator::isClusterIndexValid(DataDescription const& data, int clusterIndex) const
+{
+    if (clusterIndex >= data.clusters.size()) {
+        return false;
+    }
+    auto indexedClusterIndex = clusterIndicesByClusterIds.find(data.clusters.at(clusterIndex).id);
+    return indexedClusterIndex && *indexedClusterIndex == clusterIndex;
+}
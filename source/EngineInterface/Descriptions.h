@@ -1,27 +1,55 @@
 #pragma once
 
 #include "Base/Definitions.h"
+#include "Base/FlatHashMap.h"
 
 #include "Definitions.h"
 #include "Metadata.h"
 #include "DllExport.h"
 
+/**
+ * The description types can allocate their nested containers and strings from a memory resource. An allocator passed
+ * to a container of descriptions is propagated to the elements, hence a whole tree can be placed in an arena, see
+ * DescriptionArena.
+ */
 struct CellFeatureDescription
 {
-	std::string volatileData;
-    std::string constData;
+    using allocator_type = DescriptionAllocator;
+
+	DescriptionString volatileData;
+    DescriptionString constData;
+
+    CellFeatureDescription() = default;
+    explicit CellFeatureDescription(allocator_type const& allocator)
+        : volatileData(allocator)
+        , constData(allocator)
+    {}
+    CellFeatureDescription(CellFeatureDescription const& other, allocator_type const& allocator)
+        : volatileData(other.volatileData, allocator)
+        , constData(other.constData, allocator)
+        , _type(other._type)
+    {}
+    CellFeatureDescription(CellFeatureDescription&& other, allocator_type const& allocator)
+        : volatileData(std::move(other.volatileData), allocator)
+        , constData(std::move(other.constData), allocator)
+        , _type(other._type)
+    {}
+    CellFeatureDescription(CellFeatureDescription const& other) = default;
+    CellFeatureDescription(CellFeatureDescription&& other) = default;
+    CellFeatureDescription& operator=(CellFeatureDescription const& other) = default;
+    CellFeatureDescription& operator=(CellFeatureDescription&& other) = default;
 
     Enums::CellFunction::Type getType() const
     {
         return static_cast<Enums::CellFunction::Type>(static_cast<unsigned char>(_type) % Enums::CellFunction::_COUNTER);
     }
 	CellFeatureDescription& setType(Enums::CellFunction::Type value) { _type = value; return *this; }
-    CellFeatureDescription& setVolatileData(std::string const& value)
+    CellFeatureDescription& setVolatileData(std::string_view value)
     {
         volatileData = value;
         return *this;
     }
-    CellFeatureDescription& setConstData(std::string const& value)
+    CellFeatureDescription& setConstData(std::string_view value)
     {
         constData = value;
         return *this;
@@ -39,15 +67,34 @@ private:
 
 struct TokenDescription
 {
+    using allocator_type = DescriptionAllocator;
+
     double energy = 0;
-    std::string data;
+    DescriptionString data;
+
+    TokenDescription() = default;
+    explicit TokenDescription(allocator_type const& allocator)
+        : data(allocator)
+    {}
+    TokenDescription(TokenDescription const& other, allocator_type const& allocator)
+        : energy(other.energy)
+        , data(other.data, allocator)
+    {}
+    TokenDescription(TokenDescription&& other, allocator_type const& allocator)
+        : energy(other.energy)
+        , data(std::move(other.data), allocator)
+    {}
+    TokenDescription(TokenDescription const& other) = default;
+    TokenDescription(TokenDescription&& other) = default;
+    TokenDescription& operator=(TokenDescription const& other) = default;
+    TokenDescription& operator=(TokenDescription&& other) = default;
 
     TokenDescription& setEnergy(double value)
     {
         energy = value;
         return *this;
     }
-    TokenDescription& setData(std::string const& value)
+    TokenDescription& setData(std::string_view value)
     {
         data = value;
         return *this;
@@ -65,22 +112,38 @@ struct ConnectionDescription
 
 struct CellDescription
 {
+    using allocator_type = DescriptionAllocator;
+
     uint64_t id = 0;
 
     RealVector2D pos;
     RealVector2D vel;
     double energy;
     int maxConnections;
-    std::vector<ConnectionDescription> connections;
+    DescriptionVector<ConnectionDescription> connections;
     bool tokenBlocked;
     int tokenBranchNumber;
     CellMetadata metadata;
     CellFeatureDescription cellFeature;
-    std::vector<TokenDescription> tokens;
+    DescriptionVector<TokenDescription> tokens;
     int tokenUsages;
 
     ENGINEINTERFACE_EXPORT CellDescription() = default;
-    ENGINEINTERFACE_EXPORT CellDescription(CellChangeDescription const& change);
+    ENGINEINTERFACE_EXPORT explicit CellDescription(allocator_type const& allocator);
+    ENGINEINTERFACE_EXPORT CellDescription(CellDescription const& other, allocator_type const& allocator);
+    ENGINEINTERFACE_EXPORT CellDescription(CellDescription&& other, allocator_type const& allocator);
+    CellDescription(CellDescription const& other) = default;
+    CellDescription(CellDescription&& other) = default;
+    CellDescription& operator=(CellDescription const& other) = default;
+    CellDescription& operator=(CellDescription&& other) = default;
+    //change has to contain all fields, e.g. for a new cell, throws std::invalid_argument otherwise
+    ENGINEINTERFACE_EXPORT CellDescription(
+        CellChangeDescription const& change,
+        allocator_type const& allocator = allocator_type());
+
+    //overwrites the fields flagged in change.changedFields
+    ENGINEINTERFACE_EXPORT CellDescription& applyChange(CellChangeDescription const& change);
+
     CellDescription& setId(uint64_t value)
     {
         id = value;
@@ -106,9 +169,9 @@ struct CellDescription
         maxConnections = value;
         return *this;
     }
-    CellDescription& setConnectingCells(std::vector<ConnectionDescription> const& value)
+    CellDescription& setConnectingCells(DescriptionVector<ConnectionDescription> value)
     {
-        connections = value;
+        connections = std::move(value);
         return *this;
     }
     CellDescription& setFlagTokenBlocked(bool value)
@@ -121,23 +184,23 @@ struct CellDescription
         tokenBranchNumber = value;
         return *this;
     }
-    CellDescription& setMetadata(CellMetadata const& value)
+    CellDescription& setMetadata(CellMetadata value)
     {
-        metadata = value;
+        metadata = std::move(value);
         return *this;
     }
-    CellDescription& setCellFeature(CellFeatureDescription const& value)
+    CellDescription& setCellFeature(CellFeatureDescription value)
     {
-        cellFeature = value;
+        cellFeature = std::move(value);
         return *this;
     }
-    CellDescription& setTokens(vector<TokenDescription> const& value)
+    CellDescription& setTokens(DescriptionVector<TokenDescription> value)
     {
-        tokens = value;
+        tokens = std::move(value);
         return *this;
     }
-    ENGINEINTERFACE_EXPORT CellDescription& addToken(TokenDescription const& value);
-    ENGINEINTERFACE_EXPORT CellDescription& addToken(int index, TokenDescription const& value);
+    ENGINEINTERFACE_EXPORT CellDescription& addToken(TokenDescription value);
+    ENGINEINTERFACE_EXPORT CellDescription& addToken(int index, TokenDescription value);
     ENGINEINTERFACE_EXPORT CellDescription& delToken(int index);
     CellDescription& setTokenUsages(int value)
     {
@@ -149,31 +212,67 @@ struct CellDescription
 
 struct ClusterDescription
 {
+    using allocator_type = DescriptionAllocator;
+
     uint64_t id = 0;
 
-    std::vector<CellDescription> cells;
+    DescriptionVector<CellDescription> cells;
 
     ENGINEINTERFACE_EXPORT ClusterDescription() = default;
+    explicit ClusterDescription(allocator_type const& allocator)
+        : cells(allocator)
+    {}
+    ClusterDescription(ClusterDescription const& other, allocator_type const& allocator)
+        : id(other.id)
+        , cells(other.cells, allocator)
+    {}
+    ClusterDescription(ClusterDescription&& other, allocator_type const& allocator)
+        : id(other.id)
+        , cells(std::move(other.cells), allocator)
+    {}
+    ClusterDescription(ClusterDescription const& other) = default;
+    ClusterDescription(ClusterDescription&& other) = default;
+    ClusterDescription& operator=(ClusterDescription const& other) = default;
+    ClusterDescription& operator=(ClusterDescription&& other) = default;
 
     ClusterDescription& setId(uint64_t value)
     {
         id = value;
         return *this;
     }
-    ClusterDescription& addCells(std::vector<CellDescription> const& value)
+    ClusterDescription& addCells(DescriptionVector<CellDescription> value)
     {
-        cells.insert(cells.end(), value.begin(), value.end());
+        if (cells.empty()) {
+            cells = std::move(value);
+        } else {
+            cells.insert(cells.end(), std::make_move_iterator(value.begin()), std::make_move_iterator(value.end()));
+        }
         return *this;
     }
-    ClusterDescription& addCell(CellDescription const& value)
+    ClusterDescription& addCell(CellDescription value)
     {
-        addCells({value});
+        cells.emplace_back(std::move(value));
+        return *this;
+    }
+    template <typename... Args>
+    CellDescription& emplaceCell(Args&&... args)
+    {
+        return cells.emplace_back(std::forward<Args>(args)...);
+    }
+    ClusterDescription& reserve(int numCells)
+    {
+        cells.reserve(numCells);
         return *this;
     }
 
     ENGINEINTERFACE_EXPORT ClusterDescription&
     addConnection(uint64_t const& cellId1, uint64_t const& cellId2, std::unordered_map<uint64_t, int>& cache);
 
+    //adds many connections at once, cells are looked up only once and connections are sorted by angle per cell
+    //throws std::invalid_argument for self-connections and pairs which occur twice or are already connected
+    ENGINEINTERFACE_EXPORT ClusterDescription&
+    addConnections(std::vector<std::pair<uint64_t, uint64_t>> const& cellIdPairs);
+
     ENGINEINTERFACE_EXPORT RealVector2D getClusterPosFromCells() const;
 
 private:
@@ -190,7 +289,12 @@ struct ParticleDescription
     ParticleMetadata metadata;
 
     ENGINEINTERFACE_EXPORT ParticleDescription() = default;
+    //change has to contain all fields, e.g. for a new particle, throws std::invalid_argument otherwise
     ENGINEINTERFACE_EXPORT ParticleDescription(ParticleChangeDescription const& change);
+
+    //overwrites the fields flagged in change.changedFields
+    ENGINEINTERFACE_EXPORT ParticleDescription& applyChange(ParticleChangeDescription const& change);
+
     ParticleDescription& setId(uint64_t value)
     {
         id = value;
@@ -220,29 +324,75 @@ struct ParticleDescription
 
 struct DataDescription
 {
-    vector<ClusterDescription> clusters;
-    vector<ParticleDescription> particles;
+    using allocator_type = DescriptionAllocator;
+
+    DescriptionVector<ClusterDescription> clusters;
+    DescriptionVector<ParticleDescription> particles;
 
     ENGINEINTERFACE_EXPORT DataDescription() = default;
-    DataDescription& addClusters(std::vector<ClusterDescription> const& value)
+    explicit DataDescription(allocator_type const& allocator)
+        : clusters(allocator)
+        , particles(allocator)
+    {}
+    DataDescription(DataDescription const& other, allocator_type const& allocator)
+        : clusters(other.clusters, allocator)
+        , particles(other.particles, allocator)
+    {}
+    DataDescription(DataDescription&& other, allocator_type const& allocator)
+        : clusters(std::move(other.clusters), allocator)
+        , particles(std::move(other.particles), allocator)
+    {}
+    DataDescription(DataDescription const& other) = default;
+    DataDescription(DataDescription&& other) = default;
+    DataDescription& operator=(DataDescription const& other) = default;
+    DataDescription& operator=(DataDescription&& other) = default;
+
+    allocator_type get_allocator() const { return clusters.get_allocator(); }
+    DataDescription& addClusters(DescriptionVector<ClusterDescription> value)
     {
-        clusters.insert(clusters.end(), value.begin(), value.end());
+        if (clusters.empty()) {
+            clusters = std::move(value);
+        } else {
+            clusters.insert(
+                clusters.end(), std::make_move_iterator(value.begin()), std::make_move_iterator(value.end()));
+        }
         return *this;
     }
-    DataDescription& addCluster(ClusterDescription const& value)
+    DataDescription& addCluster(ClusterDescription value)
     {
-        addClusters({value});
+        clusters.emplace_back(std::move(value));
         return *this;
     }
+    template <typename... Args>
+    ClusterDescription& emplaceCluster(Args&&... args)
+    {
+        return clusters.emplace_back(std::forward<Args>(args)...);
+    }
 
-    DataDescription& addParticles(std::vector<ParticleDescription> const& value)
+    DataDescription& addParticles(DescriptionVector<ParticleDescription> value)
+    {
+        if (particles.empty()) {
+            particles = std::move(value);
+        } else {
+            particles.insert(
+                particles.end(), std::make_move_iterator(value.begin()), std::make_move_iterator(value.end()));
+        }
+        return *this;
+    }
+    DataDescription& addParticle(ParticleDescription value)
     {
-        particles.insert(particles.end(), value.begin(), value.end());
+        particles.emplace_back(std::move(value));
         return *this;
     }
-    DataDescription& addParticle(ParticleDescription const& value)
+    template <typename... Args>
+    ParticleDescription& emplaceParticle(Args&&... args)
+    {
+        return particles.emplace_back(std::forward<Args>(args)...);
+    }
+    DataDescription& reserve(int numClusters, int numParticles)
     {
-        addParticles({value});
+        clusters.reserve(numClusters);
+        particles.reserve(numParticles);
         return *this;
     }
     void clear()
@@ -265,45 +415,29 @@ struct DataDescription
 };
 
 
+/**
+ * Id lookups for a DataDescription. update(data, changes) updates the tables only for the entities affected by the
+ * changes, provided that added clusters and particles have been appended. Otherwise the tables are rebuilt.
+ */
 struct DescriptionNavigator
 {
-	std::unordered_set<uint64_t> cellIds;
-    std::unordered_set<uint64_t> particleIds;
-    std::map<uint64_t, uint64_t> clusterIdsByCellIds;
-    std::map<uint64_t, int> clusterIndicesByClusterIds;
-    std::map<uint64_t, int> clusterIndicesByCellIds;
-    std::map<uint64_t, int> cellIndicesByCellIds;
-    std::map<uint64_t, int> particleIndicesByParticleIds;
-
-	void update(DataDescription const& data)
-	{
-		cellIds.clear();
-		particleIds.clear();
-		clusterIdsByCellIds.clear();
-		clusterIndicesByCellIds.clear();
-		clusterIndicesByClusterIds.clear();
-		cellIndicesByCellIds.clear();
-		particleIndicesByParticleIds.clear();
-
-		int clusterIndex = 0;
-		for (auto const &cluster : data.clusters) {
-			clusterIndicesByClusterIds.insert_or_assign(cluster.id, clusterIndex);
-			int cellIndex = 0;
-			for (auto const &cell : cluster.cells) {
-				clusterIdsByCellIds.insert_or_assign(cell.id, cluster.id);
-				clusterIndicesByCellIds.insert_or_assign(cell.id, clusterIndex);
-				cellIndicesByCellIds.insert_or_assign(cell.id, cellIndex);
-				cellIds.insert(cell.id);
-				++cellIndex;
-			}
-			++clusterIndex;
-		}
-
-		int particleIndex = 0;
-		for (auto const &particle : data.particles) {
-			particleIndicesByParticleIds.insert_or_assign(particle.id, particleIndex);
-			particleIds.insert(particle.id);
-			++particleIndex;
-		}
-	}
+    FlatHashMap<uint64_t> clusterIdsByCellIds;
+    FlatHashMap<int> clusterIndicesByClusterIds;
+    FlatHashMap<int> clusterIndicesByCellIds;
+    FlatHashMap<int> cellIndicesByCellIds;
+    FlatHashMap<int> particleIndicesByParticleIds;
+
+    bool containsCell(uint64_t id) const { return cellIndicesByCellIds.contains(id); }
+    bool containsParticle(uint64_t id) const { return particleIndicesByParticleIds.contains(id); }
+
+    ENGINEINTERFACE_EXPORT void update(DataDescription const& data);
+    ENGINEINTERFACE_EXPORT void update(DataDescription const& data, DataChangeDescription const& changes);
+
+private:
+    void clear();
+    void indexCluster(ClusterDescription const& cluster, int clusterIndex);
+    void indexParticles(DataDescription const& data, int startIndex);
+    bool isClusterIndexValid(DataDescription const& data, int clusterIndex) const;
+
+    int _numIndexedClusters = 0;
 };
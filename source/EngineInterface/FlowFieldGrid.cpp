@@ -0,0 +1,75 @@
+#include "FlowFieldGrid.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Base/Tracing.h"
+
+float FlowFieldGrid::calcHeight(
+    std::vector<FlowCenter> const& centers,
+    RealVector2D const& pos,
+    IntVector2D const& worldSize)
+{
+    float result = 0;
+    for (auto const& center : centers) {
+        auto dx = std::remainder(pos.x - center.posX, toFloat(worldSize.x));
+        auto dy = std::remainder(pos.y - center.posY, toFloat(worldSize.y));
+        auto distance = std::min(std::sqrt(dx * dx + dy * dy), center.radius);
+        if (Orientation::Clockwise == center.orientation) {
+            result += std::sqrt(distance) * center.strength;
+        } else {
+            result -= std::sqrt(distance) * center.strength;
+        }
+    }
+    return result;
+}
+
+RealVector2D FlowFieldGrid::calcVelocity(
+    std::vector<FlowCenter> const& centers,
+    RealVector2D const& pos,
+    IntVector2D const& worldSize)
+{
+    auto baseValue = calcHeight(centers, pos, worldSize);
+    auto downValue = calcHeight(centers, pos + RealVector2D{0, 1}, worldSize);
+    auto rightValue = calcHeight(centers, pos + RealVector2D{1, 0}, worldSize);
+
+    //gradient rotated by a quarter clockwise
+    return {baseValue - downValue, rightValue - baseValue};
+}
+
+std::vector<FlowCenter> FlowFieldGrid::getCenters(FlowFieldSettings const& settings)
+{
+    auto numCenters = std::clamp(settings.numCenters, 0, FlowFieldSettings::MaxCenters);
+    return std::vector<FlowCenter>(settings.centers, settings.centers + numCenters);
+}
+
+bool FlowFieldGrid::update(std::vector<FlowCenter> const& centers, IntVector2D const& worldSize)
+{
+    if (_isValid && centers == _centers && worldSize == _worldSize) {
+        return false;
+    }
+    TRACE_SCOPE("FlowFieldGrid", "build");
+    _centers = centers;
+    _worldSize = worldSize;
+    _isValid = true;
+
+    _grid = PeriodicGrid(worldSize, _spacing, 2);
+    _grid.fill([&](RealVector2D const& pos, float* velocity) {
+        auto value = calcVelocity(centers, pos, worldSize);
+        velocity[0] = value.x;
+        velocity[1] = value.y;
+    });
+    return true;
+}
+
+RealVector2D FlowFieldGrid::sampleVelocity(RealVector2D const& pos) const
+{
+    RealVector2D result;
+    _grid.sample(pos, &result.x);
+    return result;
+}
+
+void FlowFieldGrid::sampleVelocities(RealVector2D const* positions, int count, RealVector2D* result) const
+{
+    _grid.sample(positions, count, &result[0].x);
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <vector>
+
+#include "Base/PeriodicGrid.h"
+
+#include "Definitions.h"
+#include "DllExport.h"
+#include "FlowFieldSettings.h"
+
+/**
+ * Velocities of the flow field rasterized on a grid, so that evaluating the flow costs a bilinear lookup independent
+ * of the number of centers. The grid is rebuilt only if the centers or the world size change. It is uploaded and
+ * sampled by the flow field kernel, the analytic functions serve as reference.
+ */
+class FlowFieldGrid
+{
+public:
+    static float constexpr DefaultSpacing = 4.0f;
+
+    //analytic flow as in FlowFieldKernel
+    ENGINEINTERFACE_EXPORT static float
+    calcHeight(std::vector<FlowCenter> const& centers, RealVector2D const& pos, IntVector2D const& worldSize);
+    ENGINEINTERFACE_EXPORT static RealVector2D
+    calcVelocity(std::vector<FlowCenter> const& centers, RealVector2D const& pos, IntVector2D const& worldSize);
+
+    //the active centers of the settings
+    ENGINEINTERFACE_EXPORT static std::vector<FlowCenter> getCenters(FlowFieldSettings const& settings);
+
+    FlowFieldGrid(float spacing = DefaultSpacing)
+        : _spacing(spacing)
+    {}
+
+    //returns true if the grid has been rebuilt
+    ENGINEINTERFACE_EXPORT bool update(std::vector<FlowCenter> const& centers, IntVector2D const& worldSize);
+
+    PeriodicGrid const& getGrid() const { return _grid; }
+
+    ENGINEINTERFACE_EXPORT RealVector2D sampleVelocity(RealVector2D const& pos) const;
+    ENGINEINTERFACE_EXPORT void sampleVelocities(RealVector2D const* positions, int count, RealVector2D* result) const;
+
+private:
+    float _spacing;
+    bool _isValid = false;
+    std::vector<FlowCenter> _centers;
+    IntVector2D _worldSize = {0, 0};
+    PeriodicGrid _grid;
+};
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Base/FieldTable.h"
+
 enum class Orientation
 {
     Clockwise,
@@ -14,24 +16,40 @@ struct FlowCenter
     float strength = 0.01f;
     Orientation orientation = Orientation::Clockwise;
 
-    bool operator==(FlowCenter const& other) const
+    static auto constexpr getFields()
     {
-        return posX == other.posX && posY == other.posY && radius == other.radius && strength == other.strength
-            && orientation == other.orientation;
+        using T = FlowCenter;
+        return std::make_tuple(
+            makeField("pos.x", &T::posX),
+            makeField("pos.y", &T::posY),
+            makeField("radius", &T::radius),
+            makeField("strength", &T::strength),
+            makeField("orientation", &T::orientation));
     }
+
+    bool operator==(FlowCenter const& other) const { return FieldTable::equals(*this, other); }
     bool operator!=(FlowCenter const& other) const { return !operator==(other); }
 };
 
 struct FlowFieldSettings
 {
+    //the simulation samples the rasterized field, see FlowFieldGrid, so the number of centers does not affect its cost
+    static int constexpr MaxCenters = 8;
+
     bool active = false;
 
-    int numCenters = 1; //only 2 centers supported
-    FlowCenter centers[2];
+    int numCenters = 1;
+    FlowCenter centers[MaxCenters];
 
-    bool operator==(FlowFieldSettings const& other) const
+    static auto constexpr getFields()
     {
-        return active == other.active && numCenters == other.numCenters && centers == other.centers;
+        using T = FlowFieldSettings;
+        return std::make_tuple(
+            makeField("active", &T::active),
+            makeField("num centers", &T::numCenters),
+            makeField("center", &T::centers));
     }
+
+    bool operator==(FlowFieldSettings const& other) const { return FieldTable::equals(*this, other); }
     bool operator!=(FlowFieldSettings const& other) const { return !operator==(other); }
 };
@@ -1,7 +1,15 @@
 #pragma once
 
+#include "Base/FieldTable.h"
+
 struct GeneralSettings
 {
     int worldSizeX;
     int worldSizeY;
+
+    static auto constexpr getFields()
+    {
+        using T = GeneralSettings;
+        return std::make_tuple(makeField("world size.x", &T::worldSizeX), makeField("world size.y", &T::worldSizeY));
+    }
 };
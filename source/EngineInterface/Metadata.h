@@ -1,16 +1,42 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 
 #include "Definitions.h"
 
 struct CellMetadata
 {
-	std::string computerSourcecode;
-    std::string name;
-    std::string description;
+    using allocator_type = DescriptionAllocator;
+
+	DescriptionString computerSourcecode;
+    DescriptionString name;
+    DescriptionString description;
     unsigned char color = 0;
 
+    CellMetadata() = default;
+    explicit CellMetadata(allocator_type const& allocator)
+        : computerSourcecode(allocator)
+        , name(allocator)
+        , description(allocator)
+    {}
+    CellMetadata(CellMetadata const& other, allocator_type const& allocator)
+        : computerSourcecode(other.computerSourcecode, allocator)
+        , name(other.name, allocator)
+        , description(other.description, allocator)
+        , color(other.color)
+    {}
+    CellMetadata(CellMetadata&& other, allocator_type const& allocator)
+        : computerSourcecode(std::move(other.computerSourcecode), allocator)
+        , name(std::move(other.name), allocator)
+        , description(std::move(other.description), allocator)
+        , color(other.color)
+    {}
+    CellMetadata(CellMetadata const& other) = default;
+    CellMetadata(CellMetadata&& other) = default;
+    CellMetadata& operator=(CellMetadata const& other) = default;
+    CellMetadata& operator=(CellMetadata&& other) = default;
+
 	bool operator==(CellMetadata const& other) const {
 		return computerSourcecode == other.computerSourcecode
 			&& name == other.name
@@ -19,10 +45,10 @@ struct CellMetadata
 	}
 	bool operator!=(CellMetadata const& other) const { return !operator==(other); }
 
-	CellMetadata& setName(std::string const& value) { name = value; return *this; }
-    CellMetadata& setDescription(std::string const& value) { description = value; return *this; }
+	CellMetadata& setName(std::string_view value) { name = value; return *this; }
+    CellMetadata& setDescription(std::string_view value) { description = value; return *this; }
     CellMetadata& setColor(uint8_t value) { color = value; return *this; }
-    CellMetadata& setSourceCode(std::string const& value) { computerSourcecode = value; return *this; }
+    CellMetadata& setSourceCode(std::string_view value) { computerSourcecode = value; return *this; }
 };
 
 struct ParticleMetadata
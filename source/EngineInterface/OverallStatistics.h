@@ -15,4 +15,8 @@ struct OverallStatistics
     int numSuccessfulAttacks = 0;
     int numFailedAttacks = 0;
     int numMuscleActivities = 0;
+
+    //engine
+    uint64_t numParameterUploads = 0;  //memory transfers of changed settings fields
+    uint64_t parameterUploadBytes = 0;
 };
@@ -0,0 +1,104 @@
+#include "ParameterSchedule.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <type_traits>
+
+#include "Base/FieldTable.h"
+
+#include "Settings.h"
+
+namespace
+{
+    template <typename T>
+    T convertValue(double value)
+    {
+        if constexpr (std::is_same<T, bool>::value) {
+            return value != 0;
+        } else if constexpr (std::is_floating_point<T>::value) {
+            return static_cast<T>(value);
+        } else {
+            return static_cast<T>(std::llround(value));
+        }
+    }
+}
+
+double ParameterSchedule::getValue(uint64_t timestep) const
+{
+    auto nextKeyframe = std::upper_bound(
+        keyframes.begin(), keyframes.end(), timestep, [](uint64_t value, ScheduleKeyframe const& keyframe) {
+            return value < keyframe.timestep;
+        });
+    if (nextKeyframe == keyframes.begin()) {
+        return nextKeyframe->value;
+    }
+    auto prevKeyframe = std::prev(nextKeyframe);
+    if (nextKeyframe == keyframes.end() || interpolation == ScheduleInterpolation::Step) {
+        return prevKeyframe->value;
+    }
+    auto factor = static_cast<double>(timestep - prevKeyframe->timestep)
+        / static_cast<double>(nextKeyframe->timestep - prevKeyframe->timestep);
+    return prevKeyframe->value + (nextKeyframe->value - prevKeyframe->value) * factor;
+}
+
+ParameterSchedules::ParameterSchedules(std::vector<ParameterSchedule> const& schedules)
+{
+    for (auto const& schedule : schedules) {
+        if (schedule.keyframes.empty()) {
+            throw std::invalid_argument("Schedule for '" + schedule.path + "' has no keyframes.");
+        }
+        auto isAscending = std::is_sorted(
+            schedule.keyframes.begin(), schedule.keyframes.end(), [](auto const& keyframe1, auto const& keyframe2) {
+                return keyframe1.timestep < keyframe2.timestep;
+            });
+        if (!isAscending) {
+            throw std::invalid_argument("Keyframes for '" + schedule.path + "' are not in ascending order.");
+        }
+        auto isDuplicate = std::any_of(
+            _entries.begin(), _entries.end(), [&](Entry const& entry) { return entry.schedule.path == schedule.path; });
+        if (isDuplicate) {
+            throw std::invalid_argument("Parameter '" + schedule.path + "' is scheduled more than once.");
+        }
+
+        //the setter addresses the field by its offset inside Settings
+        Settings settings = Settings();
+        std::function<void(Settings&, double)> setter;
+        std::function<void(Settings const&, Settings&)> copier;
+        FieldTable::forEachLeaf(settings, settings, "", [&](std::string const& path, auto& field, auto const&) {
+            if (path != schedule.path) {
+                return;
+            }
+            using T = std::remove_reference_t<decltype(field)>;
+            auto offset = reinterpret_cast<char*>(&field) - reinterpret_cast<char*>(&settings);
+            setter = [offset](Settings& target, double value) {
+                *reinterpret_cast<T*>(reinterpret_cast<char*>(&target) + offset) = convertValue<T>(value);
+            };
+            copier = [offset](Settings const& source, Settings& target) {
+                *reinterpret_cast<T*>(reinterpret_cast<char*>(&target) + offset) =
+                    *reinterpret_cast<T const*>(reinterpret_cast<char const*>(&source) + offset);
+            };
+        });
+
+        //general settings cannot change during a simulation
+        auto isGeneralSettings = schedule.path.rfind("general.", 0) == 0;
+        if (!setter || isGeneralSettings) {
+            throw std::invalid_argument("Unknown parameter '" + schedule.path + "'.");
+        }
+        _entries.emplace_back(Entry{schedule, setter, copier});
+    }
+}
+
+void ParameterSchedules::apply(uint64_t timestep, Settings& settings) const
+{
+    for (auto const& entry : _entries) {
+        entry.setter(settings, entry.schedule.getValue(timestep));
+    }
+}
+
+void ParameterSchedules::copyScheduledFields(Settings const& source, Settings& target) const
+{
+    for (auto const& entry : _entries) {
+        entry.copier(source, target);
+    }
+}
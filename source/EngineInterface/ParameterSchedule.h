@@ -0,0 +1,62 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "Definitions.h"
+#include "DllExport.h"
+
+enum class ScheduleInterpolation
+{
+    Linear,
+    Step
+};
+
+struct ScheduleKeyframe
+{
+    uint64_t timestep = 0;
+    double value = 0;
+};
+
+/**
+ * Value of a settings field as a function of the time step, given by keyframes in ascending order of time steps.
+ * Before the first and after the last keyframe the value is constant.
+ */
+struct ParameterSchedule
+{
+    std::string path;  //as in the settings file, e.g. "simulation parameters.radiation.probability"
+    ScheduleInterpolation interpolation = ScheduleInterpolation::Linear;
+    std::vector<ScheduleKeyframe> keyframes;
+
+    ENGINEINTERFACE_EXPORT double getValue(uint64_t timestep) const;
+};
+
+/**
+ * Schedules whose paths are resolved to the fields of simulation parameters, spots and flow field settings.
+ * Integer and enum fields are rounded, bool fields are true for non-zero values.
+ */
+class ParameterSchedules
+{
+public:
+    ParameterSchedules() = default;
+
+    //throws std::invalid_argument for unknown or duplicate paths and invalid keyframes
+    ENGINEINTERFACE_EXPORT ParameterSchedules(std::vector<ParameterSchedule> const& schedules);
+
+    bool isEmpty() const { return _entries.empty(); }
+
+    ENGINEINTERFACE_EXPORT void apply(uint64_t timestep, Settings& settings) const;
+
+    //copies the values of all scheduled fields from source to target
+    ENGINEINTERFACE_EXPORT void copyScheduledFields(Settings const& source, Settings& target) const;
+
+private:
+    struct Entry
+    {
+        ParameterSchedule schedule;
+        std::function<void(Settings&, double)> setter;
+        std::function<void(Settings const&, Settings&)> copier;
+    };
+    std::vector<Entry> _entries;
+};
@@ -14,7 +14,10 @@ public:
     ENGINEINTERFACE_EXPORT static std::pair<uint64_t, Settings> decodeTimestepAndSettings(
         boost::property_tree::ptree tree);
 
+    //faster equivalent for the content of a settings file
+    ENGINEINTERFACE_EXPORT static std::pair<uint64_t, Settings> decodeTimestepAndSettings(std::string_view json);
+
 private:
     static void
     encodeDecode(boost::property_tree::ptree& tree, uint64_t& timestep, Settings& settings, ParserTask task);
-};
\ No newline at end of file
+};
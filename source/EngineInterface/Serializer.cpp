@@ -16,6 +16,7 @@
 #include <boost/range/adaptors.hpp>
 
 #include "Base/ServiceLocator.h"
+#include "Base/Tracing.h"
 
 #include "Descriptions.h"
 #include "ChangeDescriptions.h"
@@ -116,10 +117,197 @@ namespace cereal
     {
         ar(data.clusters, data.particles);
     }
+
+    //columnar data is written in the same format as DataDescription
+    template <class Archive>
+    inline void saveString(Archive& ar, StringColumn const& column, int index)
+    {
+        auto length = column.getLength(index);
+        ar(make_size_tag(static_cast<size_type>(length)));
+        ar(binary_data(column.getData(index), length));
+    }
+    template <class Archive>
+    inline void loadString(Archive& ar, StringColumn& column)
+    {
+        size_type length;
+        ar(make_size_tag(length));
+        auto origSize = column.bytes.size();
+        column.bytes.resize(origSize + length);
+        ar(binary_data(column.bytes.data() + origSize, length));
+        column.offsets.emplace_back(column.bytes.size());
+    }
+    template <class Archive>
+    inline void save(Archive& ar, ColumnarDataDescription const& data)
+    {
+        ar(make_size_tag(static_cast<size_type>(data.getNumClusters())));
+        for (int clusterIndex = 0; clusterIndex < data.getNumClusters(); ++clusterIndex) {
+            auto cellBegin = data.clusterCellOffsets[clusterIndex];
+            auto cellEnd = data.clusterCellOffsets[clusterIndex + 1];
+            ar(data.clusterIds[clusterIndex], make_size_tag(static_cast<size_type>(cellEnd - cellBegin)));
+            for (int index = cellBegin; index < cellEnd; ++index) {
+                ar(data.cellIds[index],
+                   data.cellPositions[index],
+                   data.cellVelocities[index],
+                   data.cellEnergies[index],
+                   data.cellMaxConnections[index]);
+
+                auto connectionBegin = data.cellConnectionOffsets[index];
+                auto connectionEnd = data.cellConnectionOffsets[index + 1];
+                ar(make_size_tag(static_cast<size_type>(connectionEnd - connectionBegin)));
+                for (int i = connectionBegin; i < connectionEnd; ++i) {
+                    ar(data.connectionCellIds[i], data.connectionDistances[i], data.connectionAnglesFromPrevious[i]);
+                }
+                ar(data.cellTokenBlocked[index] != 0, data.cellTokenBranchNumbers[index]);
+
+                //metadata
+                saveString(ar, data.cellSourceCodes, index);
+                saveString(ar, data.cellNames, index);
+                saveString(ar, data.cellDescriptions, index);
+                ar(data.cellColors[index]);
+
+                //cell feature
+                ar(data.cellFunctionTypes[index]);
+                saveString(ar, data.cellVolatileData, index);
+                saveString(ar, data.cellConstData, index);
+
+                auto tokenBegin = data.cellTokenOffsets[index];
+                auto tokenEnd = data.cellTokenOffsets[index + 1];
+                ar(make_size_tag(static_cast<size_type>(tokenEnd - tokenBegin)));
+                for (int i = tokenBegin; i < tokenEnd; ++i) {
+                    ar(data.tokenEnergies[i]);
+                    saveString(ar, data.tokenData, i);
+                }
+                ar(data.cellTokenUsages[index]);
+            }
+        }
+
+        ar(make_size_tag(static_cast<size_type>(data.getNumParticles())));
+        for (int index = 0; index < data.getNumParticles(); ++index) {
+            ar(data.particleIds[index],
+               data.particlePositions[index],
+               data.particleVelocities[index],
+               data.particleEnergies[index],
+               data.particleColors[index]);
+        }
+    }
+    template <class Archive>
+    inline void load(Archive& ar, ColumnarDataDescription& data)
+    {
+        data.clear();
+
+        size_type numClusters;
+        ar(make_size_tag(numClusters));
+        for (size_type clusterIndex = 0; clusterIndex < numClusters; ++clusterIndex) {
+            uint64_t clusterId;
+            size_type numCells;
+            ar(clusterId, make_size_tag(numCells));
+            data.addCluster(clusterId);
+            for (size_type index = 0; index < numCells; ++index) {
+                uint64_t id;
+                RealVector2D pos;
+                RealVector2D vel;
+                double energy;
+                int maxConnections;
+                ar(id, pos, vel, energy, maxConnections);
+                data.cellIds.emplace_back(id);
+                data.cellPositions.emplace_back(pos);
+                data.cellVelocities.emplace_back(vel);
+                data.cellEnergies.emplace_back(energy);
+                data.cellMaxConnections.emplace_back(maxConnections);
+
+                size_type numConnections;
+                ar(make_size_tag(numConnections));
+                for (size_type i = 0; i < numConnections; ++i) {
+                    uint64_t cellId;
+                    float distance;
+                    float angleFromPrevious;
+                    ar(cellId, distance, angleFromPrevious);
+                    data.connectionCellIds.emplace_back(cellId);
+                    data.connectionDistances.emplace_back(distance);
+                    data.connectionAnglesFromPrevious.emplace_back(angleFromPrevious);
+                }
+                data.cellConnectionOffsets.emplace_back(data.getNumConnections());
+
+                bool tokenBlocked;
+                int tokenBranchNumber;
+                ar(tokenBlocked, tokenBranchNumber);
+                data.cellTokenBlocked.emplace_back(tokenBlocked);
+                data.cellTokenBranchNumbers.emplace_back(tokenBranchNumber);
+
+                //metadata
+                loadString(ar, data.cellSourceCodes);
+                loadString(ar, data.cellNames);
+                loadString(ar, data.cellDescriptions);
+                unsigned char color;
+                ar(color);
+                data.cellColors.emplace_back(color);
+
+                //cell feature
+                Enums::CellFunction::Type type;
+                ar(type);
+                data.cellFunctionTypes.emplace_back(CellFeatureDescription().setType(type).getType());
+                loadString(ar, data.cellVolatileData);
+                loadString(ar, data.cellConstData);
+
+                size_type numTokens;
+                ar(make_size_tag(numTokens));
+                for (size_type i = 0; i < numTokens; ++i) {
+                    double tokenEnergy;
+                    ar(tokenEnergy);
+                    data.tokenEnergies.emplace_back(tokenEnergy);
+                    loadString(ar, data.tokenData);
+                }
+                data.cellTokenOffsets.emplace_back(data.getNumTokens());
+
+                int tokenUsages;
+                ar(tokenUsages);
+                data.cellTokenUsages.emplace_back(tokenUsages);
+                ++data.clusterCellOffsets.back();
+            }
+        }
+
+        size_type numParticles;
+        ar(make_size_tag(numParticles));
+        for (size_type index = 0; index < numParticles; ++index) {
+            uint64_t id;
+            RealVector2D pos;
+            RealVector2D vel;
+            double energy;
+            uint8_t color;
+            ar(id, pos, vel, energy, color);
+            data.particleIds.emplace_back(id);
+            data.particlePositions.emplace_back(pos);
+            data.particleVelocities.emplace_back(vel);
+            data.particleEnergies.emplace_back(energy);
+            data.particleColors.emplace_back(color);
+        }
+    }
 }
 
 bool _Serializer::serializeSimulationToFile(string const& filename, DeserializedSimulation const& data)
 {
+    return serializeSimulationToFileIntern(filename, data);
+}
+
+bool _Serializer::deserializeSimulationFromFile(string const& filename, DeserializedSimulation& data)
+{
+    return deserializeSimulationFromFileIntern(filename, data);
+}
+
+bool _Serializer::serializeSimulationToFile(string const& filename, DeserializedColumnarSimulation const& data)
+{
+    return serializeSimulationToFileIntern(filename, data);
+}
+
+bool _Serializer::deserializeSimulationFromFile(string const& filename, DeserializedColumnarSimulation& data)
+{
+    return deserializeSimulationFromFileIntern(filename, data);
+}
+
+template <typename Simulation>
+bool _Serializer::serializeSimulationToFileIntern(string const& filename, Simulation const& data)
+{
+    TRACE_SCOPE("Serializer", "serialize simulation to file");
     try {
         std::regex fileEndingExpr("\\.\\w+$");
         if (!std::regex_search(filename, fileEndingExpr)) {
@@ -158,8 +346,10 @@ bool _Serializer::serializeSimulationToFile(string const& filename, Deserialized
     }
 }
 
-bool _Serializer::deserializeSimulationFromFile(string const& filename, DeserializedSimulation& data)
+template <typename Simulation>
+bool _Serializer::deserializeSimulationFromFileIntern(string const& filename, Simulation& data)
 {
+    TRACE_SCOPE("Serializer", "deserialize simulation from file");
     try {
         std::regex fileEndingExpr("\\.\\w+$");
         if (!std::regex_search(filename, fileEndingExpr)) {
@@ -201,6 +391,14 @@ bool _Serializer::deserializeSimulationFromFile(string const& filename, Deserial
 
 void _Serializer::serializeDataDescription(DataDescription const& data, std::ostream& stream) const
 {
+    TRACE_SCOPE("Serializer", "serialize data");
+    cereal::PortableBinaryOutputArchive archive(stream);
+    archive(data);
+}
+
+void _Serializer::serializeDataDescription(ColumnarDataDescription const& data, std::ostream& stream) const
+{
+    TRACE_SCOPE("Serializer", "serialize columnar data");
     cereal::PortableBinaryOutputArchive archive(stream);
     archive(data);
 }
@@ -208,6 +406,7 @@ void _Serializer::serializeDataDescription(DataDescription const& data, std::ost
 void _Serializer::serializeTimestepAndSettings(uint64_t timestep, Settings const& generalSettings, std::ostream& stream)
     const
 {
+    TRACE_SCOPE("Serializer", "serialize settings");
     boost::property_tree::json_parser::write_json(stream, Parser::encode(timestep, generalSettings));
 }
 
@@ -223,6 +422,7 @@ void _Serializer::serializeSymbolMap(SymbolMap const symbols, std::ostream& stre
 
 void _Serializer::deserializeDataDescription(DataDescription& data, std::istream& stream) const
 {
+    TRACE_SCOPE("Serializer", "deserialize data");
     cereal::PortableBinaryInputArchive archive(stream);
     archive(data);
 
@@ -231,11 +431,22 @@ void _Serializer::deserializeDataDescription(DataDescription& data, std::istream
     }
 }
 
+void _Serializer::deserializeDataDescription(ColumnarDataDescription& data, std::istream& stream) const
+{
+    TRACE_SCOPE("Serializer", "deserialize columnar data");
+    cereal::PortableBinaryInputArchive archive(stream);
+    archive(data);
+
+    if (data.isEmpty()) {
+        throw std::runtime_error("no data found");
+    }
+}
+
 void _Serializer::deserializeTimestepAndSettings(uint64_t& timestep, Settings& settings, std::istream& stream) const
 {
-    boost::property_tree::ptree tree;
-    boost::property_tree::read_json(stream, tree);
-    std::tie(timestep, settings) = Parser::decodeTimestepAndSettings(tree);
+    TRACE_SCOPE("Serializer", "deserialize settings");
+    std::string json{std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>()};
+    std::tie(timestep, settings) = Parser::decodeTimestepAndSettings(std::string_view(json));
 }
 
 void _Serializer::deserializeSymbolMap(SymbolMap& symbolMap, std::istream& stream)
@@ -8,27 +8,55 @@
 #include "SimulationParameters.h"
 #include "GeneralSettings.h"
 #include "Descriptions.h"
+#include "ColumnarDescriptions.h"
 
 struct DeserializedSimulation
 {
+    DeserializedSimulation() = default;
+    //the content is deserialized in place and keeps the given allocator, e.g. the one of a DescriptionArena
+    explicit DeserializedSimulation(DataDescription::allocator_type const& allocator)
+        : content(allocator)
+    {}
+
     uint64_t timestep;
     Settings settings;
     SymbolMap symbolMap;
     DataDescription content;
 };
 
+//same file format as DeserializedSimulation without building a description per cell
+struct DeserializedColumnarSimulation
+{
+    uint64_t timestep;
+    Settings settings;
+    SymbolMap symbolMap;
+    ColumnarDataDescription content;
+};
+
 class _Serializer
 {
 public:
     ENGINEINTERFACE_EXPORT bool serializeSimulationToFile(string const& filename, DeserializedSimulation const& data);
     ENGINEINTERFACE_EXPORT bool deserializeSimulationFromFile(string const& filename, DeserializedSimulation& data);
 
+    ENGINEINTERFACE_EXPORT bool
+    serializeSimulationToFile(string const& filename, DeserializedColumnarSimulation const& data);
+    ENGINEINTERFACE_EXPORT bool
+    deserializeSimulationFromFile(string const& filename, DeserializedColumnarSimulation& data);
+
 private:
+    template <typename Simulation>
+    bool serializeSimulationToFileIntern(string const& filename, Simulation const& data);
+    template <typename Simulation>
+    bool deserializeSimulationFromFileIntern(string const& filename, Simulation& data);
+
     void serializeDataDescription(DataDescription const& data, std::ostream& stream) const;
+    void serializeDataDescription(ColumnarDataDescription const& data, std::ostream& stream) const;
     void serializeTimestepAndSettings(uint64_t timestep, Settings const& generalSettings, std::ostream& stream) const;
     void serializeSymbolMap(SymbolMap const symbols, std::ostream& stream) const;
 
     void deserializeDataDescription(DataDescription& data, std::istream& stream) const;
+    void deserializeDataDescription(ColumnarDataDescription& data, std::istream& stream) const;
     void deserializeTimestepAndSettings(uint64_t& timestep, Settings& settings, std::istream& stream) const;
     void deserializeSymbolMap(SymbolMap& symbolMap, std::istream& stream);
 };
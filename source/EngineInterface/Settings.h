@@ -12,4 +12,15 @@ struct Settings
     SimulationParameters simulationParameters;
     SimulationParametersSpots simulationParametersSpots;
     FlowFieldSettings flowFieldSettings;
+
+    //paths of the settings file
+    static auto constexpr getFields()
+    {
+        using T = Settings;
+        return std::make_tuple(
+            makeField("general", &T::generalSettings),
+            makeField("simulation parameters", &T::simulationParameters),
+            makeField("simulation parameters.spots", &T::simulationParametersSpots),
+            makeField("flow field", &T::flowFieldSettings));
+    }
 };
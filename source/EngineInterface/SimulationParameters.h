@@ -45,38 +45,60 @@ struct SimulationParameters
     float radiationVelocityMultiplier = 1.0f;
     float radiationVelocityPerturbation = 0.5f;
 
-    bool operator==(SimulationParameters const& other) const
+    static auto constexpr getFields()
     {
-        return spotValues == other.spotValues && timestepSize == other.timestepSize && cellMaxVel == other.cellMaxVel
-            && cellMaxBindingDistance == other.cellMaxBindingDistance && cellMinDistance == other.cellMinDistance
-            && cellMaxCollisionDistance == other.cellMaxCollisionDistance
-            && cellMaxForceDecayProb == other.cellMaxForceDecayProb && cellMinTokenUsages == other.cellMinTokenUsages
-            && cellTokenUsageDecayProb == other.cellTokenUsageDecayProb && cellMaxBonds == other.cellMaxBonds
-            && cellMaxToken == other.cellMaxToken && cellMaxTokenBranchNumber == other.cellMaxTokenBranchNumber
-            && cellCreationMaxConnection == other.cellCreationMaxConnection
-            && cellCreationTokenAccessNumber == other.cellCreationTokenAccessNumber
-            && cellTransformationProb == other.cellTransformationProb
-            && cellFunctionWeaponStrength == other.cellFunctionWeaponStrength
-            && cellFunctionComputerMaxInstructions == other.cellFunctionComputerMaxInstructions
-            && cellFunctionComputerCellMemorySize == other.cellFunctionComputerCellMemorySize
-            && cellFunctionConstructorOffspringCellEnergy == other.cellFunctionConstructorOffspringCellEnergy
-            && cellFunctionConstructorOffspringCellDistance == other.cellFunctionConstructorOffspringCellDistance
-            && cellFunctionConstructorOffspringTokenEnergy == other.cellFunctionConstructorOffspringTokenEnergy
-            && cellFunctionConstructorOffspringTokenSuppressMemoryCopy
-            == other.cellFunctionConstructorOffspringTokenSuppressMemoryCopy
-            && cellFunctionConstructorTokenDataMutationProb == other.cellFunctionConstructorTokenDataMutationProb
-            && cellFunctionConstructorCellDataMutationProb == other.cellFunctionConstructorCellDataMutationProb
-            && cellFunctionConstructorCellPropertyMutationProb == other.cellFunctionConstructorCellPropertyMutationProb
-            && cellFunctionConstructorCellStructureMutationProb
-            == other.cellFunctionConstructorCellStructureMutationProb
-            && cellFunctionSensorRange == other.cellFunctionSensorRange
-            && cellFunctionCommunicatorRange == other.cellFunctionCommunicatorRange
-            && tokenMemorySize == other.tokenMemorySize && tokenMinEnergy == other.tokenMinEnergy
-            && radiationExponent == other.radiationExponent && radiationProb == other.radiationProb
-            && radiationVelocityMultiplier == other.radiationVelocityMultiplier
-            && radiationVelocityPerturbation == other.radiationVelocityPerturbation
-            && cellRepulsionStrength == other.cellRepulsionStrength;
+        using T = SimulationParameters;
+        return std::make_tuple(
+            makeField("", &T::spotValues),
+            makeField("time step size", &T::timestepSize),
+            makeField("cell.max velocity", &T::cellMaxVel),
+            makeField("cell.max binding distance", &T::cellMaxBindingDistance),
+            makeField("cell.repulsion strength", &T::cellRepulsionStrength),
+            makeField("cell.min distance", &T::cellMinDistance),
+            makeField("cell.max distance", &T::cellMaxCollisionDistance),
+            makeField("cell.max force decay probability", &T::cellMaxForceDecayProb),
+            makeField("cell.min token usages", &T::cellMinTokenUsages),
+            makeField("cell.token usage decay probability", &T::cellTokenUsageDecayProb),
+            makeField("cell.max bonds", &T::cellMaxBonds),
+            makeField("cell.max token", &T::cellMaxToken),
+            makeField("cell.max token branch number", &T::cellMaxTokenBranchNumber),
+            makeField("cell.creation.max connection", &T::cellCreationMaxConnection),
+            makeField("cell.creation.token access number", &T::cellCreationTokenAccessNumber),
+            makeField("cell.transformation probability", &T::cellTransformationProb),
+            makeField("cell.function.weapon.strength", &T::cellFunctionWeaponStrength),
+            makeField("cell.function.computer.max instructions", &T::cellFunctionComputerMaxInstructions),
+            makeField("cell.function.computer.memory size", &T::cellFunctionComputerCellMemorySize),
+            makeField(
+                "cell.function.constructor.offspring.cell energy", &T::cellFunctionConstructorOffspringCellEnergy),
+            makeField(
+                "cell.function.constructor.offspring.cell distance", &T::cellFunctionConstructorOffspringCellDistance),
+            makeField(
+                "cell.function.constructor.offspring.token energy", &T::cellFunctionConstructorOffspringTokenEnergy),
+            makeField(
+                "cell.function.constructor.offspring.token suppress memory copy",
+                &T::cellFunctionConstructorOffspringTokenSuppressMemoryCopy),
+            makeField(
+                "cell.function.constructor.mutation probability.token data",
+                &T::cellFunctionConstructorTokenDataMutationProb),
+            makeField(
+                "cell.function.constructor.mutation probability.cell data",
+                &T::cellFunctionConstructorCellDataMutationProb),
+            makeField(
+                "cell.function.constructor.mutation probability.cell property",
+                &T::cellFunctionConstructorCellPropertyMutationProb),
+            makeField(
+                "cell.function.constructor.mutation probability.cell structure",
+                &T::cellFunctionConstructorCellStructureMutationProb),
+            makeField("cell.function.sensor.range", &T::cellFunctionSensorRange),
+            makeField("cell.function.communicator.range", &T::cellFunctionCommunicatorRange),
+            makeField("token.memory size", &T::tokenMemorySize),
+            makeField("token.min energy", &T::tokenMinEnergy),
+            makeField("radiation.exponent", &T::radiationExponent),
+            makeField("radiation.probability", &T::radiationProb),
+            makeField("radiation.velocity multiplier", &T::radiationVelocityMultiplier),
+            makeField("radiation.velocity perturbation", &T::radiationVelocityPerturbation));
     }
 
+    bool operator==(SimulationParameters const& other) const { return FieldTable::equals(*this, other); }
     bool operator!=(SimulationParameters const& other) const { return !operator==(other); }
 };
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "Base/FieldTable.h"
+
 struct SimulationParametersSpotValues
 {
     float friction = 0.001f;
@@ -16,15 +18,24 @@ struct SimulationParametersSpotValues
     float cellFunctionWeaponColorPenalty = 0.0f;
     float cellFunctionWeaponGeometryDeviationExponent = 0.0f;
 
-    bool operator==(SimulationParametersSpotValues const& other) const
+    static auto constexpr getFields()
     {
-        return friction == other.friction && radiationFactor == other.radiationFactor
-            && cellMaxForce == other.cellMaxForce && cellMinEnergy == other.cellMinEnergy
-            && cellBindingForce == other.cellBindingForce && cellFusionVelocity == other.cellFusionVelocity
-            && tokenMutationRate == other.tokenMutationRate
-            && cellFunctionWeaponEnergyCost == other.cellFunctionWeaponEnergyCost
-            && cellFunctionWeaponColorPenalty == other.cellFunctionWeaponColorPenalty
-            && cellFunctionWeaponGeometryDeviationExponent == other.cellFunctionWeaponGeometryDeviationExponent
-            && cellMaxBindingEnergy == other.cellMaxBindingEnergy;
+        using T = SimulationParametersSpotValues;
+        return std::make_tuple(
+            makeField("friction", &T::friction),
+            makeField("radiation.factor", &T::radiationFactor),
+            makeField("cell.max force", &T::cellMaxForce),
+            makeField("cell.min energy", &T::cellMinEnergy),
+            makeField("cell.binding force", &T::cellBindingForce),
+            makeField("cell.fusion velocity", &T::cellFusionVelocity),
+            makeField("cell.max binding energy", &T::cellMaxBindingEnergy),
+            makeField("token.mutation rate", &T::tokenMutationRate),
+            makeField("cell.function.weapon.energy cost", &T::cellFunctionWeaponEnergyCost),
+            makeField("cell.function.weapon.color penalty", &T::cellFunctionWeaponColorPenalty),
+            makeField(
+                "cell.function.weapon.geometry deviation exponent", &T::cellFunctionWeaponGeometryDeviationExponent));
     }
+
+    bool operator==(SimulationParametersSpotValues const& other) const { return FieldTable::equals(*this, other); }
+    bool operator!=(SimulationParametersSpotValues const& other) const { return !operator==(other); }
 };
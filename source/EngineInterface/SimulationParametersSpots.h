@@ -2,6 +2,8 @@
 
 #include <cstdint>
 
+#include "Base/FieldTable.h"
+
 #include "SimulationParametersSpotValues.h"
 
 struct SimulationParametersSpot
@@ -14,11 +16,20 @@ struct SimulationParametersSpot
 
     SimulationParametersSpotValues values;
 
-    bool operator==(SimulationParametersSpot const& other) const
+    static auto constexpr getFields()
     {
-        return color == other.color && posX == other.posX && posY == other.posY && coreRadius == other.coreRadius
-            && fadeoutRadius == other.fadeoutRadius && values == other.values;
+        using T = SimulationParametersSpot;
+        return std::make_tuple(
+            makeField("color", &T::color),
+            makeField("pos.x", &T::posX),
+            makeField("pos.y", &T::posY),
+            makeField("core radius", &T::coreRadius),
+            makeField("fadeout radius", &T::fadeoutRadius),
+            makeField("", &T::values));
     }
+
+    bool operator==(SimulationParametersSpot const& other) const { return FieldTable::equals(*this, other); }
+    bool operator!=(SimulationParametersSpot const& other) const { return !operator==(other); }
 };
 
 struct SimulationParametersSpots
@@ -26,9 +37,12 @@ struct SimulationParametersSpots
     int numSpots = 0;
     SimulationParametersSpot spots[2];
 
-    bool operator==(SimulationParametersSpots const& other) const
+    static auto constexpr getFields()
     {
-        return numSpots == other.numSpots && spots == other.spots;
+        using T = SimulationParametersSpots;
+        return std::make_tuple(makeField("num spots", &T::numSpots), makeField("", &T::spots));
     }
+
+    bool operator==(SimulationParametersSpots const& other) const { return FieldTable::equals(*this, other); }
     bool operator!=(SimulationParametersSpots const& other) const { return !operator==(other); }
 };
\ No newline at end of file
@@ -2,35 +2,303 @@
 
 #include <cmath>
 
-#include "Base/Math.h"
+#include "Base/CpuFeatures.h"
+
+namespace
+{
+    static_assert(sizeof(RealVector2D) == 2 * sizeof(float), "positions are processed as interleaved float arrays");
+
+    //the vectorized kernels below perform exactly the same operations and hence yield the same results
+    //displacements are mapped into [-size/2, size/2] as remainderf does on the GPU
+
+    float wrapDisplacement(float value, float size, float invSize)
+    {
+        return value - size * std::floor(value * invSize + 0.5f);
+    }
+
+    float wrapPosition(float value, float size, float invSize)
+    {
+        auto result = value - size * std::floor(value * invSize);
+
+        //rounding may yield values slightly outside of [0, size)
+        result += result < 0 ? size : 0.0f;
+        result -= result >= size ? size : 0.0f;
+        return result;
+    }
+
+#ifdef ALIEN_X86_SIMD
+    ALIEN_TARGET_SSE41 __m128 wrapDisplacementSse41(__m128 value, __m128 size, __m128 invSize)
+    {
+        auto shift = _mm_floor_ps(_mm_add_ps(_mm_mul_ps(value, invSize), _mm_set1_ps(0.5f)));
+        return _mm_sub_ps(value, _mm_mul_ps(size, shift));
+    }
+
+    ALIEN_TARGET_SSE41 __m128 wrapPositionSse41(__m128 value, __m128 size, __m128 invSize)
+    {
+        auto result = _mm_sub_ps(value, _mm_mul_ps(size, _mm_floor_ps(_mm_mul_ps(value, invSize))));
+        result = _mm_add_ps(result, _mm_and_ps(_mm_cmplt_ps(result, _mm_setzero_ps()), size));
+        return _mm_sub_ps(result, _mm_and_ps(_mm_cmpge_ps(result, size), size));
+    }
+
+    ALIEN_TARGET_SSE41 int distancesSse41(
+        RealVector2D const& pos,
+        RealVector2D const& size,
+        RealVector2D const& invSize,
+        RealVector2D const* otherPositions,
+        float* result,
+        int count)
+    {
+        auto posV = _mm_setr_ps(pos.x, pos.y, pos.x, pos.y);
+        auto sizeV = _mm_setr_ps(size.x, size.y, size.x, size.y);
+        auto invSizeV = _mm_setr_ps(invSize.x, invSize.y, invSize.x, invSize.y);
+        int index = 0;
+        for (; index + 4 <= count; index += 4) {
+            auto d0 = _mm_sub_ps(_mm_loadu_ps(&otherPositions[index].x), posV);
+            auto d1 = _mm_sub_ps(_mm_loadu_ps(&otherPositions[index + 2].x), posV);
+            d0 = wrapDisplacementSse41(d0, sizeV, invSizeV);
+            d1 = wrapDisplacementSse41(d1, sizeV, invSizeV);
+            auto squaredLengths = _mm_hadd_ps(_mm_mul_ps(d0, d0), _mm_mul_ps(d1, d1));
+            _mm_storeu_ps(result + index, _mm_sqrt_ps(squaredLengths));
+        }
+        return index;
+    }
+
+    ALIEN_TARGET_SSE41 int displacementsSse41(
+        RealVector2D const& size,
+        RealVector2D const& invSize,
+        RealVector2D const* positions1,
+        RealVector2D const* positions2,
+        RealVector2D* result,
+        int count)
+    {
+        auto sizeV = _mm_setr_ps(size.x, size.y, size.x, size.y);
+        auto invSizeV = _mm_setr_ps(invSize.x, invSize.y, invSize.x, invSize.y);
+        int index = 0;
+        for (; index + 2 <= count; index += 2) {
+            auto d = _mm_sub_ps(_mm_loadu_ps(&positions2[index].x), _mm_loadu_ps(&positions1[index].x));
+            _mm_storeu_ps(&result[index].x, wrapDisplacementSse41(d, sizeV, invSizeV));
+        }
+        return index;
+    }
+
+    ALIEN_TARGET_SSE41 int
+    correctPositionsSse41(RealVector2D const& size, RealVector2D const& invSize, RealVector2D* positions, int count)
+    {
+        auto sizeV = _mm_setr_ps(size.x, size.y, size.x, size.y);
+        auto invSizeV = _mm_setr_ps(invSize.x, invSize.y, invSize.x, invSize.y);
+        int index = 0;
+        for (; index + 2 <= count; index += 2) {
+            auto p = _mm_loadu_ps(&positions[index].x);
+            _mm_storeu_ps(&positions[index].x, wrapPositionSse41(p, sizeV, invSizeV));
+        }
+        return index;
+    }
+
+    ALIEN_TARGET_AVX2 __m256 wrapDisplacementAvx2(__m256 value, __m256 size, __m256 invSize)
+    {
+        auto shift = _mm256_floor_ps(_mm256_add_ps(_mm256_mul_ps(value, invSize), _mm256_set1_ps(0.5f)));
+        return _mm256_sub_ps(value, _mm256_mul_ps(size, shift));
+    }
+
+    ALIEN_TARGET_AVX2 __m256 wrapPositionAvx2(__m256 value, __m256 size, __m256 invSize)
+    {
+        auto result = _mm256_sub_ps(value, _mm256_mul_ps(size, _mm256_floor_ps(_mm256_mul_ps(value, invSize))));
+        result = _mm256_add_ps(result, _mm256_and_ps(_mm256_cmp_ps(result, _mm256_setzero_ps(), _CMP_LT_OQ), size));
+        return _mm256_sub_ps(result, _mm256_and_ps(_mm256_cmp_ps(result, size, _CMP_GE_OQ), size));
+    }
+
+    ALIEN_TARGET_AVX2 __m256 broadcastAvx2(RealVector2D const& value)
+    {
+        return _mm256_setr_ps(value.x, value.y, value.x, value.y, value.x, value.y, value.x, value.y);
+    }
+
+    ALIEN_TARGET_AVX2 int distancesAvx2(
+        RealVector2D const& pos,
+        RealVector2D const& size,
+        RealVector2D const& invSize,
+        RealVector2D const* otherPositions,
+        float* result,
+        int count)
+    {
+        auto posV = broadcastAvx2(pos);
+        auto sizeV = broadcastAvx2(size);
+        auto invSizeV = broadcastAvx2(invSize);
+        int index = 0;
+        for (; index + 8 <= count; index += 8) {
+            auto d0 = _mm256_sub_ps(_mm256_loadu_ps(&otherPositions[index].x), posV);
+            auto d1 = _mm256_sub_ps(_mm256_loadu_ps(&otherPositions[index + 4].x), posV);
+            d0 = wrapDisplacementAvx2(d0, sizeV, invSizeV);
+            d1 = wrapDisplacementAvx2(d1, sizeV, invSizeV);
+
+            //hadd yields the order 0, 1, 4, 5, 2, 3, 6, 7 => swap the middle 64 bit blocks
+            auto squaredLengths = _mm256_hadd_ps(_mm256_mul_ps(d0, d0), _mm256_mul_ps(d1, d1));
+            squaredLengths = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(squaredLengths), 0xd8));
+            _mm256_storeu_ps(result + index, _mm256_sqrt_ps(squaredLengths));
+        }
+        return index;
+    }
+
+    ALIEN_TARGET_AVX2 int displacementsAvx2(
+        RealVector2D const& size,
+        RealVector2D const& invSize,
+        RealVector2D const* positions1,
+        RealVector2D const* positions2,
+        RealVector2D* result,
+        int count)
+    {
+        auto sizeV = broadcastAvx2(size);
+        auto invSizeV = broadcastAvx2(invSize);
+        int index = 0;
+        for (; index + 4 <= count; index += 4) {
+            auto d = _mm256_sub_ps(_mm256_loadu_ps(&positions2[index].x), _mm256_loadu_ps(&positions1[index].x));
+            _mm256_storeu_ps(&result[index].x, wrapDisplacementAvx2(d, sizeV, invSizeV));
+        }
+        return index;
+    }
+
+    ALIEN_TARGET_AVX2 int
+    correctPositionsAvx2(RealVector2D const& size, RealVector2D const& invSize, RealVector2D* positions, int count)
+    {
+        auto sizeV = broadcastAvx2(size);
+        auto invSizeV = broadcastAvx2(invSize);
+        int index = 0;
+        for (; index + 4 <= count; index += 4) {
+            auto p = _mm256_loadu_ps(&positions[index].x);
+            _mm256_storeu_ps(&positions[index].x, wrapPositionAvx2(p, sizeV, invSizeV));
+        }
+        return index;
+    }
+#else
+    int distancesSse41(RealVector2D const&, RealVector2D const&, RealVector2D const&, RealVector2D const*, float*, int)
+    {
+        return 0;
+    }
+    int displacementsSse41(
+        RealVector2D const&,
+        RealVector2D const&,
+        RealVector2D const*,
+        RealVector2D const*,
+        RealVector2D*,
+        int)
+    {
+        return 0;
+    }
+    int correctPositionsSse41(RealVector2D const&, RealVector2D const&, RealVector2D*, int) { return 0; }
+    int distancesAvx2(RealVector2D const&, RealVector2D const&, RealVector2D const&, RealVector2D const*, float*, int)
+    {
+        return 0;
+    }
+    int displacementsAvx2(
+        RealVector2D const&,
+        RealVector2D const&,
+        RealVector2D const*,
+        RealVector2D const*,
+        RealVector2D*,
+        int)
+    {
+        return 0;
+    }
+    int correctPositionsAvx2(RealVector2D const&, RealVector2D const&, RealVector2D*, int) { return 0; }
+#endif
+}
 
 SpaceCalculator::SpaceCalculator(IntVector2D const& worldSize)
     : _worldSize(worldSize)
     , _worldSizeFloat{toFloat(worldSize.x), toFloat(worldSize.y)}
+    , _invWorldSize{1.0f / toFloat(worldSize.x), 1.0f / toFloat(worldSize.y)}
 {}
 
 float SpaceCalculator::distance(RealVector2D const& a, RealVector2D const& b) const
 {
     auto d = b - a;
     correctDisplacement(d);
-    return toFloat(Math::length(d));
+    return std::sqrt(d.x * d.x + d.y * d.y);
+}
+
+void SpaceCalculator::distances(
+    RealVector2D const& pos,
+    std::vector<RealVector2D> const& otherPositions,
+    std::vector<float>& result) const
+{
+    result.resize(otherPositions.size());
+    distances(pos, otherPositions.data(), result.data(), toInt(otherPositions.size()));
+}
+
+void SpaceCalculator::distances(RealVector2D const& pos, RealVector2D const* otherPositions, float* result, int count)
+    const
+{
+    int index = 0;
+    switch (CpuFeatures::getSimdLevel()) {
+    case SimdLevel::Avx2:
+        index = distancesAvx2(pos, _worldSizeFloat, _invWorldSize, otherPositions, result, count);
+        break;
+    case SimdLevel::Sse41:
+        index = distancesSse41(pos, _worldSizeFloat, _invWorldSize, otherPositions, result, count);
+        break;
+    default:
+        break;
+    }
+    for (; index < count; ++index) {
+        auto dx = otherPositions[index].x - pos.x;
+        auto dy = otherPositions[index].y - pos.y;
+        dx = wrapDisplacement(dx, _worldSizeFloat.x, _invWorldSize.x);
+        dy = wrapDisplacement(dy, _worldSizeFloat.y, _invWorldSize.y);
+        result[index] = std::sqrt(dx * dx + dy * dy);
+    }
+}
+
+void SpaceCalculator::displacements(
+    RealVector2D const* positions1,
+    RealVector2D const* positions2,
+    RealVector2D* result,
+    int count) const
+{
+    int index = 0;
+    switch (CpuFeatures::getSimdLevel()) {
+    case SimdLevel::Avx2:
+        index = displacementsAvx2(_worldSizeFloat, _invWorldSize, positions1, positions2, result, count);
+        break;
+    case SimdLevel::Sse41:
+        index = displacementsSse41(_worldSizeFloat, _invWorldSize, positions1, positions2, result, count);
+        break;
+    default:
+        break;
+    }
+    for (; index < count; ++index) {
+        result[index].x =
+            wrapDisplacement(positions2[index].x - positions1[index].x, _worldSizeFloat.x, _invWorldSize.x);
+        result[index].y =
+            wrapDisplacement(positions2[index].y - positions1[index].y, _worldSizeFloat.y, _invWorldSize.y);
+    }
+}
+
+void SpaceCalculator::correctPositions(RealVector2D* positions, int count) const
+{
+    int index = 0;
+    switch (CpuFeatures::getSimdLevel()) {
+    case SimdLevel::Avx2:
+        index = correctPositionsAvx2(_worldSizeFloat, _invWorldSize, positions, count);
+        break;
+    case SimdLevel::Sse41:
+        index = correctPositionsSse41(_worldSizeFloat, _invWorldSize, positions, count);
+        break;
+    default:
+        break;
+    }
+    for (; index < count; ++index) {
+        positions[index].x = wrapPosition(positions[index].x, _worldSizeFloat.x, _invWorldSize.x);
+        positions[index].y = wrapPosition(positions[index].y, _worldSizeFloat.y, _invWorldSize.y);
+    }
 }
 
 void SpaceCalculator::correctDisplacement(RealVector2D& displacement) const
 {
-    RealVector2D intDisplacement{std::floor(displacement.x), std::floor(displacement.y)};
-    RealVector2D remainder{displacement.x - intDisplacement.x, displacement.y - intDisplacement.y};
-    intDisplacement.x += _worldSizeFloat.x / 2;
-    intDisplacement.y += _worldSizeFloat.y / 2;
-    correctPosition(intDisplacement);
-    intDisplacement.x -= _worldSizeFloat.x / 2;
-    intDisplacement.y -= _worldSizeFloat.y / 2;
-    displacement.x = intDisplacement.x + remainder.x;
-    displacement.y = intDisplacement.y + remainder.y;
+    displacement.x = wrapDisplacement(displacement.x, _worldSizeFloat.x, _invWorldSize.x);
+    displacement.y = wrapDisplacement(displacement.y, _worldSizeFloat.y, _invWorldSize.y);
 }
 
 void SpaceCalculator::correctPosition(RealVector2D& pos) const
 {
-    pos.x = std::fmod(std::fmod(pos.x, _worldSizeFloat.x) + _worldSizeFloat.x, _worldSizeFloat.x);
-    pos.y = std::fmod(std::fmod(pos.y, _worldSizeFloat.y) + _worldSizeFloat.y, _worldSizeFloat.y);
+    pos.x = wrapPosition(pos.x, _worldSizeFloat.x, _invWorldSize.x);
+    pos.y = wrapPosition(pos.y, _worldSizeFloat.y, _invWorldSize.y);
 }
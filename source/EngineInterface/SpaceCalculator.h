@@ -10,10 +10,33 @@ public:
     ENGINEINTERFACE_EXPORT SpaceCalculator(IntVector2D const& worldSize);
     ENGINEINTERFACE_EXPORT float distance(RealVector2D const& a, RealVector2D const& b) const;
 
+    //batch functions below are vectorized with the instruction set selected by CpuFeatures at runtime
+
+    //periodic distances from pos to each of the other positions
+    ENGINEINTERFACE_EXPORT void distances(
+        RealVector2D const& pos,
+        std::vector<RealVector2D> const& otherPositions,
+        std::vector<float>& result) const;
+    ENGINEINTERFACE_EXPORT void
+    distances(RealVector2D const& pos, RealVector2D const* otherPositions, float* result, int count) const;
+
+    //result[i] is the shortest periodic displacement from positions1[i] to positions2[i]
+    ENGINEINTERFACE_EXPORT void displacements(
+        RealVector2D const* positions1,
+        RealVector2D const* positions2,
+        RealVector2D* result,
+        int count) const;
+
+    //maps positions into [0, worldSize)
+    ENGINEINTERFACE_EXPORT void correctPositions(RealVector2D* positions, int count) const;
+
+    //single element variants with the same results as the batch functions
+    ENGINEINTERFACE_EXPORT void correctDisplacement(RealVector2D& displacement) const;
+    ENGINEINTERFACE_EXPORT void correctPosition(RealVector2D& pos) const;
+
 private:
-    void correctDisplacement(RealVector2D& displacement) const;
-    void correctPosition(RealVector2D& pos) const;
 
     IntVector2D _worldSize;
     RealVector2D _worldSizeFloat;
+    RealVector2D _invWorldSize;
 };
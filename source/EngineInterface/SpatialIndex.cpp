@@ -0,0 +1,243 @@
+#include "SpatialIndex.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Base/Parallel.h"
+#include "Base/Tracing.h"
+
+#include "Descriptions.h"
+
+namespace
+{
+    int const MinEntriesPerChunk = 16384;
+    int const MinQueriesPerChunk = 256;
+
+    //range of grid cell offsets around the home grid cell which does not visit a grid cell twice
+    int getLowerOffset(int ring, int gridSize) { return -std::min(ring, (gridSize - 1) / 2); }
+    int getUpperOffset(int ring, int gridSize) { return std::min(ring, gridSize - 1 - (gridSize - 1) / 2); }
+}
+
+template <typename Func>
+void SpatialIndex::forEachEntryInGridCell(int gridX, int gridY, Func const& func) const
+{
+    gridX = ((gridX % _gridSize.x) + _gridSize.x) % _gridSize.x;
+    gridY = ((gridY % _gridSize.y) + _gridSize.y) % _gridSize.y;
+    auto gridCellIndex = gridX + gridY * _gridSize.x;
+    for (int entryIndex = _gridCellOffsets[gridCellIndex]; entryIndex < _gridCellOffsets[gridCellIndex + 1];
+         ++entryIndex) {
+        func(entryIndex);
+    }
+}
+
+SpatialIndex::SpatialIndex(DataDescription const& data, IntVector2D const& worldSize, float gridSpacing)
+    : _worldSize{toFloat(worldSize.x), toFloat(worldSize.y)}
+{
+    TRACE_SCOPE("SpatialIndex", "build");
+    _gridSize = {
+        std::max(1, static_cast<int>(_worldSize.x / gridSpacing)),
+        std::max(1, static_cast<int>(_worldSize.y / gridSpacing))};
+    _gridCellSize = {_worldSize.x / _gridSize.x, _worldSize.y / _gridSize.y};
+
+    std::vector<RealVector2D> positions;
+    std::vector<EntityReference> references;
+    for (int clusterIndex = 0; clusterIndex < data.clusters.size(); ++clusterIndex) {
+        auto const& cells = data.clusters[clusterIndex].cells;
+        for (int cellIndex = 0; cellIndex < cells.size(); ++cellIndex) {
+            positions.emplace_back(cells[cellIndex].pos);
+            references.emplace_back(EntityReference{clusterIndex, cellIndex});
+        }
+    }
+    for (int particleIndex = 0; particleIndex < data.particles.size(); ++particleIndex) {
+        positions.emplace_back(data.particles[particleIndex].pos);
+        references.emplace_back(EntityReference{-1, particleIndex});
+    }
+
+    auto numEntries = toInt(positions.size());
+    std::vector<int> gridCellIndices(numEntries);
+    Parallel::forEachChunk(numEntries, MinEntriesPerChunk, [&](int, int begin, int end) {
+        for (int index = begin; index < end; ++index) {
+            positions[index] = correctPosition(positions[index]);
+            gridCellIndices[index] = getGridCellIndex(positions[index]);
+        }
+    });
+
+    //counting sort by grid cell
+    _gridCellOffsets.assign(_gridSize.x * _gridSize.y + 1, 0);
+    for (auto const& gridCellIndex : gridCellIndices) {
+        ++_gridCellOffsets[gridCellIndex + 1];
+    }
+    for (int i = 0; i + 1 < _gridCellOffsets.size(); ++i) {
+        _gridCellOffsets[i + 1] += _gridCellOffsets[i];
+    }
+    _positions.resize(numEntries);
+    _references.resize(numEntries);
+    auto cursors = _gridCellOffsets;
+    for (int index = 0; index < numEntries; ++index) {
+        auto targetIndex = cursors[gridCellIndices[index]]++;
+        _positions[targetIndex] = positions[index];
+        _references[targetIndex] = references[index];
+    }
+}
+
+std::vector<EntityReference> SpatialIndex::getEntitiesInRadius(RealVector2D const& pos, float radius) const
+{
+    std::vector<EntityReference> result;
+    auto correctedPos = correctPosition(pos);
+    auto homeX = static_cast<int>(correctedPos.x / _gridCellSize.x);
+    auto homeY = static_cast<int>(correctedPos.y / _gridCellSize.y);
+    auto ringX = static_cast<int>(std::ceil(radius / _gridCellSize.x));
+    auto ringY = static_cast<int>(std::ceil(radius / _gridCellSize.y));
+    auto radiusSquared = radius * radius;
+    for (int dy = getLowerOffset(ringY, _gridSize.y); dy <= getUpperOffset(ringY, _gridSize.y); ++dy) {
+        for (int dx = getLowerOffset(ringX, _gridSize.x); dx <= getUpperOffset(ringX, _gridSize.x); ++dx) {
+            forEachEntryInGridCell(homeX + dx, homeY + dy, [&](int entryIndex) {
+                auto delta = correctDisplacement(_positions[entryIndex] - correctedPos);
+                if (delta.x * delta.x + delta.y * delta.y <= radiusSquared) {
+                    result.emplace_back(_references[entryIndex]);
+                }
+            });
+        }
+    }
+    return result;
+}
+
+std::vector<std::vector<EntityReference>> SpatialIndex::getEntitiesInRadius(
+    std::vector<RealVector2D> const& positions,
+    float radius) const
+{
+    TRACE_SCOPE("SpatialIndex", "radius queries");
+    std::vector<std::vector<EntityReference>> result(positions.size());
+    Parallel::forEachChunk(toInt(positions.size()), MinQueriesPerChunk, [&](int, int begin, int end) {
+        for (int index = begin; index < end; ++index) {
+            result[index] = getEntitiesInRadius(positions[index], radius);
+        }
+    });
+    return result;
+}
+
+std::vector<EntityReference> SpatialIndex::getNearestEntities(RealVector2D const& pos, int k) const
+{
+    std::vector<std::pair<float, int>> candidates;  //squared distance and entry index
+    if (k <= 0) {
+        return {};
+    }
+    auto correctedPos = correctPosition(pos);
+    auto homeX = static_cast<int>(correctedPos.x / _gridCellSize.x);
+    auto homeY = static_cast<int>(correctedPos.y / _gridCellSize.y);
+    auto minGridCellSize = std::min(_gridCellSize.x, _gridCellSize.y);
+
+    //visit grid cells ring by ring until the k nearest candidates are closer than the unvisited grid cells
+    for (int ring = 0;; ++ring) {
+        auto lowerX = getLowerOffset(ring, _gridSize.x);
+        auto upperX = getUpperOffset(ring, _gridSize.x);
+        auto lowerY = getLowerOffset(ring, _gridSize.y);
+        auto upperY = getUpperOffset(ring, _gridSize.y);
+        auto prevLowerX = getLowerOffset(ring - 1, _gridSize.x);
+        auto prevUpperX = getUpperOffset(ring - 1, _gridSize.x);
+        auto prevLowerY = getLowerOffset(ring - 1, _gridSize.y);
+        auto prevUpperY = getUpperOffset(ring - 1, _gridSize.y);
+        auto isPrevVisited = [&](int dx, int dy) {
+            return ring > 0 && prevLowerX <= dx && dx <= prevUpperX && prevLowerY <= dy && dy <= prevUpperY;
+        };
+        for (int dy = lowerY; dy <= upperY; ++dy) {
+            for (int dx = lowerX; dx <= upperX; ++dx) {
+                if (isPrevVisited(dx, dy)) {
+                    continue;
+                }
+                forEachEntryInGridCell(homeX + dx, homeY + dy, [&](int entryIndex) {
+                    auto delta = correctDisplacement(_positions[entryIndex] - correctedPos);
+                    candidates.emplace_back(delta.x * delta.x + delta.y * delta.y, entryIndex);
+                });
+            }
+        }
+
+        auto isGridCovered = upperX - lowerX + 1 == _gridSize.x && upperY - lowerY + 1 == _gridSize.y;
+        if (isGridCovered) {
+            break;
+        }
+        if (candidates.size() >= k) {
+            std::nth_element(candidates.begin(), candidates.begin() + (k - 1), candidates.end());
+            auto coveredRadius = ring * minGridCellSize;
+            if (candidates[k - 1].first <= coveredRadius * coveredRadius) {
+                break;
+            }
+        }
+    }
+
+    auto numResults = std::min(k, toInt(candidates.size()));
+    std::partial_sort(candidates.begin(), candidates.begin() + numResults, candidates.end());
+    std::vector<EntityReference> result;
+    result.reserve(numResults);
+    for (int i = 0; i < numResults; ++i) {
+        result.emplace_back(_references[candidates[i].second]);
+    }
+    return result;
+}
+
+std::vector<std::vector<EntityReference>> SpatialIndex::getNearestEntities(
+    std::vector<RealVector2D> const& positions,
+    int k) const
+{
+    TRACE_SCOPE("SpatialIndex", "nearest neighbor queries");
+    std::vector<std::vector<EntityReference>> result(positions.size());
+    Parallel::forEachChunk(toInt(positions.size()), MinQueriesPerChunk, [&](int, int begin, int end) {
+        for (int index = begin; index < end; ++index) {
+            result[index] = getNearestEntities(positions[index], k);
+        }
+    });
+    return result;
+}
+
+std::vector<EntityReference> SpatialIndex::getEntitiesInRect(RealRect const& rect) const
+{
+    std::vector<EntityReference> result;
+    auto size = rect.bottomRight - rect.topLeft;
+    if (size.x < 0 || size.y < 0) {
+        return result;
+    }
+    auto topLeft = correctPosition(rect.topLeft);
+    auto startX = static_cast<int>(topLeft.x / _gridCellSize.x);
+    auto startY = static_cast<int>(topLeft.y / _gridCellSize.y);
+    auto numX = std::min(_gridSize.x, static_cast<int>((topLeft.x + size.x) / _gridCellSize.x) - startX + 1);
+    auto numY = std::min(_gridSize.y, static_cast<int>((topLeft.y + size.y) / _gridCellSize.y) - startY + 1);
+    for (int y = startY; y < startY + numY; ++y) {
+        for (int x = startX; x < startX + numX; ++x) {
+            forEachEntryInGridCell(x, y, [&](int entryIndex) {
+                auto offset = correctPosition(_positions[entryIndex] - topLeft);
+                if (offset.x <= size.x && offset.y <= size.y) {
+                    result.emplace_back(_references[entryIndex]);
+                }
+            });
+        }
+    }
+    return result;
+}
+
+RealVector2D SpatialIndex::correctPosition(RealVector2D const& pos) const
+{
+    RealVector2D result{pos.x - _worldSize.x * std::floor(pos.x / _worldSize.x),
+                        pos.y - _worldSize.y * std::floor(pos.y / _worldSize.y)};
+
+    //floating point rounding may yield exactly the world size
+    if (result.x >= _worldSize.x) {
+        result.x = 0;
+    }
+    if (result.y >= _worldSize.y) {
+        result.y = 0;
+    }
+    return result;
+}
+
+RealVector2D SpatialIndex::correctDisplacement(RealVector2D const& displacement) const
+{
+    return {displacement.x - _worldSize.x * std::floor(displacement.x / _worldSize.x + 0.5f),
+            displacement.y - _worldSize.y * std::floor(displacement.y / _worldSize.y + 0.5f)};
+}
+
+int SpatialIndex::getGridCellIndex(RealVector2D const& correctedPos) const
+{
+    auto x = std::min(_gridSize.x - 1, static_cast<int>(correctedPos.x / _gridCellSize.x));
+    auto y = std::min(_gridSize.y - 1, static_cast<int>(correctedPos.y / _gridCellSize.y));
+    return x + y * _gridSize.x;
+}
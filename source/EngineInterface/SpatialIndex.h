@@ -0,0 +1,66 @@
+#pragma once
+
+#include "Base/Definitions.h"
+
+#include "Definitions.h"
+#include "DllExport.h"
+
+struct EntityReference
+{
+    int clusterIndex = -1;  //-1 for particles
+    int index = 0;          //index of the cell inside its cluster or index of the particle
+
+    bool isCell() const { return clusterIndex != -1; }
+    bool operator==(EntityReference const& other) const
+    {
+        return clusterIndex == other.clusterIndex && index == other.index;
+    }
+};
+
+/**
+ * Uniform grid over the cell and particle positions of a DataDescription in the periodic world. Entries are sorted
+ * into grid cells by counting sort, hence building is linear and queries only visit neighboring grid cells.
+ * The index refers to the description by cluster, cell and particle indices and has to be rebuilt after the
+ * description has been changed. Batched queries are processed concurrently.
+ */
+class SpatialIndex
+{
+public:
+    static float constexpr DefaultGridSpacing = 4.0f;
+
+    ENGINEINTERFACE_EXPORT SpatialIndex(
+        DataDescription const& data,
+        IntVector2D const& worldSize,
+        float gridSpacing = DefaultGridSpacing);
+
+    int getNumEntries() const { return toInt(_references.size()); }
+
+    //entities within radius sorted by grid cell
+    ENGINEINTERFACE_EXPORT std::vector<EntityReference> getEntitiesInRadius(RealVector2D const& pos, float radius) const;
+    ENGINEINTERFACE_EXPORT std::vector<std::vector<EntityReference>>
+    getEntitiesInRadius(std::vector<RealVector2D> const& positions, float radius) const;
+
+    //at most k entities sorted by ascending distance
+    ENGINEINTERFACE_EXPORT std::vector<EntityReference> getNearestEntities(RealVector2D const& pos, int k) const;
+    ENGINEINTERFACE_EXPORT std::vector<std::vector<EntityReference>>
+    getNearestEntities(std::vector<RealVector2D> const& positions, int k) const;
+
+    //rect may exceed the world boundaries, it is wrapped around accordingly
+    ENGINEINTERFACE_EXPORT std::vector<EntityReference> getEntitiesInRect(RealRect const& rect) const;
+
+private:
+    RealVector2D correctPosition(RealVector2D const& pos) const;
+    RealVector2D correctDisplacement(RealVector2D const& displacement) const;
+    int getGridCellIndex(RealVector2D const& correctedPos) const;
+
+    template <typename Func>
+    void forEachEntryInGridCell(int gridX, int gridY, Func const& func) const;
+
+    RealVector2D _worldSize;
+    IntVector2D _gridSize;
+    RealVector2D _gridCellSize;
+
+    std::vector<int> _gridCellOffsets;  //entries of grid cell i are [_gridCellOffsets[i], _gridCellOffsets[i + 1])
+    std::vector<RealVector2D> _positions;
+    std::vector<EntityReference> _references;
+};
@@ -0,0 +1,88 @@
+#include "SpotFactorGrid.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Base/Tracing.h"
+
+#include "SimulationParameters.h"
+
+float SpotFactorGrid::calcFactor(
+    SimulationParametersSpot const& spot,
+    RealVector2D const& pos,
+    IntVector2D const& worldSize)
+{
+    auto dx = std::remainder(pos.x - spot.posX, toFloat(worldSize.x));
+    auto dy = std::remainder(pos.y - spot.posY, toFloat(worldSize.y));
+    auto distance = std::sqrt(dx * dx + dy * dy);
+    auto fadeoutRadius = spot.fadeoutRadius + 1;
+    return distance < spot.coreRadius ? 0.0f : std::min(1.0f, (distance - spot.coreRadius) / fadeoutRadius);
+}
+
+float SpotFactorGrid::calcValue(
+    float SimulationParametersSpotValues::*value,
+    SimulationParameters const& parameters,
+    SimulationParametersSpots const& spots,
+    float const* factors)
+{
+    auto baseValue = parameters.spotValues.*value;
+    if (1 == spots.numSpots) {
+        return baseValue * factors[0] + spots.spots[0].values.*value * (1 - factors[0]);
+    }
+    if (2 == spots.numSpots) {
+        auto weight1 = factors[0] * factors[1];
+        auto weight2 = 1 - factors[0];
+        auto weight3 = 1 - factors[1];
+        auto sum = weight1 + weight2 + weight3;
+        return (baseValue * weight1 + spots.spots[0].values.*value * weight2 + spots.spots[1].values.*value * weight3)
+            / sum;
+    }
+    return baseValue;
+}
+
+bool SpotFactorGrid::update(SimulationParametersSpots const& spots, IntVector2D const& worldSize)
+{
+    auto isGeometryUnchanged = [&] {
+        if (spots.numSpots != _spots.numSpots) {
+            return false;
+        }
+        for (int i = 0; i < std::clamp(spots.numSpots, 0, MaxSpots); ++i) {
+            auto const& spot = spots.spots[i];
+            auto const& otherSpot = _spots.spots[i];
+            if (spot.posX != otherSpot.posX || spot.posY != otherSpot.posY || spot.coreRadius != otherSpot.coreRadius
+                || spot.fadeoutRadius != otherSpot.fadeoutRadius) {
+                return false;
+            }
+        }
+        return true;
+    };
+    if (_isValid && worldSize == _worldSize && isGeometryUnchanged()) {
+        _spots = spots;  //e.g. colors and values do not affect the factors
+        return false;
+    }
+    TRACE_SCOPE("SpotFactorGrid", "build");
+    _spots = spots;
+    _worldSize = worldSize;
+    _isValid = true;
+
+    auto numSpots = std::clamp(spots.numSpots, 0, MaxSpots);
+    _grid = PeriodicGrid(worldSize, _spacing, numSpots);
+    _grid.fill([&](RealVector2D const& pos, float* factors) {
+        for (int i = 0; i < numSpots; ++i) {
+            factors[i] = calcFactor(spots.spots[i], pos, worldSize);
+        }
+    });
+    return true;
+}
+
+float SpotFactorGrid::sampleValue(
+    float SimulationParametersSpotValues::*value,
+    SimulationParameters const& parameters,
+    RealVector2D const& pos) const
+{
+    float factors[MaxSpots] = {};
+    if (_spots.numSpots > 0) {
+        _grid.sample(pos, factors);
+    }
+    return calcValue(value, parameters, _spots, factors);
+}
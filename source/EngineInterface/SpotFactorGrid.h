@@ -0,0 +1,55 @@
+#pragma once
+
+#include "Base/PeriodicGrid.h"
+
+#include "Definitions.h"
+#include "DllExport.h"
+#include "SimulationParametersSpots.h"
+
+/**
+ * Blend factors of the spots on a low-resolution grid, so that evaluating spot-dependent values costs a bilinear
+ * lookup instead of periodic distance calculations. The grid is rebuilt only if the positions or radii of the spots or
+ * the world size change. The simulation and the background rendering sample the uploaded grid, see SpotCalculator.
+ */
+class SpotFactorGrid
+{
+public:
+    static float constexpr DefaultSpacing = 8.0f;
+    static int constexpr MaxSpots = std::extent_v<decltype(SimulationParametersSpots::spots)>;
+
+    //analytic factor: 0 inside the core radius rising to 1 at the end of the fadeout
+    ENGINEINTERFACE_EXPORT static float
+    calcFactor(SimulationParametersSpot const& spot, RealVector2D const& pos, IntVector2D const& worldSize);
+
+    //blends the parameter value with the spot values according to the factors of the spots
+    ENGINEINTERFACE_EXPORT static float calcValue(
+        float SimulationParametersSpotValues::*value,
+        SimulationParameters const& parameters,
+        SimulationParametersSpots const& spots,
+        float const* factors);
+
+    SpotFactorGrid(float spacing = DefaultSpacing)
+        : _spacing(spacing)
+    {}
+
+    //returns true if the grid has been rebuilt
+    ENGINEINTERFACE_EXPORT bool update(SimulationParametersSpots const& spots, IntVector2D const& worldSize);
+
+    int getNumSpots() const { return _grid.getNumChannels(); }
+    PeriodicGrid const& getGrid() const { return _grid; }
+
+    //writes one factor per spot
+    void sampleFactors(RealVector2D const& pos, float* factors) const { _grid.sample(pos, factors); }
+
+    ENGINEINTERFACE_EXPORT float sampleValue(
+        float SimulationParametersSpotValues::*value,
+        SimulationParameters const& parameters,
+        RealVector2D const& pos) const;
+
+private:
+    float _spacing;
+    bool _isValid = false;
+    SimulationParametersSpots _spots;
+    IntVector2D _worldSize = {0, 0};
+    PeriodicGrid _grid;
+};
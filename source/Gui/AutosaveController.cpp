@@ -2,6 +2,7 @@
 
 #include "imgui.h"
 
+#include "EngineInterface/DescriptionArena.h"
 #include "EngineInterface/Serializer.h"
 #include "Resources.h"
 #include "GlobalSettings.h"
@@ -51,12 +52,15 @@ void _AutosaveController::process()
 
 void _AutosaveController::onSave()
 {
-    DeserializedSimulation sim;
+    DescriptionArena arena;
+    DeserializedSimulation sim(arena.getAllocator());
     sim.timestep = static_cast<uint32_t>(_simController->getCurrentTimestep());
     sim.settings = _simController->getSettings();
     sim.symbolMap = _simController->getSymbolMap();
-    sim.content = _simController->getSimulationData(
-        {-1000, -1000}, {_simController->getWorldSize().x + 1000, _simController->getWorldSize().y + 1000});
+    _simController->getSimulationData(
+        {-1000, -1000},
+        {_simController->getWorldSize().x + 1000, _simController->getWorldSize().y + 1000},
+        sim.content);
     Serializer serializer = boost::make_shared<_Serializer>();
     serializer->serializeSimulationToFile(Const::AutosaveFile, sim);
 }
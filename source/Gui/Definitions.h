@@ -57,6 +57,9 @@ using ColorizeDialog = boost::shared_ptr<_ColorizeDialog>;
 class _LogWindow;
 using LogWindow = boost::shared_ptr<_LogWindow>;
 
+class _TracingWindow;
+using TracingWindow = boost::shared_ptr<_TracingWindow>;
+
 class _SimpleLogger;
 using SimpleLogger = boost::shared_ptr<_SimpleLogger>;
 
@@ -25,3 +25,11 @@ void _FileLogger::newLogMessage(Priority priority, std::string const& message)
 {
     _outfile << message << std::endl;
 }
+
+void _FileLogger::newLogMessages(std::vector<LogMessage> const& messages)
+{
+    for (auto const& message : messages) {
+        _outfile << message.message << '\n';
+    }
+    _outfile.flush();
+}
@@ -13,6 +13,7 @@ public:
     virtual ~_FileLogger();
 
     void newLogMessage(Priority priority, std::string const& message) override;
+    void newLogMessages(std::vector<LogMessage> const& messages) override;
 
 private:
     std::ofstream _outfile;
@@ -52,7 +52,7 @@ void _FlowGeneratorWindow::process()
             "##Flow",
             ImGuiTabBarFlags_AutoSelectNewTabs | ImGuiTabBarFlags_FittingPolicyResizeDown)) {
 
-        if (flowFieldSettings.numCenters < 2) {
+        if (flowFieldSettings.numCenters < FlowFieldSettings::MaxCenters) {
             if (ImGui::TabItemButton("+", ImGuiTabItemFlags_Trailing | ImGuiTabItemFlags_NoTooltip)) {
                 auto index = flowFieldSettings.numCenters;
                 flowFieldSettings.centers[index] = createFlowCenter();
@@ -41,6 +41,7 @@
 #include "AboutDialog.h"
 #include "ColorizeDialog.h"
 #include "LogWindow.h"
+#include "TracingWindow.h"
 #include "SimpleLogger.h"
 #include "UiController.h"
 #include "GlobalSettings.h"
@@ -124,6 +125,7 @@ _MainWindow::_MainWindow(SimulationController const& simController, SimpleLogger
     _aboutDialog = boost::make_shared<_AboutDialog>();
     _colorizeDialog = boost::make_shared<_ColorizeDialog>(_simController);
     _logWindow = boost::make_shared<_LogWindow>(_styleRepository, _logger);
+    _tracingWindow = boost::make_shared<_TracingWindow>();
     _gettingStartedWindow = boost::make_shared<_GettingStartedWindow>(_styleRepository);
     _openSimulationDialog = boost::make_shared<_OpenSimulationDialog>(_simController, _statisticsWindow, _viewport);
     _saveSimulationDialog = boost::make_shared<_SaveSimulationDialog>(_simController);
@@ -155,8 +157,10 @@ _MainWindow::_MainWindow(SimulationController const& simController, SimpleLogger
 void _MainWindow::mainLoop()
 {
     bool show_demo_window = true;
+    TracingService::getInstance().setThreadName("GUI");
     while (!glfwWindowShouldClose(_window) && !_onClose)
     {
+        TRACE_SCOPE("Gui", "frame");
         glfwPollEvents();
 
         ImGui_ImplOpenGL3_NewFrame();
@@ -389,6 +393,9 @@ void _MainWindow::processMenubar()
             if (ImGui::MenuItem("Log", "ALT+6", _logWindow->isOn())) {
                 _logWindow->setOn(!_logWindow->isOn());
             }
+            if (ImGui::MenuItem("Tracing", "ALT+7", _tracingWindow->isOn())) {
+                _tracingWindow->setOn(!_tracingWindow->isOn());
+            }
             AlienImGui::EndMenuButton();
         }
 
@@ -489,6 +496,9 @@ void _MainWindow::processMenubar()
     if (io.KeyAlt && ImGui::IsKeyPressed(GLFW_KEY_6)) {
         _logWindow->setOn(!_logWindow->isOn());
     }
+    if (io.KeyAlt && ImGui::IsKeyPressed(GLFW_KEY_7)) {
+        _tracingWindow->setOn(!_tracingWindow->isOn());
+    }
 
     if (io.KeyAlt && ImGui::IsKeyPressed(GLFW_KEY_E)) {
         _modeWindow->setMode(
@@ -541,6 +551,7 @@ void _MainWindow::processWindows()
     _simulationParametersWindow->process();
     _flowGeneratorWindow->process();
     _logWindow->process();
+    _tracingWindow->process();
     _gettingStartedWindow->process();
 }
 
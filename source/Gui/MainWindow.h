@@ -48,6 +48,7 @@ private:
     StartupWindow _startupWindow;
     FlowGeneratorWindow _flowGeneratorWindow;
     LogWindow _logWindow;
+    TracingWindow _tracingWindow;
     NewSimulationDialog _newSimulationDialog;
     AboutDialog _aboutDialog;
     ColorizeDialog _colorizeDialog;
@@ -3,6 +3,7 @@
 #include "imgui.h"
 #include "ImFileDialog.h"
 
+#include "EngineInterface/DescriptionArena.h"
 #include "EngineInterface/Serializer.h"
 #include "EngineInterface/ChangeDescriptions.h"
 #include "EngineImpl/SimulationController.h"
@@ -32,7 +33,8 @@ void _OpenSimulationDialog::process()
 
         Serializer serializer = boost::make_shared<_Serializer>();
 
-        DeserializedSimulation deserializedData;
+        DescriptionArena arena;
+        DeserializedSimulation deserializedData(arena.getAllocator());
         serializer->deserializeSimulationFromFile(firstFilename.string(), deserializedData);
 
         _simController->newSimulation(deserializedData.timestep, deserializedData.settings, deserializedData.symbolMap);
@@ -4,6 +4,7 @@
 
 #include "EngineImpl/SimulationController.h"
 #include "EngineInterface/ChangeDescriptions.h"
+#include "EngineInterface/DescriptionArena.h"
 #include "EngineInterface/Serializer.h"
 #include "ImFileDialog.h"
 
@@ -20,11 +21,12 @@ void _SaveSimulationDialog::process()
         const std::vector<std::filesystem::path>& res = ifd::FileDialog::Instance().GetResults();
         auto firstFilename = res.front();
 
-        DeserializedSimulation sim;
+        DescriptionArena arena;
+        DeserializedSimulation sim(arena.getAllocator());
         sim.timestep = static_cast<uint32_t>(_simController->getCurrentTimestep());
         sim.settings = _simController->getSettings();
         sim.symbolMap = _simController->getSymbolMap();
-        sim.content = _simController->getSimulationData({0, 0}, _simController->getWorldSize());
+        _simController->getSimulationData({0, 0}, _simController->getWorldSize(), sim.content);
 
         Serializer serializer = boost::make_shared<_Serializer>();
         serializer->serializeSimulationToFile(firstFilename.string(), sim);
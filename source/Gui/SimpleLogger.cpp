@@ -15,8 +15,20 @@ _SimpleLogger::~_SimpleLogger()
     loggingService->unregisterCallBack(this);
 }
 
-std::vector<std::string> const& _SimpleLogger::getMessages(Priority minPriority) const
+std::vector<std::string> const& _SimpleLogger::getMessages(Priority minPriority)
 {
+    std::vector<LogMessage> pendingLogMessages;
+    {
+        std::lock_guard<std::mutex> lock(_pendingMutex);
+        std::swap(pendingLogMessages, _pendingLogMessages);
+    }
+    for (auto& message : pendingLogMessages) {
+        if (Priority::Important == message.priority) {
+            _importantLogMessages.emplace_back(message.message);
+        }
+        _allLogMessages.emplace_back(std::move(message.message));
+    }
+
     if (Priority::Important == minPriority) {
         return _importantLogMessages;
     }
@@ -25,8 +37,12 @@ std::vector<std::string> const& _SimpleLogger::getMessages(Priority minPriority)
 
 void _SimpleLogger::newLogMessage(Priority priority, std::string const& message)
 {
-    _allLogMessages.emplace_back(message);
-    if (Priority::Important == priority) {
-        _importantLogMessages.emplace_back(message);
-    }
+    std::lock_guard<std::mutex> lock(_pendingMutex);
+    _pendingLogMessages.emplace_back(LogMessage{priority, message});
+}
+
+void _SimpleLogger::newLogMessages(std::vector<LogMessage> const& messages)
+{
+    std::lock_guard<std::mutex> lock(_pendingMutex);
+    _pendingLogMessages.insert(_pendingLogMessages.end(), messages.begin(), messages.end());
 }
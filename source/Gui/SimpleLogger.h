@@ -1,5 +1,7 @@
 #pragma once
 
+#include <mutex>
+
 #include "Base/LoggingService.h"
 #include "Definitions.h"
 
@@ -9,12 +11,17 @@ public:
     _SimpleLogger();
     virtual ~_SimpleLogger();
 
-    std::vector<std::string> const& getMessages(Priority minPriority) const;
+    //must be called from the GUI thread only
+    std::vector<std::string> const& getMessages(Priority minPriority);
 
 private:
 
     void newLogMessage(Priority priority, std::string const& message) override;
+    void newLogMessages(std::vector<LogMessage> const& messages) override;
 
     std::vector<std::string> _allLogMessages;
     std::vector<std::string> _importantLogMessages;
+
+    std::mutex _pendingMutex;  //messages arrive on the logging thread
+    std::vector<LogMessage> _pendingLogMessages;
 };
@@ -2,6 +2,8 @@
 
 #include "imgui.h"
 
+#include "Base/LoggingService.h"
+#include "Base/ServiceLocator.h"
 #include "Base/StringFormatter.h"
 #include "EngineInterface/ChangeDescriptions.h"
 #include "EngineInterface/DescriptionHelper.h"
@@ -34,6 +36,8 @@ _SpatialControlWindow::~_SpatialControlWindow()
 
 void _SpatialControlWindow::process()
 {
+    processResizeOperation();
+
     if (!_on) {
         return;
     }
@@ -115,6 +119,9 @@ void _SpatialControlWindow::processZoomOutButton()
 
 void _SpatialControlWindow::processResizeButton()
 {
+    if (_fetchOperation.isValid() || _uploadOperation.isValid()) {
+        return;
+    }
     if (ImGui::ImageButton((void*)(intptr_t)_resizeTexture.textureId, {32.0f, 32.0f}, {0, 0}, {1.0f, 1.0f})) {
         _showResizeDialog = true;
         auto worldSize = _simController->getWorldSize();
@@ -192,24 +199,134 @@ void _SpatialControlWindow::processResizeDialog()
     }
 }
 
+void _SpatialControlWindow::processResizeOperation()
+{
+    if (_fetchOperation.isValid() && _fetchOperation.isReady()) {
+        try {
+            auto content = _fetchOperation.get();
+            onSimulationDataFetched(content);
+        } catch (AsyncOperationCanceledException const&) {
+        } catch (std::exception const& e) {
+            onResizingFailed(e.what());
+        }
+        _fetchOperation = AsyncOperation<DataDescription>();
+    }
+    if (_uploadOperation.isValid() && _uploadOperation.isReady()) {
+        auto uploadOperation = std::move(_uploadOperation);
+        _uploadOperation = AsyncOperation<void>();
+        try {
+            uploadOperation.get();
+            _originalWorld = boost::none;
+        } catch (AsyncOperationCanceledException const&) {
+            onResizingCanceled();
+        } catch (std::exception const& e) {
+            onResizingFailed(e.what());
+        }
+    }
+
+    auto isFetching = _fetchOperation.isValid();
+    auto isUploading = _uploadOperation.isValid();
+    if (isFetching || isUploading) {
+        ImGui::OpenPopup("Resizing world");
+    }
+    ImGui::SetNextWindowPos(ImGui::GetMainViewport()->GetCenter(), ImGuiCond_Appearing, ImVec2(0.5f, 0.5f));
+    if (ImGui::BeginPopupModal("Resizing world", NULL, ImGuiWindowFlags_AlwaysAutoResize)) {
+        if (isFetching) {
+            ImGui::Text("Reading simulation data");
+            ImGui::ProgressBar(_fetchOperation.getProgress(), ImVec2(250, 0));
+            AlienImGui::Separator();
+            if (ImGui::Button("Cancel")) {
+                _fetchOperation.cancel();
+            }
+        } else if (isUploading) {
+            ImGui::Text(_originalWorld ? "Transferring simulation data" : "Restoring original world");
+            ImGui::ProgressBar(_uploadOperation.getProgress(), ImVec2(250, 0));
+            if (_originalWorld) {
+                AlienImGui::Separator();
+                if (ImGui::Button("Cancel")) {
+                    _uploadOperation.cancel();
+                }
+            }
+        } else {
+            ImGui::CloseCurrentPopup();
+        }
+        ImGui::EndPopup();
+    }
+    processResizeErrorDialog();
+}
+
+void _SpatialControlWindow::processResizeErrorDialog()
+{
+    if (!_resizeErrorMessage) {
+        return;
+    }
+    ImGui::OpenPopup("Resizing failed");
+    ImGui::SetNextWindowPos(ImGui::GetMainViewport()->GetCenter(), ImGuiCond_Appearing, ImVec2(0.5f, 0.5f));
+    if (ImGui::BeginPopupModal("Resizing failed", NULL, ImGuiWindowFlags_AlwaysAutoResize)) {
+        ImGui::Text("The world could not be resized:");
+        ImGui::TextUnformatted(_resizeErrorMessage->c_str());
+        AlienImGui::Separator();
+        if (ImGui::Button("OK")) {
+            ImGui::CloseCurrentPopup();
+            _resizeErrorMessage = boost::none;
+        }
+        ImGui::SetItemDefaultFocus();
+        ImGui::EndPopup();
+    }
+}
+
 void _SpatialControlWindow::onResizing()
+{
+    _fetchOperation = _simController->getSimulationData_async({0, 0}, _simController->getWorldSize());
+}
+
+void _SpatialControlWindow::onSimulationDataFetched(DataDescription& content)
 {
     auto timestep = static_cast<uint32_t>(_simController->getCurrentTimestep());
     auto settings = _simController->getSettings();
     auto symbolMap = _simController->getSymbolMap();
-    auto content = _simController->getSimulationData({0, 0}, _simController->getWorldSize());
 
     _simController->closeSimulation();
 
+    _originalWorld = OriginalWorld{timestep, settings, content};
+
     IntVector2D origWorldSize{settings.generalSettings.worldSizeX, settings.generalSettings.worldSizeY};
     settings.generalSettings.worldSizeX = _width;
     settings.generalSettings.worldSizeY = _height;
     
     _simController->newSimulation(timestep, settings, symbolMap);
 
-    DescriptionHelper::correctConnections(content, {_width, _height});
-    if (_scaleContent) {
-        DescriptionHelper::duplicate(content, origWorldSize, {_width, _height});
+    //adapting the content to the new world size runs on a helper thread
+    IntVector2D worldSize{_width, _height};
+    auto scaleContent = _scaleContent;
+    _uploadOperation = _simController->setSimulationData_async(std::move(content), [=](DataDescription& data) {
+        DescriptionNavigator navigator;
+        navigator.update(data);
+        DescriptionHelper::correctConnections(data, navigator, worldSize);
+        if (scaleContent) {
+            DescriptionHelper::duplicate(data, navigator, origWorldSize, worldSize);
+        }
+    });
+}
+
+void _SpatialControlWindow::onResizingCanceled()
+{
+    if (!_originalWorld) {
+        return;
     }
-    _simController->setSimulationData(content);
+    auto symbolMap = _simController->getSymbolMap();
+    _simController->closeSimulation();
+    _simController->newSimulation(_originalWorld->timestep, _originalWorld->settings, symbolMap);
+    _uploadOperation = _simController->setSimulationData_async(_originalWorld->content);
+    _originalWorld = boost::none;
+}
+
+void _SpatialControlWindow::onResizingFailed(std::string const& message)
+{
+    //the original world is only set after fetching => a failed transfer restores it
+    onResizingCanceled();
+    _resizeErrorMessage = message;
+
+    auto loggingService = ServiceLocator::getInstance().getService<LoggingService>();
+    loggingService->logMessage(Priority::Important, "resizing the world failed: " + message);
 }
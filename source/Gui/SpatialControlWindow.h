@@ -1,7 +1,9 @@
 #pragma once
 
 #include "EngineImpl/Definitions.h"
+#include "EngineInterface/AsyncOperation.h"
 #include "EngineInterface/Descriptions.h"
+#include "EngineInterface/Settings.h"
 
 #include "Definitions.h"
 
@@ -26,8 +28,13 @@ private:
     void processZoomSensitivitySlider();
 
     void processResizeDialog();
+    void processResizeOperation();
+    void processResizeErrorDialog();
 
     void onResizing();
+    void onSimulationDataFetched(DataDescription& content);
+    void onResizingCanceled();
+    void onResizingFailed(std::string const& message);
 
     SimulationController _simController;
     Viewport _viewport;
@@ -42,4 +49,18 @@ private:
     bool _scaleContent = false;
     int _width = 0;
     int _height = 0;
+
+    //resizing is performed in background: fetch data from old simulation, then upload it to the new one
+    AsyncOperation<DataDescription> _fetchOperation;
+    AsyncOperation<void> _uploadOperation;
+
+    //world before resizing, restored if the upload is canceled
+    struct OriginalWorld
+    {
+        uint64_t timestep;
+        Settings settings;
+        DataDescription content;
+    };
+    boost::optional<OriginalWorld> _originalWorld;
+    boost::optional<std::string> _resizeErrorMessage;
 };
\ No newline at end of file
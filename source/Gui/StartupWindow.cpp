@@ -4,6 +4,7 @@
 
 #include "Base/Definitions.h"
 #include "EngineInterface/ChangeDescriptions.h"
+#include "EngineInterface/DescriptionArena.h"
 #include "EngineInterface/Serializer.h"
 #include "EngineImpl/SimulationController.h"
 #include "OpenGLHelper.h"
@@ -41,7 +42,8 @@ void _StartupWindow::process()
     if (_state == State::RequestLoading) {
         Serializer serializer = boost::make_shared<_Serializer>();
 
-        DeserializedSimulation deserializedData;
+        DescriptionArena arena;
+        DeserializedSimulation deserializedData(arena.getAllocator());
         serializer->deserializeSimulationFromFile(Const::AutosaveFile, deserializedData);
 
         _simController->newSimulation(deserializedData.timestep, deserializedData.settings, deserializedData.symbolMap);
@@ -164,6 +164,12 @@ void _StatisticsWindow::processLiveStatistics()
         ImPlot::PopColormap();
         ImGui::EndTable();
     }
+
+    ImGui::Spacing();
+    ImGui::Text(
+        "Parameter uploads: %s (%s bytes)",
+        StringFormatter::format(_liveStatistics.numParameterUploads).c_str(),
+        StringFormatter::format(_liveStatistics.parameterUploadBytes).c_str());
 }
 
 void _StatisticsWindow::processLongtermStatistics()
@@ -365,6 +371,8 @@ void _StatisticsWindow::LiveStatistics::add(OverallStatistics const& newStatisti
     numSuccessfulAttacksHistory.emplace_back(toFloat(newStatistics.numSuccessfulAttacks));
     numFailedAttacksHistory.emplace_back(toFloat(newStatistics.numFailedAttacks));
     numMuscleActivitiesHistory.emplace_back(toFloat(newStatistics.numMuscleActivities));
+    numParameterUploads = newStatistics.numParameterUploads;
+    parameterUploadBytes = newStatistics.parameterUploadBytes;
 }
 
 void _StatisticsWindow::LongtermStatistics::add(OverallStatistics const& newStatistics)
@@ -42,6 +42,8 @@ private:
         std::vector<float> numSuccessfulAttacksHistory;
         std::vector<float> numFailedAttacksHistory;
         std::vector<float> numMuscleActivitiesHistory;
+        uint64_t numParameterUploads = 0;
+        uint64_t parameterUploadBytes = 0;
 
         void truncate();
         void add(OverallStatistics const& statistics);
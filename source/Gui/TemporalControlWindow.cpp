@@ -149,7 +149,7 @@ void _TemporalControlWindow::processStepBackwardButton()
     if (ImGui::ImageButton((void*)(intptr_t)_stepBackwardTexture.textureId, {32.0f, 32.0f}, {0, 0}, {1.0f, 1.0f})) {
         auto const& snapshot = _history.back();
         _simController->setCurrentTimestep(snapshot.timestep);
-        _simController->setSimulationData(snapshot.data);
+        _simController->setSimulationData(snapshot.data->getData());
         _history.pop_back();
     }
     ImGui::EndDisabled();
@@ -162,8 +162,9 @@ void _TemporalControlWindow::processStepForwardButton()
         Snapshot newSnapshot;
         newSnapshot.timestep = _simController->getCurrentTimestep();
         auto size = _simController->getWorldSize();
-        newSnapshot.data = _simController->getSimulationData({0, 0}, size);
-        _history.emplace_back(newSnapshot);
+        newSnapshot.data = boost::make_shared<DescriptionArena>();
+        _simController->getSimulationData({0, 0}, size, newSnapshot.data->getData());
+        _history.emplace_back(std::move(newSnapshot));
 
         _simController->calcSingleTimestep();
     }
@@ -176,8 +177,9 @@ void _TemporalControlWindow::processSnapshotButton()
         Snapshot newSnapshot;
         newSnapshot.timestep = _simController->getCurrentTimestep();
         auto size = _simController->getWorldSize();
-        newSnapshot.data = _simController->getSimulationData({0, 0}, size);
-        _snapshot = newSnapshot;
+        newSnapshot.data = boost::make_shared<DescriptionArena>();
+        _simController->getSimulationData({0, 0}, size, newSnapshot.data->getData());
+        _snapshot = std::move(newSnapshot);
     }
 }
 
@@ -187,7 +189,7 @@ void _TemporalControlWindow::processRestoreButton()
     if (ImGui::ImageButton((void*)(intptr_t)_restoreTexture.textureId, {32.0f, 32.0f}, {0, 0}, {1.0f, 1.0f})) {
         _statisticsWindow->reset();
         _simController->setCurrentTimestep(_snapshot->timestep);
-        _simController->setSimulationData(_snapshot->data);
+        _simController->setSimulationData(_snapshot->data->getData());
     }
     ImGui::EndDisabled();
 }
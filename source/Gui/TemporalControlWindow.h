@@ -1,6 +1,6 @@
 #pragma once
 
-#include "EngineInterface/Descriptions.h"
+#include "EngineInterface/DescriptionArena.h"
 #include "EngineImpl/Definitions.h"
 
 #include "Definitions.h"
@@ -42,10 +42,11 @@ private:
     TextureData _snapshotTexture;
     TextureData _restoreTexture;
 
+    //the description of a snapshot is built in its own arena, hence dropping it does not visit every cell
     struct Snapshot
     {
         uint64_t timestep;
-        DataDescription data;
+        boost::shared_ptr<DescriptionArena> data;
     };
     boost::optional<Snapshot> _snapshot;
 
@@ -0,0 +1,104 @@
+#include "TracingWindow.h"
+
+#include <imgui.h>
+
+#include "Base/LoggingService.h"
+#include "Base/ServiceLocator.h"
+#include "Base/StringFormatter.h"
+#include "StyleRepository.h"
+#include "GlobalSettings.h"
+
+namespace
+{
+    std::chrono::milliseconds const UpdateInterval(1000);
+    auto const TraceFilename = "trace.json";
+}
+
+_TracingWindow::_TracingWindow()
+{
+    _on = GlobalSettings::getInstance().getBoolState("windows.tracing.active", false);
+}
+
+_TracingWindow::~_TracingWindow()
+{
+    GlobalSettings::getInstance().setBoolState("windows.tracing.active", _on);
+}
+
+void _TracingWindow::process()
+{
+    if (!_on) {
+        return;
+    }
+    updateData();
+
+    ImGui::SetNextWindowBgAlpha(Const::WindowAlpha * ImGui::GetStyle().Alpha);
+    if (ImGui::Begin("Tracing", &_on)) {
+        auto& tracingService = TracingService::getInstance();
+        if (!TracingService::isCompiledIn()) {
+            ImGui::TextWrapped("Tracing is not available since this build has been configured without ALIEN_TRACING.");
+            ImGui::End();
+            return;
+        }
+
+        auto recording = tracingService.isRecording();
+        if (ImGui::Checkbox("Recording", &recording)) {
+            tracingService.setRecording(recording);
+        }
+        ImGui::SameLine();
+        if (ImGui::Button("Save trace")) {
+            tracingService.writeChromeTrace(TraceFilename);
+            auto loggingService = ServiceLocator::getInstance().getService<LoggingService>();
+            loggingService->logMessage(Priority::Important, std::string("trace written to ") + TraceFilename);
+        }
+
+        ImGui::Spacing();
+        if (ImGui::BeginTable(
+                "##", 3, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersOuter, ImVec2(-1, 0))) {
+            ImGui::TableSetupColumn("Subsystem");
+            ImGui::TableSetupColumn("Self time [ms/s]", ImGuiTableColumnFlags_WidthFixed, 120.0f);
+            ImGui::TableSetupColumn("Spans [1/s]", ImGuiTableColumnFlags_WidthFixed, 90.0f);
+            ImGui::TableHeadersRow();
+
+            for (auto const& subsystemTime : _subsystemTimes) {
+                ImGui::TableNextRow();
+                ImGui::TableSetColumnIndex(0);
+                ImGui::TextUnformatted(subsystemTime.subsystem.c_str());
+                ImGui::TableSetColumnIndex(1);
+                ImGui::TextUnformatted(
+                    StringFormatter::format(toFloat(subsystemTime.selfTime * 1000 / _intervalDuration), 1).c_str());
+                ImGui::TableSetColumnIndex(2);
+                ImGui::TextUnformatted(
+                    StringFormatter::format(static_cast<uint64_t>(toFloat(subsystemTime.numSpans) / _intervalDuration)).c_str());
+            }
+            ImGui::EndTable();
+        }
+    }
+    ImGui::End();
+}
+
+bool _TracingWindow::isOn() const
+{
+    return _on;
+}
+
+void _TracingWindow::setOn(bool value)
+{
+    _on = value;
+}
+
+void _TracingWindow::updateData()
+{
+    auto now = std::chrono::steady_clock::now();
+    auto& tracingService = TracingService::getInstance();
+    if (!_intervalStart) {
+        tracingService.resetSubsystemTimes();
+        _intervalStart = now;
+        return;
+    }
+    if (now - *_intervalStart > UpdateInterval) {
+        _subsystemTimes = tracingService.getSubsystemTimes();
+        tracingService.resetSubsystemTimes();
+        _intervalDuration = std::chrono::duration<double>(now - *_intervalStart).count();
+        _intervalStart = now;
+    }
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <chrono>
+
+#include "Base/Tracing.h"
+#include "Definitions.h"
+
+class _TracingWindow
+{
+public:
+    _TracingWindow();
+    ~_TracingWindow();
+
+    void process();
+
+    bool isOn() const;
+    void setOn(bool value);
+
+private:
+    void updateData();
+
+    bool _on = false;
+
+    //self times of the last completed interval
+    std::vector<SubsystemTime> _subsystemTimes;
+    double _intervalDuration = 0;  //in seconds
+    boost::optional<std::chrono::steady_clock::time_point> _intervalStart;
+};
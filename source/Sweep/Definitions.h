@@ -0,0 +1,19 @@
+#pragma once
+
+#include "Base/Definitions.h"
+#include "EngineInterface/OverallStatistics.h"
+
+struct SweepJob
+{
+    int id = 0;
+    std::vector<std::pair<std::string, std::string>> overrides;  //parameter key in settings file -> value
+};
+
+struct SweepResult
+{
+    int jobId = 0;
+    bool successful = false;
+    std::string errorMessage;
+    double duration = 0;  //in seconds
+    OverallStatistics finalStatistics;
+};
@@ -0,0 +1,61 @@
+#include <filesystem>
+#include <iostream>
+
+#include "ProcessSweepBackend.h"
+#include "ResultTable.h"
+#include "SweepPlanner.h"
+#include "SweepScheduler.h"
+#include "SweepSpecification.h"
+
+namespace
+{
+    std::string getDefaultCliFilename(char const* executableFilename)
+    {
+        auto directory = std::filesystem::path(executableFilename).parent_path();
+#if defined(_WIN32)
+        return (directory / "alien-cli.exe").string();
+#else
+        return (directory / "alien-cli").string();
+#endif
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc != 2) {
+        std::cerr << "Usage: alien-sweep <sweep.json>" << std::endl;
+        return 1;
+    }
+
+    try {
+        auto specification = SweepSpecification::load(argv[1]);
+        auto jobs = SweepPlanner::createJobs(specification);
+        auto cliFilename =
+            specification.cliFilename.empty() ? getDefaultCliFilename(argv[0]) : specification.cliFilename;
+
+        auto backend = boost::make_shared<ProcessSweepBackend>(specification, cliFilename);
+        SweepScheduler scheduler(backend, specification.maxConcurrentRuns, specification.memoryBudget * 1024 * 1024);
+
+        std::cout << jobs.size() << " runs scheduled" << std::endl;
+        int numFinished = 0;
+        auto results = scheduler.run(jobs, [&](SweepResult const& result) {
+            ++numFinished;
+            std::cout << "[" << numFinished << "/" << jobs.size() << "] run " << result.jobId << ": "
+                      << (result.successful ? "finished" : "failed: " + result.errorMessage) << std::endl;
+        });
+
+        auto resultFilename = (std::filesystem::path(specification.outputDirectory) / "results.csv").string();
+        ResultTable::write(resultFilename, specification, jobs, results);
+        std::cout << "results written to " << resultFilename << std::endl;
+
+        for (auto const& result : results) {
+            if (!result.successful) {
+                return 1;
+            }
+        }
+    } catch (std::exception const& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,179 @@
+#include "ProcessSweepBackend.h"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <regex>
+#include <sstream>
+
+#include <boost/process.hpp>
+#include <boost/property_tree/json_parser.hpp>
+
+#include "Base/FlatJsonReader.h"
+#include "EngineInterface/Parser.h"
+#include "EngineInterface/Settings.h"
+
+namespace
+{
+    //the in-memory data and the GPU arrays are much larger than the compact file representation
+    uint64_t const MemoryPerFileByte = 50;
+
+    //GPU maps hold two cell pointers and one particle pointer per world position
+    uint64_t const MemoryPerWorldPosition = 3 * sizeof(void*);
+
+    std::string const WorldSizeXKey = "general.world size.x";
+    std::string const WorldSizeYKey = "general.world size.y";
+
+    std::string replaceFileEnding(std::string const& filename, std::string const& ending)
+    {
+        std::regex fileEndingExpr("\\.\\w+$");
+        return std::regex_replace(filename, fileEndingExpr, ending);
+    }
+}
+
+ProcessSweepBackend::ProcessSweepBackend(SweepSpecification const& specification, std::string const& cliFilename)
+    : _specification(specification)
+    , _cliFilename(cliFilename)
+{
+    std::ifstream settingsStream(replaceFileEnding(specification.baseFilename, ".settings.json"));
+    std::string settingsJson(
+        (std::istreambuf_iterator<char>(settingsStream)), std::istreambuf_iterator<char>());
+    auto generalSettings = Parser::decodeTimestepAndSettings(settingsJson).second.generalSettings;
+    _baseWorldSize = {generalSettings.worldSizeX, generalSettings.worldSizeY};
+
+    if (specification.memoryPerRun > 0) {
+        auto memoryPerRun = specification.memoryPerRun * 1024 * 1024;
+        _contentMemoryPerRun = memoryPerRun - std::min(memoryPerRun, getMapMemory(_baseWorldSize));
+    } else {
+        _contentMemoryPerRun = std::filesystem::file_size(specification.baseFilename) * MemoryPerFileByte;
+    }
+    std::filesystem::create_directories(specification.outputDirectory);
+}
+
+uint64_t ProcessSweepBackend::estimateMemory(SweepJob const& job) const
+{
+    return _contentMemoryPerRun + getMapMemory(getWorldSize(job));
+}
+
+SweepResult ProcessSweepBackend::run(SweepJob const& job)
+{
+    SweepResult result;
+    result.jobId = job.id;
+
+    auto simFilename = getRunFilename(job, ".sim");
+    auto statisticsFilename = getRunFilename(job, ".csv");
+    auto logFilename = getRunFilename(job, ".log");
+    writeSimulationFiles(job, simFilename);
+
+    //arguments are passed without a shell so that file names need no quoting
+    std::vector<std::string> arguments = {"-q", "-i", simFilename, "-o", simFilename};
+    if (_specification.timesteps) {
+        arguments.insert(arguments.end(), {"-t", std::to_string(*_specification.timesteps)});
+    }
+    if (_specification.maxDuration) {
+        std::ostringstream maxDuration;
+        maxDuration << *_specification.maxDuration;
+        arguments.insert(arguments.end(), {"-d", maxDuration.str()});
+    }
+    //runs differ only in their parameters
+    arguments.insert(arguments.end(), {"--seed", std::to_string(_specification.seed)});
+    arguments.insert(arguments.end(), {"--statistics", statisticsFilename});
+    arguments.insert(arguments.end(), {"--statistics-interval", std::to_string(_specification.statisticsInterval)});
+
+    auto startTime = std::chrono::steady_clock::now();
+    int exitCode = 0;
+    try {
+        boost::process::child process(
+            boost::process::exe = _cliFilename,
+            boost::process::args = arguments,
+            (boost::process::std_out & boost::process::std_err) > logFilename);
+        process.wait();
+        exitCode = process.exit_code();
+    } catch (boost::process::process_error const& e) {
+        result.errorMessage = "alien-cli could not be started: " + std::string(e.what());
+        return result;
+    }
+    result.duration = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+    if (0 != exitCode) {
+        result.errorMessage = "alien-cli failed with exit code " + std::to_string(exitCode) + ", see " + logFilename;
+        return result;
+    }
+    result.finalStatistics = readFinalStatistics(statisticsFilename);
+    result.successful = true;
+    return result;
+}
+
+void ProcessSweepBackend::writeSimulationFiles(SweepJob const& job, std::string const& filename) const
+{
+    auto const& baseFilename = _specification.baseFilename;
+    std::filesystem::copy_file(baseFilename, filename, std::filesystem::copy_options::overwrite_existing);
+    std::filesystem::copy_file(
+        replaceFileEnding(baseFilename, ".symbols.json"),
+        replaceFileEnding(filename, ".symbols.json"),
+        std::filesystem::copy_options::overwrite_existing);
+
+    boost::property_tree::ptree tree;
+    boost::property_tree::read_json(replaceFileEnding(baseFilename, ".settings.json"), tree);
+    for (auto const& [key, value] : job.overrides) {
+        tree.put(key, value);
+    }
+
+    //round trip through the parser so that the written file only contains known and valid parameters
+    auto [timestep, settings] = Parser::decodeTimestepAndSettings(tree);
+    auto encodedTree = Parser::encode(timestep, settings);
+    for (auto const& override : job.overrides) {
+        if (!encodedTree.get_optional<std::string>(override.first)) {
+            throw std::runtime_error("Unknown parameter '" + override.first + "'.");
+        }
+    }
+    boost::property_tree::json_parser::write_json(replaceFileEnding(filename, ".settings.json"), encodedTree);
+}
+
+OverallStatistics ProcessSweepBackend::readFinalStatistics(std::string const& statisticsFilename) const
+{
+    std::ifstream stream(statisticsFilename);
+    std::string line;
+    std::string lastLine;
+    while (std::getline(stream, line)) {
+        if (!line.empty()) {
+            lastLine = line;
+        }
+    }
+
+    OverallStatistics result;
+    std::replace(lastLine.begin(), lastLine.end(), ',', ' ');
+    std::istringstream lineStream(lastLine);
+    lineStream >> result.timeStep >> result.numCells >> result.numParticles >> result.numTokens
+        >> result.totalInternalEnergy >> result.numCreatedCells >> result.numSuccessfulAttacks
+        >> result.numFailedAttacks >> result.numMuscleActivities;
+    if (lineStream.fail()) {
+        throw std::runtime_error("No statistics found in " + statisticsFilename + ".");
+    }
+    return result;
+}
+
+IntVector2D ProcessSweepBackend::getWorldSize(SweepJob const& job) const
+{
+    auto result = _baseWorldSize;
+    for (auto const& [key, value] : job.overrides) {
+        if (key == WorldSizeXKey) {
+            FlatJsonReader::convert(value, result.x);
+        }
+        if (key == WorldSizeYKey) {
+            FlatJsonReader::convert(value, result.y);
+        }
+    }
+    return result;
+}
+
+uint64_t ProcessSweepBackend::getMapMemory(IntVector2D const& worldSize)
+{
+    return MemoryPerWorldPosition * std::max(0, worldSize.x) * std::max(0, worldSize.y);
+}
+
+std::string ProcessSweepBackend::getRunFilename(SweepJob const& job, std::string const& ending) const
+{
+    auto path = std::filesystem::path(_specification.outputDirectory) / ("run" + std::to_string(job.id) + ending);
+    return path.string();
+}
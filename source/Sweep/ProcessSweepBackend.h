@@ -0,0 +1,31 @@
+#pragma once
+
+#include "SweepBackend.h"
+#include "SweepSpecification.h"
+
+/**
+ * Executes each run in a separate alien-cli process. Simulation parameters live in process-wide CUDA constant
+ * memory, so several simulations with different parameters cannot share one process.
+ */
+class ProcessSweepBackend : public SweepBackend
+{
+public:
+    ProcessSweepBackend(SweepSpecification const& specification, std::string const& cliFilename);
+
+    uint64_t estimateMemory(SweepJob const& job) const override;
+    SweepResult run(SweepJob const& job) override;
+
+private:
+    void writeSimulationFiles(SweepJob const& job, std::string const& filename) const;
+    OverallStatistics readFinalStatistics(std::string const& statisticsFilename) const;
+
+    IntVector2D getWorldSize(SweepJob const& job) const;  //world size overrides applied to the base world size
+    static uint64_t getMapMemory(IntVector2D const& worldSize);
+
+    std::string getRunFilename(SweepJob const& job, std::string const& ending) const;
+
+    SweepSpecification _specification;
+    std::string _cliFilename;
+    IntVector2D _baseWorldSize;
+    uint64_t _contentMemoryPerRun = 0;  //memory independent of the world size
+};
@@ -0,0 +1,57 @@
+#include "ResultTable.h"
+
+#include <fstream>
+
+namespace
+{
+    std::string escape(std::string const& value)
+    {
+        if (value.find_first_of(",\"") == std::string::npos) {
+            return value;
+        }
+        std::string result = "\"";
+        for (auto const& c : value) {
+            if (c == '"') {
+                result += '"';
+            }
+            result += c;
+        }
+        return result + "\"";
+    }
+}
+
+void ResultTable::write(
+    std::string const& filename,
+    SweepSpecification const& specification,
+    std::vector<SweepJob> const& jobs,
+    std::vector<SweepResult> const& results)
+{
+    std::ofstream stream(filename, std::ios::trunc);
+    if (!stream) {
+        throw std::runtime_error("The file " + filename + " could not be opened.");
+    }
+
+    stream << "run";
+    for (auto const& parameter : specification.parameters) {
+        stream << "," << escape(parameter.key);
+    }
+    stream << ",successful,duration,time step,cells,particles,tokens,internal energy,created cells,"
+              "successful attacks,failed attacks,muscle activities,error"
+           << std::endl;
+
+    for (size_t i = 0; i < jobs.size(); ++i) {
+        auto const& job = jobs.at(i);
+        auto const& result = results.at(i);
+        auto const& statistics = result.finalStatistics;
+
+        stream << job.id;
+        for (auto const& override : job.overrides) {
+            stream << "," << escape(override.second);
+        }
+        stream << "," << (result.successful ? "true" : "false") << "," << result.duration << ","
+               << statistics.timeStep << "," << statistics.numCells << "," << statistics.numParticles << ","
+               << statistics.numTokens << "," << statistics.totalInternalEnergy << "," << statistics.numCreatedCells
+               << "," << statistics.numSuccessfulAttacks << "," << statistics.numFailedAttacks << ","
+               << statistics.numMuscleActivities << "," << escape(result.errorMessage) << std::endl;
+    }
+}
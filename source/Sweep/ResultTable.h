@@ -0,0 +1,13 @@
+#pragma once
+
+#include "SweepSpecification.h"
+
+class ResultTable
+{
+public:
+    static void write(
+        std::string const& filename,
+        SweepSpecification const& specification,
+        std::vector<SweepJob> const& jobs,
+        std::vector<SweepResult> const& results);
+};
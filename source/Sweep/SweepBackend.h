@@ -0,0 +1,15 @@
+#pragma once
+
+#include "Definitions.h"
+
+/**
+ * Executes single runs of a parameter sweep. Implementations must allow run() to be called concurrently.
+ */
+class SweepBackend
+{
+public:
+    virtual ~SweepBackend() = default;
+
+    virtual uint64_t estimateMemory(SweepJob const& job) const = 0;  //in bytes
+    virtual SweepResult run(SweepJob const& job) = 0;
+};
@@ -0,0 +1,55 @@
+#include "SweepPlanner.h"
+
+#include <random>
+
+std::vector<SweepJob> SweepPlanner::createJobs(SweepSpecification const& specification)
+{
+    if (SweepSampling::Grid == specification.sampling) {
+        return createGridJobs(specification.parameters);
+    }
+    return createRandomJobs(specification.parameters, specification.numSamples, specification.seed);
+}
+
+std::vector<SweepJob> SweepPlanner::createGridJobs(std::vector<SweepParameter> const& parameters)
+{
+    std::vector<SweepJob> result(1);
+    for (auto const& parameter : parameters) {
+        std::vector<SweepJob> extendedJobs;
+        extendedJobs.reserve(result.size() * parameter.values.size());
+        for (auto const& job : result) {
+            for (auto const& value : parameter.values) {
+                auto extendedJob = job;
+                extendedJob.overrides.emplace_back(parameter.key, value);
+                extendedJobs.emplace_back(extendedJob);
+            }
+        }
+        result = extendedJobs;
+    }
+    for (int i = 0; i < toInt(result.size()); ++i) {
+        result.at(i).id = i;
+    }
+    return result;
+}
+
+std::vector<SweepJob>
+SweepPlanner::createRandomJobs(std::vector<SweepParameter> const& parameters, int numSamples, uint32_t seed)
+{
+    std::mt19937 generator(seed);
+
+    std::vector<SweepJob> result;
+    for (int i = 0; i < numSamples; ++i) {
+        SweepJob job;
+        job.id = i;
+        for (auto const& parameter : parameters) {
+            if (!parameter.values.empty()) {
+                std::uniform_int_distribution<size_t> distribution(0, parameter.values.size() - 1);
+                job.overrides.emplace_back(parameter.key, parameter.values.at(distribution(generator)));
+            } else {
+                std::uniform_real_distribution<double> distribution(parameter.min, parameter.max);
+                job.overrides.emplace_back(parameter.key, std::to_string(distribution(generator)));
+            }
+        }
+        result.emplace_back(job);
+    }
+    return result;
+}
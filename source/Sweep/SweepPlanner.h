@@ -0,0 +1,14 @@
+#pragma once
+
+#include "SweepSpecification.h"
+
+class SweepPlanner
+{
+public:
+    static std::vector<SweepJob> createJobs(SweepSpecification const& specification);
+
+private:
+    static std::vector<SweepJob> createGridJobs(std::vector<SweepParameter> const& parameters);
+    static std::vector<SweepJob>
+    createRandomJobs(std::vector<SweepParameter> const& parameters, int numSamples, uint32_t seed);
+};
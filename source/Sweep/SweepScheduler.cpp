@@ -0,0 +1,92 @@
+#include "SweepScheduler.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+SweepScheduler::SweepScheduler(
+    boost::shared_ptr<SweepBackend> const& backend,
+    int maxConcurrentRuns,
+    uint64_t memoryBudget)
+    : _backend(backend)
+    , _maxConcurrentRuns(std::max(1, maxConcurrentRuns))
+    , _memoryBudget(memoryBudget)
+{}
+
+std::vector<SweepResult> SweepScheduler::run(std::vector<SweepJob> const& jobs, FinishedCallback const& onFinished)
+{
+    std::vector<uint64_t> memoryEstimates;
+    memoryEstimates.reserve(jobs.size());
+    for (auto const& job : jobs) {
+        memoryEstimates.emplace_back(_backend->estimateMemory(job));
+    }
+
+    std::vector<SweepResult> result(jobs.size());
+    std::mutex mutex;
+    std::condition_variable condition;
+    size_t nextJobIndex = 0;
+    int numRunningJobs = 0;
+    uint64_t usedMemory = 0;
+    _maxConcurrentRunsReached = 0;
+
+    auto isAdmissible = [&] {
+        if (nextJobIndex >= jobs.size()) {
+            return true;
+        }
+        if (0 == numRunningJobs) {
+            return true;  //a job exceeding the budget on its own should still run
+        }
+        return 0 == _memoryBudget || usedMemory + memoryEstimates.at(nextJobIndex) <= _memoryBudget;
+    };
+
+    auto processJobs = [&] {
+        while (true) {
+            size_t jobIndex;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                condition.wait(lock, isAdmissible);
+                if (nextJobIndex >= jobs.size()) {
+                    return;
+                }
+                jobIndex = nextJobIndex++;
+                ++numRunningJobs;
+                usedMemory += memoryEstimates.at(jobIndex);
+                _maxConcurrentRunsReached = std::max(_maxConcurrentRunsReached, numRunningJobs);
+            }
+
+            SweepResult jobResult;
+            try {
+                jobResult = _backend->run(jobs.at(jobIndex));
+            } catch (std::exception const& e) {
+                jobResult.successful = false;
+                jobResult.errorMessage = e.what();
+            }
+            jobResult.jobId = jobs.at(jobIndex).id;
+
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                --numRunningJobs;
+                usedMemory -= memoryEstimates.at(jobIndex);
+                result.at(jobIndex) = jobResult;
+                if (onFinished) {
+                    onFinished(jobResult);
+                }
+            }
+            condition.notify_all();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < std::min(_maxConcurrentRuns, toInt(jobs.size())); ++i) {
+        threads.emplace_back(processJobs);
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return result;
+}
+
+int SweepScheduler::getMaxConcurrentRunsReached() const
+{
+    return _maxConcurrentRunsReached;
+}
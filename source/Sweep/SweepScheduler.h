@@ -0,0 +1,28 @@
+#pragma once
+
+#include <functional>
+
+#include "Definitions.h"
+#include "SweepBackend.h"
+
+/**
+ * Runs the jobs of a sweep concurrently. A job is only admitted if both the number of running jobs and the sum of
+ * their estimated memory stay within the limits. Jobs are admitted in order, so large jobs cannot starve.
+ */
+class SweepScheduler
+{
+public:
+    SweepScheduler(boost::shared_ptr<SweepBackend> const& backend, int maxConcurrentRuns, uint64_t memoryBudget);
+
+    using FinishedCallback = std::function<void(SweepResult const&)>;
+    std::vector<SweepResult> run(std::vector<SweepJob> const& jobs, FinishedCallback const& onFinished = {});
+
+    int getMaxConcurrentRunsReached() const;
+
+private:
+    boost::shared_ptr<SweepBackend> _backend;
+    int _maxConcurrentRuns = 1;
+    uint64_t _memoryBudget = 0;  //in bytes, 0 = unlimited
+
+    int _maxConcurrentRunsReached = 0;
+};
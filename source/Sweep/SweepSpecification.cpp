@@ -0,0 +1,61 @@
+#include "SweepSpecification.h"
+
+#include <boost/property_tree/json_parser.hpp>
+
+SweepSpecification SweepSpecification::load(std::string const& filename)
+{
+    SweepSpecification result;
+    try {
+        boost::property_tree::ptree tree;
+        boost::property_tree::read_json(filename, tree);
+
+        result.baseFilename = tree.get<std::string>("base");
+        result.outputDirectory = tree.get<std::string>("output directory", result.outputDirectory);
+        result.cliFilename = tree.get<std::string>("cli", result.cliFilename);
+        if (auto timesteps = tree.get_optional<uint64_t>("time steps")) {
+            result.timesteps = *timesteps;
+        }
+        if (auto maxDuration = tree.get_optional<double>("duration")) {
+            result.maxDuration = *maxDuration;
+        }
+        result.statisticsInterval = tree.get<uint64_t>("statistics interval", result.statisticsInterval);
+
+        auto sampling = tree.get<std::string>("sampling", "grid");
+        if (sampling == "grid") {
+            result.sampling = SweepSampling::Grid;
+        } else if (sampling == "random") {
+            result.sampling = SweepSampling::Random;
+        } else {
+            throw ParseErrorException("Unknown sampling '" + sampling + "'.");
+        }
+        result.numSamples = tree.get<int>("samples", result.numSamples);
+        result.seed = tree.get<uint32_t>("seed", result.seed);
+
+        result.maxConcurrentRuns = std::max(1, tree.get<int>("max concurrent runs", result.maxConcurrentRuns));
+        result.memoryBudget = tree.get<uint64_t>("memory budget", result.memoryBudget);
+        result.memoryPerRun = tree.get<uint64_t>("memory per run", result.memoryPerRun);
+
+        //parameter keys contain dots and are therefore read as child names instead of paths
+        for (auto const& [key, parameterTree] : tree.get_child("parameters")) {
+            SweepParameter parameter;
+            parameter.key = key;
+            if (auto values = parameterTree.get_child_optional("values")) {
+                for (auto const& value : *values) {
+                    parameter.values.emplace_back(value.second.data());
+                }
+            }
+            parameter.min = parameterTree.get<double>("min", 0);
+            parameter.max = parameterTree.get<double>("max", 0);
+            if (result.sampling == SweepSampling::Grid && parameter.values.empty()) {
+                throw ParseErrorException("No values specified for parameter '" + key + "'.");
+            }
+            result.parameters.emplace_back(parameter);
+        }
+    } catch (boost::property_tree::ptree_error const& e) {
+        throw ParseErrorException("The sweep file " + filename + " could not be read: " + e.what());
+    }
+    if (!result.timesteps && !result.maxDuration) {
+        throw ParseErrorException("Either 'time steps' or 'duration' has to be specified.");
+    }
+    return result;
+}
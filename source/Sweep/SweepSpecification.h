@@ -0,0 +1,39 @@
+#pragma once
+
+#include "Definitions.h"
+
+enum class SweepSampling
+{
+    Grid,
+    Random
+};
+
+struct SweepParameter
+{
+    std::string key;  //e.g. "simulation parameters.radiation.probability"
+    std::vector<std::string> values;  //grid sampling
+    double min = 0;  //random sampling
+    double max = 0;
+};
+
+struct SweepSpecification
+{
+    std::string baseFilename;
+    std::string outputDirectory = "sweep";
+    std::string cliFilename;  //empty = alien-cli next to alien-sweep
+
+    boost::optional<uint64_t> timesteps;
+    boost::optional<double> maxDuration;  //in seconds per run
+    uint64_t statisticsInterval = 1000;
+
+    SweepSampling sampling = SweepSampling::Grid;
+    int numSamples = 10;
+    uint32_t seed = 0;  //for random sampling and passed to each run
+    std::vector<SweepParameter> parameters;
+
+    int maxConcurrentRuns = 2;
+    uint64_t memoryBudget = 0;  //in MB, 0 = unlimited
+    uint64_t memoryPerRun = 0;  //in MB for the base world size, 0 = estimate from base file
+
+    static SweepSpecification load(std::string const& filename);  //throws ParseErrorException
+};
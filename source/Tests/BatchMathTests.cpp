@@ -0,0 +1,156 @@
+#include <cmath>
+#include <random>
+
+#include "Base/CpuFeatures.h"
+#include "Base/Math.h"
+#include "Base/Physics.h"
+#include "EngineInterface/Descriptions.h"
+
+#include "TestFramework.h"
+
+namespace
+{
+    //odd count for covering the scalar tail of the vectorized paths
+    int const NumVectors = 1001;
+
+    std::vector<SimdLevel> getSupportedSimdLevels()
+    {
+        CpuFeatures::setSimdLevelLimit(SimdLevel::Avx2);
+        std::vector<SimdLevel> result{SimdLevel::Scalar};
+        if (CpuFeatures::getSimdLevel() == SimdLevel::Avx2) {
+            result.emplace_back(SimdLevel::Avx2);
+        }
+        return result;
+    }
+
+    std::vector<RealVector2D> createVectors(unsigned int seed, float range)
+    {
+        std::mt19937 generator(seed);
+        std::uniform_real_distribution<float> distribution(-range, range);
+        std::vector<RealVector2D> result;
+        for (int i = 0; i < NumVectors; ++i) {
+            result.emplace_back(distribution(generator), distribution(generator));
+        }
+        return result;
+    }
+
+    double angleDifference(double angle1, double angle2)
+    {
+        auto result = std::fmod(std::abs(angle1 - angle2), 360.0);
+        return std::min(result, 360.0 - result);
+    }
+}
+
+TEST(BatchMath, batchFunctionsMatchScalarFunctions)
+{
+    auto vectors = createVectors(0, 100.0f);
+    auto vels = createVectors(1, 1.0f);
+    for (auto const& simdLevel : getSupportedSimdLevels()) {
+        CpuFeatures::setSimdLevelLimit(simdLevel);
+
+        std::vector<float> lengths(NumVectors);
+        std::vector<float> angles(NumVectors);
+        Math::lengths(vectors.data(), lengths.data(), NumVectors);
+        Math::anglesOfVectors(vectors.data(), angles.data(), NumVectors);
+
+        std::vector<RealVector2D> tangentialVels(NumVectors);
+        std::vector<RealVector2D> rotated(NumVectors);
+        Physics::tangentialVelocities(vectors.data(), vels.data(), tangentialVels.data(), NumVectors, 3.0);
+        Physics::rotateQuarterCounterClockwise(vectors.data(), rotated.data(), NumVectors);
+
+        for (int i = 0; i < NumVectors; ++i) {
+            auto const& v = vectors.at(i);
+            EXPECT_NEAR(Math::length(v), lengths.at(i), 1e-4);
+            EXPECT_TRUE(angleDifference(Math::angleOfVector(v), angles.at(i)) < 1e-3);
+
+            auto tangentialVel = Physics::tangentialVelocity(v, vels.at(i), 3.0);
+            EXPECT_NEAR(tangentialVel.x, tangentialVels.at(i).x, 1e-5);
+            EXPECT_NEAR(tangentialVel.y, tangentialVels.at(i).y, 1e-5);
+
+            auto rotatedVector = Physics::rotateQuarterCounterClockwise(v);
+            EXPECT_EQ(rotatedVector.x, rotated.at(i).x);
+            EXPECT_EQ(rotatedVector.y, rotated.at(i).y);
+        }
+    }
+    CpuFeatures::setSimdLevelLimit(SimdLevel::Avx2);
+}
+
+TEST(BatchMath, rotationAboutCenterKeepsDistancesAndShiftsAngles)
+{
+    RealVector2D const center{10.0f, -20.0f};
+    auto positions = createVectors(2, 100.0f);
+    for (auto const& simdLevel : getSupportedSimdLevels()) {
+        CpuFeatures::setSimdLevelLimit(simdLevel);
+
+        auto rotated = positions;
+        Math::rotate(rotated.data(), NumVectors, center, 30.0);
+        for (int i = 0; i < NumVectors; ++i) {
+            auto origDelta = positions.at(i) - center;
+            auto rotatedDelta = rotated.at(i) - center;
+            EXPECT_NEAR(Math::length(origDelta), Math::length(rotatedDelta), 1e-3);
+            if (Math::length(origDelta) > 1.0) {
+                auto angle = Math::angleOfVector(origDelta) + 30.0;
+                EXPECT_TRUE(angleDifference(angle, Math::angleOfVector(rotatedDelta)) < 1e-2);
+            }
+        }
+    }
+    CpuFeatures::setSimdLevelLimit(SimdLevel::Avx2);
+}
+
+TEST(BatchMath, selectionOfRigidRotationYieldsItsAngularVelocity)
+{
+    RealVector2D const center{50.0f, 60.0f};
+    auto const angularVel = 2.5;  //degrees per time step
+    auto relPositions = createVectors(3, 20.0f);
+    for (auto const& simdLevel : getSupportedSimdLevels()) {
+        CpuFeatures::setSimdLevelLimit(simdLevel);
+
+        //rigid rotation about the center of mass plus a translation
+        std::vector<RealVector2D> positions;
+        std::vector<RealVector2D> vels;
+        RealVector2D sum;
+        for (auto const& relPos : relPositions) {
+            sum += relPos;
+        }
+        auto meanRelPos = sum / toFloat(NumVectors);
+        for (auto const& relPos : relPositions) {
+            auto r = relPos - meanRelPos;
+            positions.emplace_back(center + r);
+            vels.emplace_back(
+                RealVector2D{0.1f, -0.2f} + Physics::rotateQuarterCounterClockwise(r) * toFloat(angularVel * degToRad));
+        }
+
+        auto centerOfMass = Physics::calcCenterOfMass(positions.data(), NumVectors);
+        EXPECT_NEAR(center.x, centerOfMass.x, 1e-3);
+        EXPECT_NEAR(center.y, centerOfMass.y, 1e-3);
+
+        auto calculatedAngularVel =
+            Physics::calcAngularVelocity(positions.data(), vels.data(), NumVectors, centerOfMass);
+        EXPECT_NEAR(angularVel, calculatedAngularVel, 1e-3);
+
+        //removing the rotational part leaves the translation
+        std::vector<RealVector2D> relPositionsFromCenter;
+        for (auto const& pos : positions) {
+            relPositionsFromCenter.emplace_back(pos - centerOfMass);
+        }
+        std::vector<RealVector2D> tangentialVels(NumVectors);
+        Physics::tangentialVelocities(
+            relPositionsFromCenter.data(), vels.data(), tangentialVels.data(), NumVectors, calculatedAngularVel);
+        for (auto const& vel : tangentialVels) {
+            EXPECT_NEAR(0.1f, vel.x, 1e-3);
+            EXPECT_NEAR(-0.2f, vel.y, 1e-3);
+        }
+    }
+    CpuFeatures::setSimdLevelLimit(SimdLevel::Avx2);
+}
+
+TEST(BatchMath, centerOfDescription)
+{
+    DataDescription data;
+    data.emplaceCluster().emplaceCell().setPos({1.0f, 2.0f});
+    data.clusters.front().emplaceCell().setPos({3.0f, 4.0f});
+    data.emplaceParticle().setPos({5.0f, 9.0f});
+    auto center = data.calcCenter();
+    EXPECT_NEAR(3.0f, center.x, 1e-6);
+    EXPECT_NEAR(5.0f, center.y, 1e-6);
+}
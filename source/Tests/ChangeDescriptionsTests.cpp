@@ -0,0 +1,198 @@
+#include <algorithm>
+#include <stdexcept>
+
+#include "EngineInterface/ChangeDescriptions.h"
+
+#include "TestFramework.h"
+
+namespace
+{
+    //cells of a cluster form a chain, ids are assigned consecutively starting with 1
+    DataDescription createData(int numClusters, int cellsPerCluster, int numParticles)
+    {
+        DataDescription result;
+        uint64_t id = 1;
+        for (int i = 0; i < numClusters; ++i) {
+            auto& cluster = result.emplaceCluster();
+            cluster.setId(id++);
+            for (int j = 0; j < cellsPerCluster; ++j) {
+                auto& cell = cluster.emplaceCell();
+                cell.setId(id++).setPos({toFloat(i * 10), toFloat(j)}).setEnergy(100.0);
+                if (j > 0) {
+                    cell.connections.emplace_back(ConnectionDescription{id - 2, 1.0f, 0.0f});
+                }
+            }
+        }
+        for (int i = 0; i < numParticles; ++i) {
+            result.emplaceParticle().setId(id++).setPos({toFloat(i), 0.0f}).setEnergy(10.0);
+        }
+        return result;
+    }
+
+    int countCells(DataChangeDescription const& changes, StateTracker<CellChangeDescription>::State state)
+    {
+        return toInt(std::count_if(changes.cells.begin(), changes.cells.end(), [&](auto const& cell) {
+            return (state == StateTracker<CellChangeDescription>::State::Added && cell.isAdded())
+                || (state == StateTracker<CellChangeDescription>::State::Modified && cell.isModified())
+                || (state == StateTracker<CellChangeDescription>::State::Deleted && cell.isDeleted());
+        }));
+    }
+}
+
+TEST(DataChangeDescription, unchangedDataHasNoChanges)
+{
+    auto data = createData(10, 5, 10);
+    DataChangeDescription changes(data, data);
+    EXPECT_TRUE(changes.empty());
+}
+
+TEST(DataChangeDescription, changedCellIsModified)
+{
+    auto dataBefore = createData(10, 5, 0);
+    auto dataAfter = dataBefore;
+    auto& changedCell = dataAfter.clusters.at(3).cells.at(2);
+    changedCell.setEnergy(50.0);
+
+    DataChangeDescription changes(dataBefore, dataAfter);
+    EXPECT_EQ(size_t(1), changes.cells.size());
+    auto const& change = changes.cells.front();
+    EXPECT_TRUE(change.isModified());
+    EXPECT_EQ(changedCell.id, change->id);
+    EXPECT_EQ(static_cast<uint16_t>(CellChangeDescription::Field::ENERGY), change->changedFields);
+    EXPECT_NEAR(50.0, change->energy, 1e-9);
+}
+
+TEST(DataChangeDescription, cellMovedBetweenClustersIsMatchedById)
+{
+    auto dataBefore = createData(10, 5, 0);
+    auto dataAfter = dataBefore;
+    auto movedCell = dataAfter.clusters.at(1).cells.back();
+    dataAfter.clusters.at(1).cells.pop_back();
+    dataAfter.clusters.at(2).cells.emplace_back(movedCell);
+
+    DataChangeDescription unchangedCellChanges(dataBefore, dataAfter);
+    EXPECT_TRUE(unchangedCellChanges.empty());
+
+    dataAfter.clusters.at(2).cells.back().setPos({1.0f, 2.0f});
+    DataChangeDescription changes(dataBefore, dataAfter);
+    EXPECT_EQ(size_t(1), changes.cells.size());
+    EXPECT_TRUE(changes.cells.front().isModified());
+    EXPECT_EQ(movedCell.id, changes.cells.front()->id);
+    EXPECT_EQ(static_cast<uint16_t>(CellChangeDescription::Field::POS), changes.cells.front()->changedFields);
+}
+
+TEST(DataChangeDescription, addedAndDeletedCellsAndParticles)
+{
+    auto dataBefore = createData(10, 5, 10);
+    auto dataAfter = dataBefore;
+    auto deletedCellId = dataAfter.clusters.at(4).cells.back().id;
+    dataAfter.clusters.at(4).cells.pop_back();
+    dataAfter.clusters.at(5).emplaceCell().setId(1000).setPos({3.0f, 4.0f});
+    auto deletedParticleId = dataAfter.particles.back().id;
+    dataAfter.particles.pop_back();
+    dataAfter.particles.front().setEnergy(5.0);
+    dataAfter.emplaceParticle().setId(1001);
+
+    DataChangeDescription changes(dataBefore, dataAfter);
+    EXPECT_EQ(2, toInt(changes.cells.size()));
+    for (auto const& cell : changes.cells) {
+        EXPECT_TRUE(cell.isDeleted() || cell.isAdded());
+        EXPECT_EQ(cell.isDeleted() ? deletedCellId : uint64_t(1000), cell->id);
+    }
+    EXPECT_EQ(3, toInt(changes.particles.size()));
+    for (auto const& particle : changes.particles) {
+        if (particle.isDeleted()) {
+            EXPECT_EQ(deletedParticleId, particle->id);
+        } else if (particle.isAdded()) {
+            EXPECT_EQ(uint64_t(1001), particle->id);
+        } else {
+            EXPECT_EQ(dataAfter.particles.front().id, particle->id);
+            EXPECT_NEAR(5.0, particle->energy, 1e-9);
+        }
+    }
+}
+
+TEST(DataChangeDescription, manyChangedCells)
+{
+    //more cells than compared per chunk
+    auto dataBefore = createData(2000, 10, 0);
+    auto dataAfter = dataBefore;
+    for (auto& cluster : dataAfter.clusters) {
+        for (int i = 0; i < cluster.cells.size(); i += 2) {
+            cluster.cells.at(i).setEnergy(50.0);
+        }
+        cluster.cells.pop_back();
+    }
+
+    DataChangeDescription changes(dataBefore, dataAfter);
+    EXPECT_EQ(10000, countCells(changes, StateTracker<CellChangeDescription>::State::Modified));
+    EXPECT_EQ(2000, countCells(changes, StateTracker<CellChangeDescription>::State::Deleted));
+    EXPECT_EQ(0, countCells(changes, StateTracker<CellChangeDescription>::State::Added));
+
+    //chunks are concatenated in the order of the cells
+    auto isOrdered = std::is_sorted(
+        changes.cells.begin(), changes.cells.end(), [](auto const& cell1, auto const& cell2) {
+            return cell1->id < cell2->id;
+        });
+    EXPECT_TRUE(isOrdered);
+}
+
+TEST(CellChangeDescription, diffFlagsChangedFields)
+{
+    auto before = CellDescription().setId(1).setPos({1.0f, 2.0f}).setEnergy(100.0).setMaxConnections(2);
+    auto after = before;
+    after.setEnergy(50.0).setMaxConnections(3);
+
+    CellChangeDescription change(before, after);
+    EXPECT_EQ(
+        static_cast<uint16_t>(CellChangeDescription::Field::ENERGY | CellChangeDescription::Field::MAX_CONNECTIONS),
+        change.changedFields);
+    EXPECT_TRUE(!change.isChanged(CellChangeDescription::Field::POS));
+    EXPECT_NEAR(50.0, change.energy, 1e-9);
+    EXPECT_EQ(3, change.maxConnections);
+    EXPECT_TRUE(!change.oldValues);
+
+    EXPECT_TRUE(CellChangeDescription(before, before).isEmpty());
+    EXPECT_EQ(static_cast<uint16_t>(CellChangeDescription::Field::ALL), CellChangeDescription(after).changedFields);
+}
+
+TEST(CellChangeDescription, keepsOldValuesOnRequest)
+{
+    auto before = CellDescription().setId(1).setEnergy(100.0);
+    auto after = CellDescription(before).setEnergy(50.0);
+
+    CellChangeDescription change(before, after, true);
+    EXPECT_TRUE(change.oldValues != nullptr);
+    EXPECT_NEAR(100.0, change.oldValues->energy, 1e-9);
+
+    //unchanged cells need no old values
+    EXPECT_TRUE(!CellChangeDescription(before, before, true).oldValues);
+
+    ParticleChangeDescription particleChange(
+        ParticleDescription().setId(2).setEnergy(1.0), ParticleDescription().setId(2).setEnergy(2.0), true);
+    EXPECT_TRUE(particleChange.oldValues != nullptr);
+    EXPECT_NEAR(1.0, particleChange.oldValues->energy, 1e-9);
+}
+
+TEST(CellChangeDescription, conversionRequiresAllFields)
+{
+    auto cell = CellDescription().setId(1).setPos({1.0f, 2.0f}).setEnergy(100.0);
+    CellDescription convertedCell(CellChangeDescription{cell});
+    EXPECT_EQ(cell.id, convertedCell.id);
+    EXPECT_NEAR(100.0, convertedCell.energy, 1e-9);
+
+    auto partialChange = CellChangeDescription().setId(1).setEnergy(50.0);
+    EXPECT_THROW(CellDescription{partialChange}, std::invalid_argument);
+    auto partialParticleChange = ParticleChangeDescription().setId(2).setEnergy(50.0);
+    EXPECT_THROW(ParticleDescription{partialParticleChange}, std::invalid_argument);
+}
+
+TEST(CellChangeDescription, applyChangeMergesChangedFields)
+{
+    auto cell = CellDescription().setId(1).setPos({1.0f, 2.0f}).setEnergy(100.0).setMaxConnections(2);
+    cell.applyChange(CellChangeDescription().setId(1).setEnergy(50.0));
+
+    EXPECT_NEAR(50.0, cell.energy, 1e-9);
+    EXPECT_NEAR(1.0f, cell.pos.x, 1e-6);
+    EXPECT_EQ(2, cell.maxConnections);
+}
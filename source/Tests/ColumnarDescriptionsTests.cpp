@@ -0,0 +1,156 @@
+#include "EngineInterface/ChangeDescriptions.h"
+#include "EngineInterface/ColumnarDescriptions.h"
+
+#include "TestFramework.h"
+
+namespace
+{
+    //covers all fields, including empty strings, cells without tokens and strings with zero bytes
+    DataDescription createData()
+    {
+        DataDescription result;
+        uint64_t id = 1;
+        for (int i = 0; i < 3; ++i) {
+            auto& cluster = result.emplaceCluster();
+            cluster.setId(id++);
+            for (int j = 0; j < 4; ++j) {
+                auto cellFunction = j % 2 == 0 ? Enums::CellFunction::COMPUTER : Enums::CellFunction::SENSOR;
+                auto& cell = cluster.emplaceCell();
+                cell.setId(id++)
+                    .setPos({toFloat(i), toFloat(j)})
+                    .setVel({0.1f * toFloat(j), -0.2f})
+                    .setEnergy(100.0 + j)
+                    .setMaxConnections(3)
+                    .setFlagTokenBlocked(j % 2 == 0)
+                    .setTokenBranchNumber(j)
+                    .setTokenUsages(i + j)
+                    .setMetadata(CellMetadata()
+                                     .setName(j == 0 ? "" : "cell " + std::to_string(j))
+                                     .setDescription("description")
+                                     .setSourceCode("mov [1], [2]")
+                                     .setColor(static_cast<uint8_t>(j)))
+                    .setCellFeature(CellFeatureDescription()
+                                        .setType(cellFunction)
+                                        .setConstData(std::string("const\0data", 10))
+                                        .setVolatileData("volatile"));
+                for (int k = 0; k < j; ++k) {
+                    cell.addToken(TokenDescription().setEnergy(10.0 + k).setData("token " + std::to_string(k)));
+                }
+                if (j > 0) {
+                    cell.connections.emplace_back(ConnectionDescription{id - 2, 1.0f, 0.0f});
+                    cluster.cells.at(j - 1).connections.emplace_back(ConnectionDescription{id - 1, 1.0f, 180.0f});
+                }
+            }
+        }
+        for (int i = 0; i < 5; ++i) {
+            result.emplaceParticle()
+                .setId(id++)
+                .setPos({toFloat(i), 10.0f})
+                .setVel({0.0f, 0.5f})
+                .setEnergy(5.0 + i)
+                .setMetadata(ParticleMetadata().setColor(static_cast<uint8_t>(i)));
+        }
+        return result;
+    }
+
+    bool isEqual(DataDescription const& data1, DataDescription const& data2)
+    {
+        if (data1.clusters.size() != data2.clusters.size() || data1.particles.size() != data2.particles.size()) {
+            return false;
+        }
+        for (int i = 0; i < data1.clusters.size(); ++i) {
+            auto const& cluster1 = data1.clusters.at(i);
+            auto const& cluster2 = data2.clusters.at(i);
+            if (cluster1.id != cluster2.id || cluster1.cells.size() != cluster2.cells.size()) {
+                return false;
+            }
+            for (int j = 0; j < cluster1.cells.size(); ++j) {
+                auto const& cell1 = cluster1.cells.at(j);
+                auto const& cell2 = cluster2.cells.at(j);
+                if (cell1.id != cell2.id || !CellChangeDescription(cell1, cell2).isEmpty()) {
+                    return false;
+                }
+            }
+        }
+        for (int i = 0; i < data1.particles.size(); ++i) {
+            auto const& particle1 = data1.particles.at(i);
+            auto const& particle2 = data2.particles.at(i);
+            if (particle1.id != particle2.id || !ParticleChangeDescription(particle1, particle2).isEmpty()) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool isEqual(StringColumn const& column1, StringColumn const& column2)
+    {
+        return column1.bytes == column2.bytes && column1.offsets == column2.offsets;
+    }
+
+    bool isEqual(ColumnarDataDescription const& data1, ColumnarDataDescription const& data2)
+    {
+        return data1.clusterIds == data2.clusterIds && data1.clusterCellOffsets == data2.clusterCellOffsets
+            && data1.cellIds == data2.cellIds && data1.cellPositions == data2.cellPositions
+            && data1.cellVelocities == data2.cellVelocities && data1.cellEnergies == data2.cellEnergies
+            && data1.cellMaxConnections == data2.cellMaxConnections && data1.cellTokenBlocked == data2.cellTokenBlocked
+            && data1.cellTokenBranchNumbers == data2.cellTokenBranchNumbers
+            && data1.cellTokenUsages == data2.cellTokenUsages && data1.cellFunctionTypes == data2.cellFunctionTypes
+            && isEqual(data1.cellConstData, data2.cellConstData)
+            && isEqual(data1.cellVolatileData, data2.cellVolatileData) && data1.cellColors == data2.cellColors
+            && isEqual(data1.cellNames, data2.cellNames) && isEqual(data1.cellDescriptions, data2.cellDescriptions)
+            && isEqual(data1.cellSourceCodes, data2.cellSourceCodes)
+            && data1.cellConnectionOffsets == data2.cellConnectionOffsets
+            && data1.connectionCellIds == data2.connectionCellIds
+            && data1.connectionDistances == data2.connectionDistances
+            && data1.connectionAnglesFromPrevious == data2.connectionAnglesFromPrevious
+            && data1.cellTokenOffsets == data2.cellTokenOffsets && data1.tokenEnergies == data2.tokenEnergies
+            && isEqual(data1.tokenData, data2.tokenData) && data1.particleIds == data2.particleIds
+            && data1.particlePositions == data2.particlePositions
+            && data1.particleVelocities == data2.particleVelocities
+            && data1.particleEnergies == data2.particleEnergies && data1.particleColors == data2.particleColors;
+    }
+}
+
+TEST(ColumnarDataDescription, roundTripFromDataDescription)
+{
+    auto data = createData();
+    ColumnarDataDescription columnarData(data);
+
+    EXPECT_EQ(3, columnarData.getNumClusters());
+    EXPECT_EQ(12, columnarData.getNumCells());
+    EXPECT_EQ(18, columnarData.getNumConnections());
+    EXPECT_EQ(18, columnarData.getNumTokens());
+    EXPECT_EQ(5, columnarData.getNumParticles());
+    EXPECT_TRUE(isEqual(data, columnarData.toDataDescription()));
+}
+
+TEST(ColumnarDataDescription, roundTripFromColumnarDataDescription)
+{
+    ColumnarDataDescription columnarData(createData());
+    ColumnarDataDescription roundTripData(columnarData.toDataDescription());
+    EXPECT_TRUE(isEqual(columnarData, roundTripData));
+}
+
+TEST(ColumnarDataDescription, singleElementAccess)
+{
+    auto data = createData();
+    ColumnarDataDescription columnarData(data);
+
+    auto const& cell = data.clusters.at(1).cells.at(3);
+    auto columnarCell = columnarData.getCell(7);
+    EXPECT_EQ(cell.id, columnarCell.id);
+    EXPECT_TRUE(CellChangeDescription(cell, columnarCell).isEmpty());
+    EXPECT_EQ(std::string("const\0data", 10), std::string(columnarCell.cellFeature.constData));
+
+    auto const& particle = data.particles.at(4);
+    EXPECT_TRUE(ParticleChangeDescription(particle, columnarData.getParticle(4)).isEmpty());
+}
+
+TEST(ColumnarDataDescription, emptyRoundTrip)
+{
+    ColumnarDataDescription columnarData{DataDescription()};
+    EXPECT_TRUE(columnarData.isEmpty());
+    auto data = columnarData.toDataDescription();
+    EXPECT_TRUE(data.clusters.empty());
+    EXPECT_TRUE(data.particles.empty());
+}
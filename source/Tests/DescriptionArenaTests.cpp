@@ -0,0 +1,150 @@
+#include <algorithm>
+#include <thread>
+
+#include "EngineInterface/ChangeDescriptions.h"
+#include "EngineInterface/DescriptionArena.h"
+#include "EngineInterface/DescriptionHelper.h"
+
+#include "TestFramework.h"
+
+namespace
+{
+    //strings exceed the small string optimization
+    std::string const LongString = "string which does not fit into the small string buffer";
+
+    void buildData(DataDescription& data, uint64_t firstId = 1)
+    {
+        auto id = firstId;
+        for (int i = 0; i < 3; ++i) {
+            auto& cluster = data.emplaceCluster();
+            cluster.setId(id++);
+            for (int j = 0; j < 4; ++j) {
+                auto& cell = cluster.emplaceCell();
+                cell.setId(id++).setPos({toFloat(i), toFloat(j)});
+                cell.metadata.setName(LongString).setDescription(LongString);
+                cell.tokens.emplace_back().setData(LongString);
+            }
+            cluster.cells.at(0).connections.emplace_back(ConnectionDescription{id - 1, 1.0f, 0.0f});
+        }
+        data.emplaceParticle().setId(id++);
+    }
+
+    void expectAllocatedFrom(DataDescription const& data, DescriptionAllocator const& allocator)
+    {
+        EXPECT_TRUE(data.get_allocator() == allocator);
+        for (auto const& cluster : data.clusters) {
+            EXPECT_TRUE(cluster.cells.get_allocator() == allocator);
+            for (auto const& cell : cluster.cells) {
+                EXPECT_TRUE(cell.connections.get_allocator() == allocator);
+                EXPECT_TRUE(cell.tokens.get_allocator() == allocator);
+                EXPECT_TRUE(cell.metadata.name.get_allocator() == allocator);
+                EXPECT_TRUE(cell.metadata.description.get_allocator() == allocator);
+                EXPECT_TRUE(cell.cellFeature.constData.get_allocator() == allocator);
+                for (auto const& token : cell.tokens) {
+                    EXPECT_TRUE(token.data.get_allocator() == allocator);
+                }
+            }
+        }
+    }
+}
+
+TEST(DescriptionArena, builtDescriptionIsAllocatedFromArena)
+{
+    DescriptionArena arena(1024);
+    buildData(arena.getData());
+
+    EXPECT_EQ(size_t(3), arena.getData().clusters.size());
+    EXPECT_EQ(LongString, std::string(arena.getData().clusters.at(1).cells.at(2).metadata.name));
+    expectAllocatedFrom(arena.getData(), arena.getAllocator());
+}
+
+TEST(DescriptionArena, insertedDescriptionsAdoptArenaAllocator)
+{
+    DataDescription heapData;
+    buildData(heapData);
+    EXPECT_TRUE(heapData.get_allocator() != DescriptionArena().getAllocator());
+
+    DescriptionArena arena;
+    auto& data = arena.getData();
+    data.addClusters(heapData.clusters);
+    data.addCluster(heapData.clusters.front());
+    data.clusters.back().addCell(heapData.clusters.front().cells.front());
+
+    EXPECT_EQ(size_t(4), data.clusters.size());
+    EXPECT_EQ(size_t(5), data.clusters.back().cells.size());
+    expectAllocatedFrom(data, arena.getAllocator());
+}
+
+TEST(DescriptionArena, clearKeepsArenaAllocator)
+{
+    DescriptionArena arena;
+    buildData(arena.getData());
+    arena.getData().clear();
+    buildData(arena.getData());
+
+    EXPECT_EQ(size_t(3), arena.getData().clusters.size());
+    expectAllocatedFrom(arena.getData(), arena.getAllocator());
+}
+
+TEST(DescriptionArena, conversionFromChangeDescriptionKeepsArenaAllocator)
+{
+    DataDescription heapData;
+    buildData(heapData);
+    DataChangeDescription change(heapData);
+
+    DescriptionArena arena;
+    auto& cluster = arena.getData().emplaceCluster();
+    for (auto const& cellChange : change.cells) {
+        cluster.emplaceCell(cellChange.getValue());
+    }
+    EXPECT_EQ(change.cells.size(), cluster.cells.size());
+    EXPECT_EQ(LongString, std::string(cluster.cells.front().tokens.front().data));
+    expectAllocatedFrom(arena.getData(), arena.getAllocator());
+}
+
+TEST(DescriptionArena, concurrentAllocations)
+{
+    DescriptionArena arena(1024);
+    int const NumThreads = 4;
+    int const NumVectors = 2000;
+
+    std::vector<std::vector<DescriptionVector<int>>> vectorsByThread(NumThreads);
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < NumThreads; ++thread) {
+        threads.emplace_back([&, thread] {
+            auto& vectors = vectorsByThread.at(thread);
+            for (int i = 0; i < NumVectors; ++i) {
+                vectors.emplace_back(DescriptionVector<int>(16, thread, arena.getAllocator()));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    auto isIntact = true;
+    for (int thread = 0; thread < NumThreads; ++thread) {
+        for (auto const& vector : vectorsByThread.at(thread)) {
+            isIntact &= std::all_of(vector.begin(), vector.end(), [&](int value) { return value == thread; });
+        }
+    }
+    EXPECT_TRUE(isIntact);
+}
+
+TEST(DescriptionArena, parallelHelpersKeepArenaAllocator)
+{
+    DescriptionArena arena;
+    auto& data = arena.getData();
+    for (int i = 0; i < 200; ++i) {
+        buildData(data, 1 + i * 100);
+    }
+
+    DescriptionNavigator navigator;
+    navigator.update(data);
+    DescriptionHelper::correctConnections(data, navigator, {100, 100});
+    DescriptionHelper::duplicate(data, navigator, {100, 100}, {200, 100});
+
+    EXPECT_EQ(size_t(1200), data.clusters.size());
+    EXPECT_EQ(size_t(400), data.particles.size());
+    expectAllocatedFrom(data, arena.getAllocator());
+}
@@ -0,0 +1,191 @@
+#include <cmath>
+#include <set>
+
+#include "EngineInterface/DescriptionHelper.h"
+#include "EngineInterface/Descriptions.h"
+
+#include "TestFramework.h"
+
+namespace
+{
+    //clusters are vertical chains of cells within a world of size 100 x 100
+    DataDescription createData(int numClusters, int cellsPerCluster, int numParticles)
+    {
+        DataDescription result;
+        uint64_t id = 1;
+        for (int i = 0; i < numClusters; ++i) {
+            auto& cluster = result.emplaceCluster();
+            cluster.setId(id++);
+            for (int j = 0; j < cellsPerCluster; ++j) {
+                auto& cell = cluster.emplaceCell();
+                cell.setId(id++).setPos({toFloat(i % 10 * 10), toFloat(i / 10 % 10 * 10 + j)});
+                if (j > 0) {
+                    cell.connections.emplace_back(ConnectionDescription{id - 2, 1.0f, 0.0f});
+                    cluster.cells.at(j - 1).connections.emplace_back(ConnectionDescription{id - 1, 1.0f, 0.0f});
+                }
+            }
+        }
+        for (int i = 0; i < numParticles; ++i) {
+            result.emplaceParticle().setId(id++).setPos({toFloat(i % 100), toFloat(i / 100 % 100)});
+        }
+        return result;
+    }
+
+    void duplicate(DataDescription& data, IntVector2D const& origWorldSize, IntVector2D const& worldSize)
+    {
+        DescriptionNavigator navigator;
+        navigator.update(data);
+        DescriptionHelper::duplicate(data, navigator, origWorldSize, worldSize);
+    }
+
+    std::set<std::pair<float, float>> getCellPositions(DataDescription const& data)
+    {
+        std::set<std::pair<float, float>> result;
+        for (auto const& cluster : data.clusters) {
+            for (auto const& cell : cluster.cells) {
+                result.emplace(cell.pos.x, cell.pos.y);
+            }
+        }
+        return result;
+    }
+
+    ClusterDescription createClusterWithBonds(std::vector<RealVector2D> const& positions)
+    {
+        //the first cell is bonded to all other cells with an angle of 90 degrees between consecutive bonds
+        ClusterDescription result;
+        result.setId(1);
+        for (int i = 0; i < positions.size(); ++i) {
+            result.emplaceCell().setId(2 + i).setPos(positions.at(i));
+        }
+        auto& firstCell = result.cells.front();
+        for (int i = 1; i < positions.size(); ++i) {
+            firstCell.connections.emplace_back(ConnectionDescription{uint64_t(2 + i), 1.0f, 90.0f});
+            result.cells.at(i).connections.emplace_back(ConnectionDescription{2, 1.0f, 0.0f});
+        }
+        return result;
+    }
+
+    void correctConnections(DataDescription& data, IntVector2D const& worldSize)
+    {
+        DescriptionNavigator navigator;
+        navigator.update(data);
+        DescriptionHelper::correctConnections(data, navigator, worldSize);
+    }
+}
+
+TEST(DescriptionHelper, duplicateFillsTiles)
+{
+    auto origData = createData(100, 3, 50);
+    auto data = origData;
+    duplicate(data, {100, 100}, {200, 200});
+
+    EXPECT_EQ(size_t(400), data.clusters.size());
+    EXPECT_EQ(size_t(200), data.particles.size());
+
+    auto positions = getCellPositions(data);
+    EXPECT_EQ(size_t(1200), positions.size());
+    std::vector<RealVector2D> tileOffsets = {{0, 0}, {100, 0}, {0, 100}, {100, 100}};
+    auto isTiled = true;
+    for (auto const& cluster : origData.clusters) {
+        for (auto const& cell : cluster.cells) {
+            for (auto const& offset : tileOffsets) {
+                isTiled &= positions.count({cell.pos.x + offset.x, cell.pos.y + offset.y}) == 1;
+            }
+        }
+    }
+    EXPECT_TRUE(isTiled);
+}
+
+TEST(DescriptionHelper, duplicateAssignsUniqueIdsAndKeepsConnectionsWithinTiles)
+{
+    auto data = createData(100, 3, 50);
+    duplicate(data, {100, 100}, {200, 200});
+
+    std::set<uint64_t> ids;
+    size_t numIds = 0;
+    int numConnections = 0;
+    auto areConnectionsWithinTiles = true;
+    DescriptionNavigator navigator;
+    navigator.update(data);
+    for (auto const& cluster : data.clusters) {
+        ids.insert(cluster.id);
+        ++numIds;
+        for (auto const& cell : cluster.cells) {
+            ids.insert(cell.id);
+            ++numIds;
+            numConnections += toInt(cell.connections.size());
+            for (auto const& connection : cell.connections) {
+                auto const& connectingCell = cluster.cells.at(navigator.cellIndicesByCellIds.at(connection.cellId));
+                areConnectionsWithinTiles &= navigator.clusterIdsByCellIds.at(connection.cellId) == cluster.id;
+                areConnectionsWithinTiles &= std::abs(connectingCell.pos.x - cell.pos.x) < 1.5f;
+                areConnectionsWithinTiles &= std::abs(connectingCell.pos.y - cell.pos.y) < 1.5f;
+            }
+        }
+    }
+    for (auto const& particle : data.particles) {
+        ids.insert(particle.id);
+        ++numIds;
+    }
+    EXPECT_EQ(numIds, ids.size());
+    EXPECT_TRUE(ids.count(0) == 0);
+    EXPECT_EQ(400 * 4, numConnections);  //chains of 3 cells have 4 connection entries
+    EXPECT_TRUE(areConnectionsWithinTiles);
+}
+
+TEST(DescriptionHelper, duplicateOmitsContentOutsidePartialTiles)
+{
+    auto data = createData(100, 1, 0);
+    duplicate(data, {100, 100}, {150, 100});
+
+    //the second tile only contains the clusters with x < 50
+    EXPECT_EQ(size_t(150), data.clusters.size());
+    auto positions = getCellPositions(data);
+    EXPECT_TRUE(positions.count({140.0f, 0.0f}) == 1);
+    EXPECT_TRUE(positions.count({150.0f, 0.0f}) == 0);
+}
+
+TEST(DescriptionHelper, correctConnectionsKeepsWrapAroundBonds)
+{
+    //the bond crosses the border of the shrunk world
+    DataDescription data;
+    data.addCluster(createClusterWithBonds({{1.0f, 10.0f}, {49.0f, 10.0f}}));
+    correctConnections(data, {50, 50});
+
+    EXPECT_EQ(size_t(1), data.clusters.front().cells.at(0).connections.size());
+    EXPECT_EQ(size_t(1), data.clusters.front().cells.at(1).connections.size());
+}
+
+TEST(DescriptionHelper, correctConnectionsRemovesOverlongBonds)
+{
+    //bonds longer than a third of the world size are removed on both sides
+    DataDescription data;
+    data.addCluster(createClusterWithBonds({{10.0f, 10.0f}, {11.0f, 10.0f}, {30.0f, 10.0f}}));
+    correctConnections(data, {50, 50});
+
+    auto const& cells = data.clusters.front().cells;
+    EXPECT_EQ(size_t(1), cells.at(0).connections.size());
+    EXPECT_EQ(uint64_t(3), cells.at(0).connections.front().cellId);
+    EXPECT_EQ(size_t(1), cells.at(1).connections.size());
+    EXPECT_EQ(size_t(0), cells.at(2).connections.size());
+
+    //in a larger world the same bond is kept
+    DataDescription largeWorldData;
+    largeWorldData.addCluster(createClusterWithBonds({{10.0f, 10.0f}, {11.0f, 10.0f}, {30.0f, 10.0f}}));
+    correctConnections(largeWorldData, {100, 100});
+    EXPECT_EQ(size_t(2), largeWorldData.clusters.front().cells.at(0).connections.size());
+}
+
+TEST(DescriptionHelper, correctConnectionsCarriesOverAngles)
+{
+    //the angle of a removed bond is added to the following bond
+    DataDescription data;
+    data.addCluster(createClusterWithBonds({{10.0f, 10.0f}, {11.0f, 10.0f}, {30.0f, 10.0f}, {10.0f, 11.0f}}));
+    correctConnections(data, {50, 50});
+
+    auto const& connections = data.clusters.front().cells.front().connections;
+    EXPECT_EQ(size_t(2), connections.size());
+    EXPECT_EQ(uint64_t(3), connections.at(0).cellId);
+    EXPECT_NEAR(90.0f, connections.at(0).angleFromPrevious, 1e-6);
+    EXPECT_EQ(uint64_t(5), connections.at(1).cellId);
+    EXPECT_NEAR(180.0f, connections.at(1).angleFromPrevious, 1e-6);
+}
@@ -0,0 +1,135 @@
+#include "EngineInterface/ChangeDescriptions.h"
+#include "EngineInterface/Descriptions.h"
+
+#include "TestFramework.h"
+
+namespace
+{
+    DataDescription createData(int numClusters, int cellsPerCluster, int numParticles)
+    {
+        DataDescription result;
+        uint64_t id = 1;
+        for (int i = 0; i < numClusters; ++i) {
+            auto& cluster = result.emplaceCluster();
+            cluster.setId(id++);
+            for (int j = 0; j < cellsPerCluster; ++j) {
+                cluster.emplaceCell().setId(id++).setPos({toFloat(i), toFloat(j)});
+            }
+        }
+        for (int i = 0; i < numParticles; ++i) {
+            result.emplaceParticle().setId(id++);
+        }
+        return result;
+    }
+
+    void expectEqualMaps(FlatHashMap<int> const& expected, FlatHashMap<int> const& actual)
+    {
+        EXPECT_EQ(expected.size(), actual.size());
+        expected.forEach([&](uint64_t key, int value) {
+            auto actualValue = actual.find(key);
+            EXPECT_TRUE(actualValue != nullptr);
+            EXPECT_EQ(value, *actualValue);
+        });
+    }
+
+    //the incrementally updated navigator has to match a rebuilt one
+    void expectRebuiltEquivalent(DataDescription const& data, DescriptionNavigator const& navigator)
+    {
+        DescriptionNavigator rebuilt;
+        rebuilt.update(data);
+        expectEqualMaps(rebuilt.clusterIndicesByClusterIds, navigator.clusterIndicesByClusterIds);
+        expectEqualMaps(rebuilt.clusterIndicesByCellIds, navigator.clusterIndicesByCellIds);
+        expectEqualMaps(rebuilt.cellIndicesByCellIds, navigator.cellIndicesByCellIds);
+        expectEqualMaps(rebuilt.particleIndicesByParticleIds, navigator.particleIndicesByParticleIds);
+        EXPECT_EQ(rebuilt.clusterIdsByCellIds.size(), navigator.clusterIdsByCellIds.size());
+        rebuilt.clusterIdsByCellIds.forEach([&](uint64_t key, uint64_t value) {
+            EXPECT_TRUE(navigator.clusterIdsByCellIds.contains(key));
+            EXPECT_EQ(value, navigator.clusterIdsByCellIds.at(key));
+        });
+    }
+}
+
+TEST(DescriptionNavigator, findsCellsAndParticles)
+{
+    auto data = createData(3, 4, 5);
+    DescriptionNavigator navigator;
+    navigator.update(data);
+
+    auto const& cell = data.clusters.at(2).cells.at(3);
+    EXPECT_TRUE(navigator.containsCell(cell.id));
+    EXPECT_EQ(2, navigator.clusterIndicesByCellIds.at(cell.id));
+    EXPECT_EQ(3, navigator.cellIndicesByCellIds.at(cell.id));
+    EXPECT_EQ(data.clusters.at(2).id, navigator.clusterIdsByCellIds.at(cell.id));
+    EXPECT_EQ(4, navigator.particleIndicesByParticleIds.at(data.particles.at(4).id));
+    EXPECT_TRUE(!navigator.containsCell(data.particles.at(0).id));
+}
+
+TEST(DescriptionNavigator, updatesIncrementallyAfterDeletions)
+{
+    auto data = createData(10, 5, 20);
+    DescriptionNavigator navigator;
+    navigator.update(data);
+
+    DataChangeDescription changes;
+    auto& cluster = data.clusters.at(4);
+    changes.addDeletedCell(CellChangeDescription().setId(cluster.cells.at(1).id));
+    cluster.cells.erase(cluster.cells.begin() + 1);
+    changes.addDeletedParticle(ParticleChangeDescription().setId(data.particles.at(7).id));
+    data.particles.erase(data.particles.begin() + 7);
+
+    navigator.update(data, changes);
+    expectRebuiltEquivalent(data, navigator);
+}
+
+TEST(DescriptionNavigator, updatesIncrementallyAfterAppending)
+{
+    auto data = createData(10, 5, 20);
+    DescriptionNavigator navigator;
+    navigator.update(data);
+
+    DataChangeDescription changes;
+    auto& cluster = data.emplaceCluster();
+    cluster.setId(1000);
+    for (int i = 0; i < 3; ++i) {
+        auto const& cell = cluster.emplaceCell().setId(1001 + i);
+        changes.addNewCell(CellChangeDescription(cell));
+    }
+    auto const& particle = data.emplaceParticle().setId(2000);
+    changes.addNewParticle(ParticleChangeDescription(particle));
+
+    navigator.update(data, changes);
+    expectRebuiltEquivalent(data, navigator);
+    EXPECT_TRUE(navigator.containsCell(1002));
+    EXPECT_TRUE(navigator.containsParticle(2000));
+}
+
+TEST(DescriptionNavigator, rebuildsAfterRemovedClusters)
+{
+    auto data = createData(10, 5, 0);
+    DescriptionNavigator navigator;
+    navigator.update(data);
+
+    DataChangeDescription changes;
+    for (auto const& cell : data.clusters.at(2).cells) {
+        changes.addDeletedCell(CellChangeDescription().setId(cell.id));
+    }
+    data.clusters.erase(data.clusters.begin() + 2);
+
+    navigator.update(data, changes);
+    expectRebuiltEquivalent(data, navigator);
+}
+
+TEST(DescriptionNavigator, rebuildsAfterCellsAddedToExistingClusters)
+{
+    auto data = createData(10, 5, 0);
+    DescriptionNavigator navigator;
+    navigator.update(data);
+
+    DataChangeDescription changes;
+    auto const& cell = data.clusters.at(3).emplaceCell().setId(5000);
+    changes.addNewCell(CellChangeDescription(cell));
+
+    navigator.update(data, changes);
+    expectRebuiltEquivalent(data, navigator);
+    EXPECT_EQ(5, navigator.cellIndicesByCellIds.at(5000));
+}
@@ -0,0 +1,119 @@
+#include <random>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "EngineInterface/Descriptions.h"
+
+#include "TestFramework.h"
+
+namespace
+{
+    using CellIdPairs = std::vector<std::pair<uint64_t, uint64_t>>;
+
+    ClusterDescription createRandomCluster(int numCells)
+    {
+        std::mt19937 generator(4);
+        std::uniform_real_distribution<float> distribution(-5.0f, 5.0f);
+        ClusterDescription result;
+        for (int i = 0; i < numCells; ++i) {
+            result.addCell(CellDescription()
+                               .setId(i + 1)
+                               .setPos({distribution(generator), distribution(generator)})
+                               .setMaxConnections(6));
+        }
+        return result;
+    }
+
+    //cells on a square grid which are connected to their right and lower neighbors
+    ClusterDescription createLattice(int size, CellIdPairs& cellIdPairs)
+    {
+        ClusterDescription result;
+        for (int y = 0; y < size; ++y) {
+            for (int x = 0; x < size; ++x) {
+                uint64_t id = y * size + x + 1;
+                result.addCell(CellDescription().setId(id).setPos({toFloat(x), toFloat(y)}).setMaxConnections(4));
+                if (x + 1 < size) {
+                    cellIdPairs.emplace_back(id, id + 1);
+                }
+                if (y + 1 < size) {
+                    cellIdPairs.emplace_back(id, id + size);
+                }
+            }
+        }
+        return result;
+    }
+
+    void expectSameAsSequentialAddConnection(ClusterDescription const& cluster, CellIdPairs const& cellIdPairs)
+    {
+        auto sequential = cluster;
+        std::unordered_map<uint64_t, int> cache;
+        for (auto const& [cellId1, cellId2] : cellIdPairs) {
+            sequential.addConnection(cellId1, cellId2, cache);
+        }
+        auto batched = cluster;
+        batched.addConnections(cellIdPairs);
+
+        //same cyclic order, only the starting connection may differ
+        auto isSame = true;
+        for (int i = 0; i < cluster.cells.size(); ++i) {
+            auto const& sequentialConnections = sequential.cells.at(i).connections;
+            auto const& batchedConnections = batched.cells.at(i).connections;
+            auto numConnections = toInt(sequentialConnections.size());
+            EXPECT_EQ(numConnections, toInt(batchedConnections.size()));
+            int offset = 0;
+            while (offset < numConnections
+                   && batchedConnections.at(offset).cellId != sequentialConnections.front().cellId) {
+                ++offset;
+            }
+            for (int j = 0; j < numConnections; ++j) {
+                auto const& sequentialConnection = sequentialConnections.at(j);
+                auto const& batchedConnection = batchedConnections.at((j + offset) % numConnections);
+                isSame &= sequentialConnection.cellId == batchedConnection.cellId;
+                isSame &= std::abs(sequentialConnection.distance - batchedConnection.distance) < 1e-4;
+                isSame &= std::abs(sequentialConnection.angleFromPrevious - batchedConnection.angleFromPrevious) < 1e-2;
+            }
+        }
+        EXPECT_TRUE(isSame);
+    }
+}
+
+TEST(ClusterDescription, addConnectionsMatchesSequentialAddConnection)
+{
+    auto cluster = createRandomCluster(50);
+    CellIdPairs cellIdPairs;
+    for (uint64_t i = 1; i < 50; ++i) {
+        cellIdPairs.emplace_back(i, i + 1);
+        if (i + 7 <= 50) {
+            cellIdPairs.emplace_back(i, i + 7);
+        }
+    }
+    expectSameAsSequentialAddConnection(cluster, cellIdPairs);
+}
+
+TEST(ClusterDescription, addConnectionsOnLargeLattice)
+{
+    //more cells than processed per chunk
+    CellIdPairs cellIdPairs;
+    auto cluster = createLattice(100, cellIdPairs);
+    expectSameAsSequentialAddConnection(cluster, cellIdPairs);
+
+    cluster.addConnections(cellIdPairs);
+    EXPECT_EQ(size_t(2), cluster.cells.front().connections.size());
+    EXPECT_EQ(size_t(4), cluster.cells.at(101).connections.size());
+}
+
+TEST(ClusterDescription, addConnectionsRejectsSelfAndDuplicatePairs)
+{
+    auto cluster = createRandomCluster(10);
+    CellIdPairs selfPairs = {{1, 1}};
+    EXPECT_THROW(cluster.addConnections(selfPairs), std::invalid_argument);
+
+    CellIdPairs duplicatePairs = {{1, 2}, {3, 4}, {2, 1}};
+    EXPECT_THROW(cluster.addConnections(duplicatePairs), std::invalid_argument);
+
+    //pairs are also rejected if the cells are already connected
+    cluster.addConnections({{1, 2}});
+    CellIdPairs existingPairs = {{2, 1}};
+    EXPECT_THROW(cluster.addConnections(existingPairs), std::invalid_argument);
+    EXPECT_EQ(size_t(1), cluster.cells.front().connections.size());
+}
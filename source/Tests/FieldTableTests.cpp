@@ -0,0 +1,136 @@
+#include <cstddef>
+#include <cstring>
+
+#include "Base/Definitions.h"
+#include "Base/FieldTable.h"
+#include "EngineImpl/CoalescedUpload.h"
+
+#include "TestFramework.h"
+
+namespace
+{
+    struct Inner
+    {
+        float x = 0;
+        float y = 0;
+
+        static auto constexpr getFields()
+        {
+            using T = Inner;
+            return std::make_tuple(makeField("x", &T::x), makeField("y", &T::y));
+        }
+
+        bool operator==(Inner const& other) const { return FieldTable::equals(*this, other); }
+    };
+
+    struct Outer
+    {
+        int a = 0;
+        float b = 0;
+        int c = 0;
+        Inner inner[2];
+
+        static auto constexpr getFields()
+        {
+            using T = Outer;
+            return std::make_tuple(
+                makeField("a", &T::a), makeField("b", &T::b), makeField("c", &T::c), makeField("inner", &T::inner));
+        }
+
+        bool operator==(Outer const& other) const { return FieldTable::equals(*this, other); }
+    };
+
+    size_t offsetOfInner(int index, size_t memberOffset)
+    {
+        return offsetof(Outer, inner) + index * sizeof(Inner) + memberOffset;
+    }
+}
+
+TEST(FieldTable, diffByteRangesIsEmptyForEqualStructs)
+{
+    EXPECT_TRUE(FieldTable::diffByteRanges(Outer(), Outer()).empty());
+}
+
+TEST(FieldTable, diffByteRangesMergesAdjacentMembers)
+{
+    Outer changed;
+    changed.a = 1;
+    changed.b = 2.0f;
+    changed.inner[1].y = 3.0f;
+
+    auto ranges = FieldTable::diffByteRanges(changed, Outer());
+    EXPECT_EQ(size_t(2), ranges.size());
+    EXPECT_TRUE((ByteRange{offsetof(Outer, a), sizeof(int) + sizeof(float)} == ranges.at(0)));
+    EXPECT_TRUE((ByteRange{offsetOfInner(1, offsetof(Inner, y)), sizeof(float)} == ranges.at(1)));
+}
+
+TEST(FieldTable, diffByteRangesMergesAcrossArrayElements)
+{
+    Outer changed;
+    changed.inner[0].y = 1.0f;
+    changed.inner[1].x = 2.0f;
+
+    auto ranges = FieldTable::diffByteRanges(changed, Outer());
+    EXPECT_EQ(size_t(1), ranges.size());
+    EXPECT_TRUE((ByteRange{offsetOfInner(0, offsetof(Inner, y)), 2 * sizeof(float)} == ranges.at(0)));
+}
+
+TEST(CoalescedUpload, fetchCoalescesSetsSinceLastFetch)
+{
+    CoalescedUpload<Outer> upload;
+    Outer value;
+    value.a = 1;
+    EXPECT_TRUE(upload.set(value));
+    value.c = 2;
+    EXPECT_TRUE(upload.set(value));
+    EXPECT_TRUE(!upload.set(value));
+    EXPECT_TRUE(upload.hasPendingValue());
+
+    auto ranges = upload.fetch();
+    EXPECT_EQ(size_t(2), ranges.size());
+    EXPECT_TRUE((ByteRange{offsetof(Outer, a), sizeof(int)} == ranges.at(0)));
+    EXPECT_TRUE((ByteRange{offsetof(Outer, c), sizeof(int)} == ranges.at(1)));
+    EXPECT_TRUE(upload.getUploadedValue() == value);
+    EXPECT_TRUE(!upload.hasPendingValue());
+    EXPECT_TRUE(upload.fetch().empty());
+}
+
+TEST(CoalescedUpload, revertedChangesAreNotUploaded)
+{
+    CoalescedUpload<Outer> upload;
+    Outer uploaded;
+    uploaded.b = 1.0f;
+    upload.reset(uploaded);
+
+    auto changed = uploaded;
+    changed.inner[0].x = 5.0f;
+    EXPECT_TRUE(upload.set(changed));
+    EXPECT_TRUE(upload.getLatestValue() == changed);
+    EXPECT_TRUE(!upload.set(uploaded));
+    EXPECT_TRUE(!upload.hasPendingValue());
+    EXPECT_TRUE(upload.fetch().empty());
+    EXPECT_TRUE(upload.getUploadedValue() == uploaded);
+}
+
+TEST(CoalescedUpload, fetchedRangesReproduceLatestValue)
+{
+    CoalescedUpload<Outer> upload;
+    Outer mirror;  //stands in for the GPU memory
+    for (int i = 1; i <= 10; ++i) {
+        auto value = upload.getLatestValue();
+        value.inner[i % 2].x = toFloat(i);
+        value.c = i / 3;
+        upload.set(value);
+        if (i % 3 == 0) {
+            auto ranges = upload.fetch();
+            auto const& source = upload.getUploadedValue();
+            for (auto const& range : ranges) {
+                std::memcpy(
+                    reinterpret_cast<char*>(&mirror) + range.offset,
+                    reinterpret_cast<char const*>(&source) + range.offset,
+                    range.size);
+            }
+            EXPECT_TRUE(mirror == upload.getUploadedValue());
+        }
+    }
+}
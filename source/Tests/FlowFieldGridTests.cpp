@@ -0,0 +1,68 @@
+#include <cmath>
+#include <random>
+
+#include "EngineInterface/FlowFieldGrid.h"
+
+#include "TestFramework.h"
+
+namespace
+{
+    IntVector2D const WorldSize{2000, 1000};
+
+    FlowFieldSettings createSettings(int numCenters)
+    {
+        FlowFieldSettings result;
+        result.active = true;
+        result.numCenters = numCenters;
+        for (int i = 0; i < numCenters; ++i) {
+            result.centers[i].posX = toFloat(WorldSize.x) * toFloat(i) / toFloat(numCenters);
+            result.centers[i].posY = toFloat(WorldSize.y) * toFloat(i % 3) / 3.0f;
+            result.centers[i].radius = 300.0f;
+            result.centers[i].orientation = 0 == i % 2 ? Orientation::Clockwise : Orientation::CounterClockwise;
+        }
+        return result;
+    }
+}
+
+TEST(FlowFieldGrid, sampledVelocitiesMatchAnalyticField)
+{
+    auto centers = FlowFieldGrid::getCenters(createSettings(FlowFieldSettings::MaxCenters));
+    EXPECT_EQ(size_t(FlowFieldSettings::MaxCenters), centers.size());
+    FlowFieldGrid grid;
+    grid.update(centers, WorldSize);
+
+    std::mt19937 generator(0);
+    std::uniform_real_distribution<float> distributionX(0, toFloat(WorldSize.x));
+    std::uniform_real_distribution<float> distributionY(0, toFloat(WorldSize.y));
+    auto sumError = 0.0;
+    auto sumVelocity = 0.0;
+    for (int i = 0; i < 100000; ++i) {
+        RealVector2D pos{distributionX(generator), distributionY(generator)};
+        auto expected = FlowFieldGrid::calcVelocity(centers, pos, WorldSize);
+        auto actual = grid.sampleVelocity(pos);
+        sumError += std::abs(expected.x - actual.x) + std::abs(expected.y - actual.y);
+        sumVelocity += std::abs(expected.x) + std::abs(expected.y);
+    }
+
+    //larger errors only occur next to the centers where the height profile is not smooth
+    EXPECT_TRUE(sumError < 0.01 * sumVelocity);
+}
+
+TEST(FlowFieldGrid, getCentersClampsNumberOfCenters)
+{
+    auto settings = createSettings(2);
+    EXPECT_EQ(size_t(2), FlowFieldGrid::getCenters(settings).size());
+    settings.numCenters = FlowFieldSettings::MaxCenters + 1;
+    EXPECT_EQ(size_t(FlowFieldSettings::MaxCenters), FlowFieldGrid::getCenters(settings).size());
+}
+
+TEST(FlowFieldGrid, rebuildsOnlyIfCentersChange)
+{
+    auto centers = FlowFieldGrid::getCenters(createSettings(3));
+    FlowFieldGrid grid;
+    EXPECT_TRUE(grid.update(centers, WorldSize));
+    EXPECT_TRUE(!grid.update(centers, WorldSize));
+    centers.at(1).strength *= 2;
+    EXPECT_TRUE(grid.update(centers, WorldSize));
+    EXPECT_TRUE(grid.update(centers, {1000, 1000}));
+}
@@ -0,0 +1,98 @@
+#include <mutex>
+#include <thread>
+
+#include "Base/Definitions.h"
+#include "Base/LoggingServiceImpl.h"
+
+#include "TestFramework.h"
+
+namespace
+{
+    class RecordingCallBack : public LoggingCallBack
+    {
+    public:
+        void newLogMessage(Priority, std::string const& message) override
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _messages.emplace_back(message.substr(message.find(": ") + 2));
+        }
+
+        std::vector<std::string> getMessages() const
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            return _messages;
+        }
+
+    private:
+        mutable std::mutex _mutex;
+        std::vector<std::string> _messages;
+    };
+
+    //logs, flushes and unregisters itself from within the callback
+    class ReentrantCallBack : public LoggingCallBack
+    {
+    public:
+        ReentrantCallBack(LoggingServiceImpl& service)
+            : _service(service)
+        {}
+
+        void newLogMessage(Priority, std::string const&) override
+        {
+            ++numMessages;
+            _service.logMessage(Priority::Important, "from callback");
+            _service.flush();
+            _service.unregisterCallBack(this);
+        }
+
+        int numMessages = 0;
+
+    private:
+        LoggingServiceImpl& _service;
+    };
+}
+
+TEST(LoggingService, callbackMayLogFlushAndUnregister)
+{
+    LoggingServiceImpl service;
+    ReentrantCallBack reentrant(service);
+    RecordingCallBack recording;
+    service.registerCallBack(&reentrant);
+    service.registerCallBack(&recording);
+
+    service.logMessage(Priority::Important, "first");
+    service.flush();
+    service.flush();
+
+    EXPECT_EQ(1, reentrant.numMessages);
+    auto messages = recording.getMessages();
+    EXPECT_EQ(2, toInt(messages.size()));
+    EXPECT_EQ(std::string("first"), messages.at(0));
+    EXPECT_EQ(std::string("from callback"), messages.at(1));
+    service.unregisterCallBack(&recording);
+}
+
+TEST(LoggingService, concurrentFlushesKeepOrderOfMessages)
+{
+    LoggingServiceImpl service;
+    RecordingCallBack recording;
+    service.registerCallBack(&recording);
+
+    int const NumMessages = 20000;
+    std::thread flushingThread([&] {
+        for (int i = 0; i < 1000; ++i) {
+            service.flush();
+        }
+    });
+    for (int i = 0; i < NumMessages; ++i) {
+        service.logMessage(Priority::Important, std::to_string(i));
+    }
+    flushingThread.join();
+    service.flush();
+
+    auto messages = recording.getMessages();
+    EXPECT_EQ(NumMessages, toInt(messages.size()));
+    for (int i = 0; i < toInt(messages.size()); ++i) {
+        EXPECT_EQ(std::to_string(i), messages.at(i));
+    }
+    service.unregisterCallBack(&recording);
+}
@@ -0,0 +1,13 @@
+#include <iostream>
+
+#include "TestFramework.h"
+
+int main(int argc, char** argv)
+{
+    if (argc > 2) {
+        std::cerr << "Usage: alien-tests [name filter]" << std::endl;
+        return 1;
+    }
+    auto filter = argc == 2 ? std::string(argv[1]) : std::string();
+    return TestRegistry::getInstance().runAll(filter) == 0 ? 0 : 1;
+}
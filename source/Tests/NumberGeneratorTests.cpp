@@ -0,0 +1,173 @@
+#include <algorithm>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "Base/NumberGenerator.h"
+
+#include "TestFramework.h"
+
+namespace
+{
+    std::vector<uint32_t> drawInts(int count)
+    {
+        std::vector<uint32_t> result;
+        for (int i = 0; i < count; ++i) {
+            result.emplace_back(NumberGenerator::getInstance().getRandomInt());
+        }
+        return result;
+    }
+
+    //draws from the given streams on separate threads
+    std::vector<std::vector<uint32_t>> drawIntsOnThreads(std::vector<uint64_t> const& streamIndices, int count)
+    {
+        std::vector<std::vector<uint32_t>> result(streamIndices.size());
+        std::vector<std::thread> threads;
+        for (int i = 0; i < streamIndices.size(); ++i) {
+            threads.emplace_back([&, i] {
+                NumberGenerator::getInstance().selectStream(streamIndices.at(i));
+                result.at(i) = drawInts(count);
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        return result;
+    }
+}
+
+TEST(NumberGenerator, sameSeedGivesSameSequence)
+{
+    auto& generator = NumberGenerator::getInstance();
+    generator.setSeed(42);
+    auto sequence1 = drawInts(1000);
+    generator.setSeed(42);
+    auto sequence2 = drawInts(1000);
+    generator.setSeed(43);
+    auto sequence3 = drawInts(1000);
+
+    EXPECT_TRUE(sequence1 == sequence2);
+    EXPECT_TRUE(sequence1 != sequence3);
+}
+
+TEST(NumberGenerator, streamsDoNotDependOnThreads)
+{
+    auto& generator = NumberGenerator::getInstance();
+    generator.setSeed(42);
+    auto sequences1 = drawIntsOnThreads({1, 2, 3, 4}, 1000);
+    generator.setSeed(42);
+    auto sequences2 = drawIntsOnThreads({4, 3, 2, 1}, 1000);
+
+    std::reverse(sequences2.begin(), sequences2.end());
+    EXPECT_TRUE(sequences1 == sequences2);
+
+    generator.setSeed(42);
+    generator.selectStream(3);
+    EXPECT_TRUE(sequences1.at(2) == drawInts(1000));
+    generator.selectStream(0);
+}
+
+TEST(NumberGenerator, streamsAreIndependent)
+{
+    NumberGenerator::getInstance().setSeed(42);
+    auto sequences = drawIntsOnThreads({0, 1, 2, 3}, 1000);
+
+    //equal values at the same positions are as rare as for independent sequences
+    for (int i = 0; i < sequences.size(); ++i) {
+        for (int j = i + 1; j < sequences.size(); ++j) {
+            int numEqualValues = 0;
+            for (int k = 0; k < 1000; ++k) {
+                numEqualValues += sequences.at(i).at(k) == sequences.at(j).at(k) ? 1 : 0;
+            }
+            EXPECT_EQ(0, numEqualValues);
+        }
+    }
+}
+
+TEST(NumberGenerator, fillFunctionsMatchSingleDraws)
+{
+    auto& generator = NumberGenerator::getInstance();
+    generator.setSeed(7);
+    std::vector<uint32_t> ints(1000);
+    generator.fillRandomInts(ints.data(), toInt(ints.size()), 10);
+    std::vector<double> reals(1000);
+    generator.fillRandomReals(reals.data(), toInt(reals.size()), -2.0, 3.0);
+
+    generator.setSeed(7);
+    auto isEqual = true;
+    for (auto const& value : ints) {
+        isEqual &= value == generator.getRandomInt(10);
+    }
+    for (auto const& value : reals) {
+        isEqual &= value == generator.getRandomReal(-2.0, 3.0);
+    }
+    EXPECT_TRUE(isEqual);
+
+    EXPECT_TRUE(std::all_of(ints.begin(), ints.end(), [](auto value) { return value < 10; }));
+    EXPECT_TRUE(std::all_of(reals.begin(), reals.end(), [](auto value) { return value >= -2.0 && value < 3.0; }));
+    for (uint32_t value = 0; value < 10; ++value) {
+        EXPECT_TRUE(std::find(ints.begin(), ints.end(), value) != ints.end());
+    }
+}
+
+TEST(NumberGenerator, idsAreUniqueAcrossThreads)
+{
+    int const NumThreads = 4;
+    int const NumIds = 10000;
+
+    std::vector<std::vector<uint64_t>> idsByThread(NumThreads);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < NumThreads; ++i) {
+        threads.emplace_back([&, i] {
+            for (int j = 0; j < NumIds; ++j) {
+                idsByThread.at(i).emplace_back(NumberGenerator::getInstance().getId());
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    std::set<uint64_t> ids;
+    for (auto const& threadIds : idsByThread) {
+        ids.insert(threadIds.begin(), threadIds.end());
+    }
+    EXPECT_EQ(size_t(NumThreads * NumIds), ids.size());
+}
+
+TEST(NumberGenerator, reservedIdsDoNotOverlapIdBlocks)
+{
+    auto& generator = NumberGenerator::getInstance();
+    auto idBeforeReservation = generator.getId();
+    auto firstReservedId = generator.reserveIds(5000);
+    auto secondReservedId = generator.reserveIds(10);
+
+    EXPECT_TRUE(firstReservedId + 5000 <= secondReservedId);
+
+    //ids from the current block of this thread and from blocks reserved afterwards lie outside both ranges
+    auto isOutsideReservations = [&](uint64_t id) {
+        auto isInFirstRange = id >= firstReservedId && id < firstReservedId + 5000;
+        auto isInSecondRange = id >= secondReservedId && id < secondReservedId + 10;
+        return !isInFirstRange && !isInSecondRange;
+    };
+    EXPECT_TRUE(isOutsideReservations(idBeforeReservation));
+    auto isOutside = true;
+    for (int i = 0; i < 5000; ++i) {
+        isOutside &= isOutsideReservations(generator.getId());
+    }
+    EXPECT_TRUE(isOutside);
+}
+
+TEST(NumberGenerator, idsHaveHostPrefix)
+{
+    auto const HostPrefix = static_cast<uint64_t>(1) << 48;
+    auto& generator = NumberGenerator::getInstance();
+
+    auto id = generator.getId();
+    auto reservedId = generator.reserveIds(1);
+    EXPECT_TRUE(0 != id);
+    EXPECT_TRUE(0 != reservedId);
+    EXPECT_EQ(HostPrefix, id & HostPrefix);
+    EXPECT_EQ(HostPrefix, reservedId & HostPrefix);
+    EXPECT_TRUE(0 != (reservedId & (HostPrefix - 1)));  //running numbers start at 1
+}
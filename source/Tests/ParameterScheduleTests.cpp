@@ -0,0 +1,99 @@
+#include <stdexcept>
+
+#include "EngineInterface/ParameterSchedule.h"
+#include "EngineInterface/Settings.h"
+
+#include "TestFramework.h"
+
+namespace
+{
+    ParameterSchedule makeSchedule(std::string const& path, ScheduleInterpolation interpolation)
+    {
+        ParameterSchedule result;
+        result.path = path;
+        result.interpolation = interpolation;
+        result.keyframes = {{100, 1.0}, {200, 3.0}, {400, 2.0}};
+        return result;
+    }
+}
+
+TEST(ParameterSchedule, linearInterpolation)
+{
+    auto schedule = makeSchedule("simulation parameters.radiation.probability", ScheduleInterpolation::Linear);
+    EXPECT_NEAR(1.0, schedule.getValue(100), 1e-9);
+    EXPECT_NEAR(2.0, schedule.getValue(150), 1e-9);
+    EXPECT_NEAR(3.0, schedule.getValue(200), 1e-9);
+    EXPECT_NEAR(2.5, schedule.getValue(300), 1e-9);
+}
+
+TEST(ParameterSchedule, stepInterpolation)
+{
+    auto schedule = makeSchedule("simulation parameters.radiation.probability", ScheduleInterpolation::Step);
+    EXPECT_NEAR(1.0, schedule.getValue(100), 1e-9);
+    EXPECT_NEAR(1.0, schedule.getValue(199), 1e-9);
+    EXPECT_NEAR(3.0, schedule.getValue(200), 1e-9);
+    EXPECT_NEAR(3.0, schedule.getValue(399), 1e-9);
+}
+
+TEST(ParameterSchedule, clampsOutsideKeyframes)
+{
+    for (auto interpolation : {ScheduleInterpolation::Linear, ScheduleInterpolation::Step}) {
+        auto schedule = makeSchedule("simulation parameters.radiation.probability", interpolation);
+        EXPECT_NEAR(1.0, schedule.getValue(0), 1e-9);
+        EXPECT_NEAR(1.0, schedule.getValue(99), 1e-9);
+        EXPECT_NEAR(2.0, schedule.getValue(400), 1e-9);
+        EXPECT_NEAR(2.0, schedule.getValue(100000), 1e-9);
+    }
+}
+
+TEST(ParameterSchedules, applySetsOnlyScheduledFields)
+{
+    auto probability = makeSchedule("simulation parameters.radiation.probability", ScheduleInterpolation::Linear);
+    auto maxBonds = makeSchedule("simulation parameters.cell.max bonds", ScheduleInterpolation::Linear);
+    ParameterSchedules schedules({probability, maxBonds});
+
+    Settings settings = Settings();
+    auto unscheduledSettings = settings;
+    schedules.apply(250, settings);
+    EXPECT_NEAR(2.75f, settings.simulationParameters.radiationProb, 1e-6);
+    EXPECT_EQ(3, settings.simulationParameters.cellMaxBonds);  //rounded
+
+    settings.simulationParameters.radiationProb = unscheduledSettings.simulationParameters.radiationProb;
+    settings.simulationParameters.cellMaxBonds = unscheduledSettings.simulationParameters.cellMaxBonds;
+    EXPECT_TRUE(settings.simulationParameters == unscheduledSettings.simulationParameters);
+}
+
+TEST(ParameterSchedules, copyScheduledFields)
+{
+    ParameterSchedules schedules(
+        {makeSchedule("simulation parameters.radiation.probability", ScheduleInterpolation::Step)});
+
+    Settings source = Settings();
+    source.simulationParameters.radiationProb = 0.5f;
+    source.simulationParameters.cellMaxBonds = 2;
+    Settings target = Settings();
+    schedules.copyScheduledFields(source, target);
+    EXPECT_NEAR(0.5f, target.simulationParameters.radiationProb, 1e-6);
+    EXPECT_EQ(Settings().simulationParameters.cellMaxBonds, target.simulationParameters.cellMaxBonds);
+}
+
+TEST(ParameterSchedules, rejectsInvalidSchedules)
+{
+    auto unknown = makeSchedule("simulation parameters.unknown", ScheduleInterpolation::Linear);
+    EXPECT_THROW(ParameterSchedules({unknown}), std::invalid_argument);
+
+    auto general = makeSchedule("general.world size.x", ScheduleInterpolation::Linear);
+    EXPECT_THROW(ParameterSchedules({general}), std::invalid_argument);
+
+    auto probability = makeSchedule("simulation parameters.radiation.probability", ScheduleInterpolation::Linear);
+    std::vector<ParameterSchedule> duplicates = {probability, probability};
+    EXPECT_THROW(ParameterSchedules schedules(duplicates), std::invalid_argument);
+
+    auto noKeyframes = probability;
+    noKeyframes.keyframes.clear();
+    EXPECT_THROW(ParameterSchedules({noKeyframes}), std::invalid_argument);
+
+    auto descending = probability;
+    descending.keyframes = {ScheduleKeyframe{200, 1.0}, ScheduleKeyframe{100, 2.0}};
+    EXPECT_THROW(ParameterSchedules({descending}), std::invalid_argument);
+}
@@ -0,0 +1,69 @@
+#include <sstream>
+
+#include <boost/property_tree/json_parser.hpp>
+
+#include "Base/FieldTable.h"
+#include "EngineInterface/Parser.h"
+#include "EngineInterface/Settings.h"
+
+#include "TestFramework.h"
+
+namespace
+{
+    Settings createSettings()
+    {
+        Settings result;
+        result.generalSettings.worldSizeX = 1000;
+        result.generalSettings.worldSizeY = 600;
+        result.simulationParameters.radiationProb = 0.125f;
+        result.simulationParameters.spotValues.friction = 0.5f;
+        result.simulationParametersSpots.numSpots = 2;
+        result.simulationParametersSpots.spots[1].posX = 300.0f;
+        result.simulationParametersSpots.spots[1].values.friction = 0.25f;
+        result.flowFieldSettings.active = true;
+        result.flowFieldSettings.centers[0].strength = 0.75f;
+        return result;
+    }
+
+    std::string toJson(boost::property_tree::ptree const& tree)
+    {
+        std::stringstream stream;
+        boost::property_tree::json_parser::write_json(stream, tree);
+        return stream.str();
+    }
+
+    std::pair<uint64_t, Settings> decodeByPropertyTree(std::string const& json)
+    {
+        std::stringstream stream(json);
+        boost::property_tree::ptree tree;
+        boost::property_tree::json_parser::read_json(stream, tree);
+        return Parser::decodeTimestepAndSettings(tree);
+    }
+}
+
+TEST(Parser, bothDecodersRestoreEncodedSettings)
+{
+    auto settings = createSettings();
+    auto json = toJson(Parser::encode(12345, settings));
+
+    for (auto const& [timestep, decodedSettings] :
+         {decodeByPropertyTree(json), Parser::decodeTimestepAndSettings(std::string_view(json))}) {
+        EXPECT_EQ(uint64_t(12345), timestep);
+        EXPECT_EQ(size_t(0), FieldTable::diff(settings, decodedSettings).size());
+    }
+}
+
+TEST(Parser, bothDecodersUseDefaultsForMissingFields)
+{
+    std::string json = R"({"general": {"time step": "7", "world size": {"x": "200"}},
+        "simulation parameters": {"radiation": {"probability": "0.5"}}})";
+    auto expected = Settings();
+    expected.generalSettings.worldSizeX = 200;
+    expected.simulationParameters.radiationProb = 0.5f;
+
+    for (auto const& [timestep, decodedSettings] :
+         {decodeByPropertyTree(json), Parser::decodeTimestepAndSettings(std::string_view(json))}) {
+        EXPECT_EQ(uint64_t(7), timestep);
+        EXPECT_EQ(size_t(0), FieldTable::diff(expected, decodedSettings).size());
+    }
+}
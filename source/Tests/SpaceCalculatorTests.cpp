@@ -0,0 +1,115 @@
+#include <cmath>
+#include <random>
+
+#include "Base/CpuFeatures.h"
+#include "EngineInterface/SpaceCalculator.h"
+
+#include "TestFramework.h"
+
+namespace
+{
+    std::vector<IntVector2D> const WorldSizes = {{100, 100}, {101, 73}, {1000, 600}, {6000, 3001}};
+
+    std::vector<SimdLevel> getSupportedSimdLevels()
+    {
+        CpuFeatures::setSimdLevelLimit(SimdLevel::Avx2);
+        std::vector<SimdLevel> result{SimdLevel::Scalar};
+        if (CpuFeatures::getSimdLevel() >= SimdLevel::Sse41) {
+            result.emplace_back(SimdLevel::Sse41);
+        }
+        if (CpuFeatures::getSimdLevel() >= SimdLevel::Avx2) {
+            result.emplace_back(SimdLevel::Avx2);
+        }
+        return result;
+    }
+
+    //random positions in several world periods and values at the period boundaries
+    std::vector<RealVector2D> createPositions(IntVector2D const& worldSize, int count)
+    {
+        std::mt19937 generator(worldSize.x);
+        std::uniform_real_distribution<float> distributionX(-3.0f * worldSize.x, 4.0f * worldSize.x);
+        std::uniform_real_distribution<float> distributionY(-3.0f * worldSize.y, 4.0f * worldSize.y);
+        std::vector<RealVector2D> result;
+        for (int i = 0; i < count; ++i) {
+            result.emplace_back(RealVector2D{distributionX(generator), distributionY(generator)});
+        }
+        auto sizeX = toFloat(worldSize.x);
+        auto sizeY = toFloat(worldSize.y);
+        for (auto const& value : {0.0f, 1e-6f, -1e-6f, 0.5f, -0.5f, 1.0f, -1.0f}) {
+            for (auto const& offset : {0.0f, 0.5f, 1.0f, -0.5f, -1.0f, 2.0f}) {
+                result.emplace_back(RealVector2D{offset * sizeX + value, offset * sizeY - value});
+            }
+        }
+        return result;
+    }
+
+    //reference values are calculated in double precision, results at the period boundaries may wrap to either side
+    void expectPeriodicNear(double expected, float actual, double size)
+    {
+        auto difference = std::abs(expected - actual);
+        EXPECT_TRUE(std::min(difference, std::abs(difference - size)) < 1e-6 * size + 1e-4);
+    }
+
+    void expectDisplacementNear(double expected, float actual, double size)
+    {
+        EXPECT_TRUE(std::abs(actual) <= size / 2 + 1e-6 * size);
+        expectPeriodicNear(expected, actual, size);
+    }
+}
+
+TEST(SpaceCalculator, singleElementFunctionsMatchReference)
+{
+    for (auto const& worldSize : WorldSizes) {
+        SpaceCalculator spaceCalculator(worldSize);
+        auto positions = createPositions(worldSize, 10000);
+        for (auto const& position : positions) {
+            auto corrected = position;
+            spaceCalculator.correctPosition(corrected);
+            EXPECT_TRUE(corrected.x >= 0 && corrected.x < worldSize.x);
+            EXPECT_TRUE(corrected.y >= 0 && corrected.y < worldSize.y);
+            expectPeriodicNear(std::fmod(position.x, worldSize.x), corrected.x, worldSize.x);
+            expectPeriodicNear(std::fmod(position.y, worldSize.y), corrected.y, worldSize.y);
+
+            auto displacement = position;
+            spaceCalculator.correctDisplacement(displacement);
+            expectDisplacementNear(std::remainder(position.x, worldSize.x), displacement.x, worldSize.x);
+            expectDisplacementNear(std::remainder(position.y, worldSize.y), displacement.y, worldSize.y);
+        }
+    }
+}
+
+TEST(SpaceCalculator, batchFunctionsMatchSingleElementFunctions)
+{
+    for (auto const& simdLevel : getSupportedSimdLevels()) {
+        CpuFeatures::setSimdLevelLimit(simdLevel);
+        for (auto const& worldSize : WorldSizes) {
+            SpaceCalculator spaceCalculator(worldSize);
+            auto positions1 = createPositions(worldSize, 10001);
+            auto positions2 = positions1;
+            std::reverse(positions2.begin(), positions2.end());
+            auto count = toInt(positions1.size());
+
+            std::vector<RealVector2D> displacements(count);
+            spaceCalculator.displacements(positions1.data(), positions2.data(), displacements.data(), count);
+            std::vector<float> distances;
+            spaceCalculator.distances(positions1.front(), positions2, distances);
+            auto correctedPositions = positions1;
+            spaceCalculator.correctPositions(correctedPositions.data(), count);
+
+            for (int i = 0; i < count; ++i) {
+                auto displacement = positions2.at(i) - positions1.at(i);
+                spaceCalculator.correctDisplacement(displacement);
+                EXPECT_EQ(displacement.x, displacements.at(i).x);
+                EXPECT_EQ(displacement.y, displacements.at(i).y);
+
+                EXPECT_EQ(spaceCalculator.distance(positions1.front(), positions2.at(i)), distances.at(i));
+
+                auto position = positions1.at(i);
+                spaceCalculator.correctPosition(position);
+                EXPECT_EQ(position.x, correctedPositions.at(i).x);
+                EXPECT_EQ(position.y, correctedPositions.at(i).y);
+            }
+        }
+    }
+    CpuFeatures::setSimdLevelLimit(SimdLevel::Avx2);
+}
@@ -0,0 +1,151 @@
+#include <cmath>
+#include <random>
+
+#include "EngineInterface/SimulationParameters.h"
+#include "EngineInterface/SpotFactorGrid.h"
+
+#include "TestFramework.h"
+
+namespace
+{
+    IntVector2D const WorldSize{2000, 1000};
+
+    SimulationParametersSpots createSpots()
+    {
+        SimulationParametersSpots result;
+        result.numSpots = 2;
+        result.spots[0].posX = 300.0f;
+        result.spots[0].posY = 200.0f;
+        result.spots[0].coreRadius = 80.0f;
+        result.spots[0].fadeoutRadius = 100.0f;
+        result.spots[0].values.friction = 0.5f;
+        result.spots[1].posX = 1900.0f;  //overlaps the world boundary
+        result.spots[1].posY = 900.0f;
+        result.spots[1].coreRadius = 50.0f;
+        result.spots[1].fadeoutRadius = 300.0f;
+        result.spots[1].values.friction = 0.1f;
+        return result;
+    }
+
+    std::vector<RealVector2D> getRandomPositions(int count)
+    {
+        std::mt19937 generator(0);
+        std::uniform_real_distribution<float> distributionX(0, toFloat(WorldSize.x));
+        std::uniform_real_distribution<float> distributionY(0, toFloat(WorldSize.y));
+        std::vector<RealVector2D> result;
+        for (int i = 0; i < count; ++i) {
+            result.emplace_back(distributionX(generator), distributionY(generator));
+        }
+        return result;
+    }
+
+    //SpotCalculator as it computed the value before the grid was introduced
+    float calcValueBySpotCalculator(
+        SimulationParameters const& parameters,
+        SimulationParametersSpots const& spots,
+        RealVector2D const& pos)
+    {
+        auto calcFactor = [&](SimulationParametersSpot const& spot) {
+            auto dx = std::remainder(pos.x - spot.posX, toFloat(WorldSize.x));
+            auto dy = std::remainder(pos.y - spot.posY, toFloat(WorldSize.y));
+            auto distance = std::sqrt(dx * dx + dy * dy);
+            auto fadeoutRadius = spot.fadeoutRadius + 1;
+            return distance < spot.coreRadius ? 0.0f : std::min(1.0f, (distance - spot.coreRadius) / fadeoutRadius);
+        };
+        auto factor1 = calcFactor(spots.spots[0]);
+        auto factor2 = calcFactor(spots.spots[1]);
+        float weight1 = factor1 * factor2;
+        float weight2 = 1 - factor1;
+        float weight3 = 1 - factor2;
+        float sum = weight1 + weight2 + weight3;
+        return (parameters.spotValues.friction * weight1 + spots.spots[0].values.friction * weight2
+                + spots.spots[1].values.friction * weight3)
+            / sum;
+    }
+}
+
+TEST(SpotFactorGrid, sampledFactorsMatchAnalyticFactors)
+{
+    auto spots = createSpots();
+    SpotFactorGrid grid;
+    grid.update(spots, WorldSize);
+
+    //the interpolation error is bounded by the spacing relative to the fadeout radius
+    auto maxError = 0.0f;
+    auto sumError = 0.0;
+    auto positions = getRandomPositions(100000);
+    for (auto const& pos : positions) {
+        float factors[SpotFactorGrid::MaxSpots];
+        grid.sampleFactors(pos, factors);
+        for (int i = 0; i < spots.numSpots; ++i) {
+            auto error = std::abs(factors[i] - SpotFactorGrid::calcFactor(spots.spots[i], pos, WorldSize));
+            maxError = std::max(maxError, error);
+            sumError += error;
+        }
+    }
+    EXPECT_TRUE(maxError < SpotFactorGrid::DefaultSpacing / spots.spots[0].fadeoutRadius);
+    EXPECT_TRUE(sumError / (positions.size() * spots.numSpots) < 0.001);
+}
+
+TEST(SpotFactorGrid, sampledValuesMatchSpotCalculator)
+{
+    SimulationParameters parameters;
+    parameters.spotValues.friction = 0.001f;
+    auto spots = createSpots();
+    SpotFactorGrid grid;
+    grid.update(spots, WorldSize);
+
+    auto valueRange = spots.spots[0].values.friction - parameters.spotValues.friction;
+    for (auto const& pos : getRandomPositions(100000)) {
+        auto expected = calcValueBySpotCalculator(parameters, spots, pos);
+        float factors[SpotFactorGrid::MaxSpots];
+        for (int i = 0; i < spots.numSpots; ++i) {
+            factors[i] = SpotFactorGrid::calcFactor(spots.spots[i], pos, WorldSize);
+        }
+        EXPECT_NEAR(
+            expected,
+            SpotFactorGrid::calcValue(&SimulationParametersSpotValues::friction, parameters, spots, factors),
+            1e-6f);
+        EXPECT_NEAR(
+            expected,
+            grid.sampleValue(&SimulationParametersSpotValues::friction, parameters, pos),
+            valueRange * SpotFactorGrid::DefaultSpacing / spots.spots[0].fadeoutRadius);
+    }
+}
+
+TEST(SpotFactorGrid, samplingIsContinuousAcrossWorldBoundary)
+{
+    SpotFactorGrid grid;
+    grid.update(createSpots(), WorldSize);
+
+    for (float y = 0; y < toFloat(WorldSize.y); y += 37.0f) {
+        float left[SpotFactorGrid::MaxSpots];
+        float right[SpotFactorGrid::MaxSpots];
+        grid.sampleFactors({-0.001f, y}, left);
+        grid.sampleFactors({toFloat(WorldSize.x) - 0.001f, y}, right);
+        EXPECT_NEAR(left[0], right[0], 1e-4f);
+        EXPECT_NEAR(left[1], right[1], 1e-4f);
+    }
+}
+
+TEST(SpotFactorGrid, rebuildsOnlyIfGeometryChanges)
+{
+    SimulationParameters parameters;
+    auto spots = createSpots();
+    SpotFactorGrid grid;
+    EXPECT_TRUE(grid.update(spots, WorldSize));
+    EXPECT_TRUE(!grid.update(spots, WorldSize));
+
+    spots.spots[0].values.friction = 0.75f;
+    spots.spots[0].color = 0xff0000;
+    EXPECT_TRUE(!grid.update(spots, WorldSize));
+    RealVector2D center{spots.spots[0].posX, spots.spots[0].posY};
+    EXPECT_NEAR(0.75f, grid.sampleValue(&SimulationParametersSpotValues::friction, parameters, center), 1e-6f);
+
+    spots.spots[0].coreRadius = 90.0f;
+    EXPECT_TRUE(grid.update(spots, WorldSize));
+    spots.numSpots = 1;
+    EXPECT_TRUE(grid.update(spots, WorldSize));
+    EXPECT_EQ(1, grid.getNumSpots());
+    EXPECT_TRUE(grid.update(spots, {1000, 1000}));
+}
@@ -0,0 +1,67 @@
+#include "StandInSweepBackend.h"
+
+#include <stdexcept>
+#include <thread>
+
+StandInSweepBackend::StandInSweepBackend(
+    std::vector<uint64_t> const& memoryPerJob,
+    std::chrono::milliseconds const& runDuration)
+    : _memoryPerJob(memoryPerJob)
+    , _runDuration(runDuration)
+{}
+
+void StandInSweepBackend::setFailingJob(int jobId)
+{
+    _failingJob = jobId;
+}
+
+uint64_t StandInSweepBackend::estimateMemory(SweepJob const& job) const
+{
+    return _memoryPerJob.at(job.id);
+}
+
+SweepResult StandInSweepBackend::run(SweepJob const& job)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        ++_numConcurrentRuns;
+        _usedMemory += _memoryPerJob.at(job.id);
+        _maxConcurrentRuns = std::max(_maxConcurrentRuns, _numConcurrentRuns);
+        _maxUsedMemory = std::max(_maxUsedMemory, _usedMemory);
+        _startedJobs.emplace_back(job.id);
+    }
+    std::this_thread::sleep_for(_runDuration);
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        --_numConcurrentRuns;
+        _usedMemory -= _memoryPerJob.at(job.id);
+    }
+
+    if (_failingJob && *_failingJob == job.id) {
+        throw std::runtime_error("run " + std::to_string(job.id) + " failed");
+    }
+    SweepResult result;
+    result.jobId = job.id;
+    result.successful = true;
+    result.duration = std::chrono::duration<double>(_runDuration).count();
+    result.finalStatistics.timeStep = job.id;
+    return result;
+}
+
+int StandInSweepBackend::getMaxConcurrentRuns() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _maxConcurrentRuns;
+}
+
+uint64_t StandInSweepBackend::getMaxUsedMemory() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _maxUsedMemory;
+}
+
+std::vector<int> StandInSweepBackend::getStartedJobs() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _startedJobs;
+}
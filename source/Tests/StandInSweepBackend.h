@@ -0,0 +1,37 @@
+#pragma once
+
+#include <chrono>
+#include <mutex>
+
+#include "Sweep/SweepBackend.h"
+
+/**
+ * Host-side stand-in for the process backend which does not simulate anything. Each run takes a fixed time and the
+ * backend records how many runs and how much estimated memory have been active at the same time.
+ */
+class StandInSweepBackend : public SweepBackend
+{
+public:
+    StandInSweepBackend(std::vector<uint64_t> const& memoryPerJob, std::chrono::milliseconds const& runDuration);
+
+    void setFailingJob(int jobId);  //run of this job throws an exception
+
+    uint64_t estimateMemory(SweepJob const& job) const override;
+    SweepResult run(SweepJob const& job) override;
+
+    int getMaxConcurrentRuns() const;
+    uint64_t getMaxUsedMemory() const;
+    std::vector<int> getStartedJobs() const;
+
+private:
+    std::vector<uint64_t> _memoryPerJob;
+    std::chrono::milliseconds _runDuration;
+    boost::optional<int> _failingJob;
+
+    mutable std::mutex _mutex;
+    int _numConcurrentRuns = 0;
+    int _maxConcurrentRuns = 0;
+    uint64_t _usedMemory = 0;
+    uint64_t _maxUsedMemory = 0;
+    std::vector<int> _startedJobs;
+};
@@ -0,0 +1,193 @@
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+
+#include <boost/property_tree/json_parser.hpp>
+
+#include "EngineInterface/Parser.h"
+#include "EngineInterface/Settings.h"
+#include "Sweep/ProcessSweepBackend.h"
+#include "Sweep/SweepScheduler.h"
+
+#include "StandInSweepBackend.h"
+#include "TestFramework.h"
+
+namespace
+{
+    std::vector<SweepJob> createJobs(int numJobs)
+    {
+        std::vector<SweepJob> result(numJobs);
+        for (int i = 0; i < numJobs; ++i) {
+            result.at(i).id = i;
+        }
+        return result;
+    }
+
+    auto const RunDuration = std::chrono::milliseconds(20);
+
+    //returns the name of a base simulation file with a world size of 1000 x 500
+    std::string writeBaseFiles(std::filesystem::path const& directory)
+    {
+        std::filesystem::create_directories(directory);
+        auto result = (directory / "base.sim").string();
+        {
+            std::ofstream stream(result, std::ios::binary);
+            stream << std::string(1000, 'x');
+        }
+        std::ofstream(directory / "base.symbols.json") << "{}";
+        Settings settings;
+        settings.generalSettings.worldSizeX = 1000;
+        settings.generalSettings.worldSizeY = 500;
+        auto settingsFilename = (directory / "base.settings.json").string();
+        boost::property_tree::json_parser::write_json(settingsFilename, Parser::encode(0, settings));
+        return result;
+    }
+}
+
+TEST(SweepScheduler, runsAllJobsAndKeepsOrderOfResults)
+{
+    auto backend = boost::make_shared<StandInSweepBackend>(std::vector<uint64_t>(10, 1), RunDuration);
+    SweepScheduler scheduler(backend, 3, 0);
+
+    std::atomic<int> numFinished = 0;
+    auto results = scheduler.run(createJobs(10), [&](SweepResult const&) { ++numFinished; });
+
+    EXPECT_EQ(10, toInt(results.size()));
+    EXPECT_EQ(10, numFinished.load());
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(i, results.at(i).jobId);
+        EXPECT_TRUE(results.at(i).successful);
+        EXPECT_EQ(uint64_t(i), results.at(i).finalStatistics.timeStep);
+    }
+}
+
+TEST(SweepScheduler, limitsConcurrentRuns)
+{
+    auto backend = boost::make_shared<StandInSweepBackend>(std::vector<uint64_t>(12, 1), RunDuration);
+    SweepScheduler scheduler(backend, 4, 0);
+    scheduler.run(createJobs(12));
+
+    EXPECT_EQ(4, backend->getMaxConcurrentRuns());
+    EXPECT_EQ(4, scheduler.getMaxConcurrentRunsReached());
+}
+
+TEST(SweepScheduler, keepsEstimatedMemoryWithinBudget)
+{
+    std::vector<uint64_t> memoryPerJob{300, 500, 200, 400, 100, 600, 300, 200};
+    auto backend = boost::make_shared<StandInSweepBackend>(memoryPerJob, RunDuration);
+    SweepScheduler scheduler(backend, 8, 1000);
+    auto results = scheduler.run(createJobs(toInt(memoryPerJob.size())));
+
+    EXPECT_TRUE(backend->getMaxUsedMemory() <= 1000);
+    EXPECT_TRUE(backend->getMaxConcurrentRuns() < 8);
+    for (auto const& result : results) {
+        EXPECT_TRUE(result.successful);
+    }
+}
+
+TEST(SweepScheduler, admitsJobsInOrder)
+{
+    //the large job 1 must not be overtaken by the small jobs behind it
+    std::vector<uint64_t> memoryPerJob{600, 950, 100, 100, 100};
+    auto backend = boost::make_shared<StandInSweepBackend>(memoryPerJob, RunDuration);
+    SweepScheduler scheduler(backend, 5, 1000);
+    scheduler.run(createJobs(toInt(memoryPerJob.size())));
+
+    auto startedJobs = backend->getStartedJobs();
+    EXPECT_EQ(0, startedJobs.at(0));
+    EXPECT_EQ(1, startedJobs.at(1));
+}
+
+TEST(SweepScheduler, runsJobExceedingBudgetAlone)
+{
+    auto backend = boost::make_shared<StandInSweepBackend>(std::vector<uint64_t>{100, 5000, 100}, RunDuration);
+    SweepScheduler scheduler(backend, 3, 1000);
+    auto results = scheduler.run(createJobs(3));
+
+    EXPECT_TRUE(results.at(1).successful);
+    EXPECT_EQ(uint64_t(5000), backend->getMaxUsedMemory());
+}
+
+TEST(SweepScheduler, reportsFailedRuns)
+{
+    auto backend = boost::make_shared<StandInSweepBackend>(std::vector<uint64_t>(4, 1), RunDuration);
+    backend->setFailingJob(2);
+    SweepScheduler scheduler(backend, 2, 0);
+    auto results = scheduler.run(createJobs(4));
+
+    EXPECT_TRUE(!results.at(2).successful);
+    EXPECT_EQ(2, results.at(2).jobId);
+    EXPECT_EQ(std::string("run 2 failed"), results.at(2).errorMessage);
+    EXPECT_TRUE(results.at(0).successful && results.at(1).successful && results.at(3).successful);
+}
+
+TEST(ProcessSweepBackend, scalesMemoryEstimateWithWorldSize)
+{
+    auto directory = std::filesystem::temp_directory_path() / "alien-tests-sweep";
+    SweepSpecification specification;
+    specification.baseFilename = writeBaseFiles(directory);
+    specification.outputDirectory = (directory / "output").string();
+    ProcessSweepBackend backend(specification, "");
+
+    SweepJob baseJob;
+    SweepJob largeWorldJob;
+    largeWorldJob.overrides = {{"general.world size.x", "2000"}, {"general.world size.y", "1000"}};
+    SweepJob otherParameterJob;
+    otherParameterJob.overrides = {{"simulation parameters.radiation.factor", "0.001"}};
+
+    auto baseMemory = backend.estimateMemory(baseJob);
+    auto mapMemory = uint64_t(1000 * 500 * 3 * sizeof(void*));
+    EXPECT_TRUE(baseMemory > mapMemory);
+    EXPECT_EQ(baseMemory + 3 * mapMemory, backend.estimateMemory(largeWorldJob));
+    EXPECT_EQ(baseMemory, backend.estimateMemory(otherParameterJob));
+
+    std::filesystem::remove_all(directory);
+}
+
+#if !defined(_WIN32)
+TEST(ProcessSweepBackend, passesArgumentsWithoutShell)
+{
+    //the stand-in for alien-cli logs its arguments and writes a statistics line
+    auto directory = std::filesystem::temp_directory_path() / "alien-tests-sweep 'quoted' \"dir\"";
+    auto baseFilename = writeBaseFiles(directory);
+    auto cliFilename = (directory / "alien-cli").string();
+    std::ofstream(cliFilename) << "#!/bin/sh\n"
+                                  "printf '%s\\n' \"$@\"\n"
+                                  "while [ \"$1\" != --statistics ]; do shift; done\n"
+                                  "echo 100,1,2,3,4,5,6,7,8 > \"$2\"\n";
+    std::filesystem::permissions(cliFilename, std::filesystem::perms::owner_all);
+
+    SweepSpecification specification;
+    specification.baseFilename = baseFilename;
+    specification.outputDirectory = (directory / "output $(touch injected)").string();
+    specification.timesteps = 100;
+    specification.seed = 7;
+    ProcessSweepBackend backend(specification, cliFilename);
+    SweepJob job;
+    job.id = 3;
+    auto result = backend.run(job);
+
+    EXPECT_TRUE(result.successful);
+    EXPECT_EQ(uint64_t(100), result.finalStatistics.timeStep);
+    EXPECT_EQ(8, result.finalStatistics.numMuscleActivities);
+    EXPECT_TRUE(!std::filesystem::exists("injected"));
+
+    std::ifstream logStream(std::filesystem::path(specification.outputDirectory) / "run3.log");
+    std::vector<std::string> arguments;
+    for (std::string line; std::getline(logStream, line);) {
+        arguments.emplace_back(line);
+    }
+    auto simFilename = (std::filesystem::path(specification.outputDirectory) / "run3.sim").string();
+    EXPECT_EQ(size_t(13), arguments.size());
+    EXPECT_EQ(simFilename, arguments.at(2));
+    EXPECT_EQ(std::string("--seed"), arguments.at(7));
+    EXPECT_EQ(std::string("7"), arguments.at(8));
+
+    ProcessSweepBackend missingCliBackend(specification, (directory / "missing").string());
+    auto missingCliResult = missingCliBackend.run(job);
+    EXPECT_TRUE(!missingCliResult.successful);
+    EXPECT_TRUE(!missingCliResult.errorMessage.empty());
+
+    std::filesystem::remove_all(directory);
+}
+#endif
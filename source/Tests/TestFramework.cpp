@@ -0,0 +1,35 @@
+#include "TestFramework.h"
+
+#include <iostream>
+
+TestRegistry& TestRegistry::getInstance()
+{
+    static TestRegistry instance;
+    return instance;
+}
+
+void TestRegistry::add(std::string const& name, TestFunction const& function)
+{
+    _tests.emplace_back(name, function);
+}
+
+int TestRegistry::runAll(std::string const& filter) const
+{
+    int numTests = 0;
+    int numFailures = 0;
+    for (auto const& [name, function] : _tests) {
+        if (name.find(filter) == std::string::npos) {
+            continue;
+        }
+        ++numTests;
+        try {
+            function();
+            std::cout << "[passed] " << name << std::endl;
+        } catch (std::exception const& e) {
+            ++numFailures;
+            std::cout << "[FAILED] " << name << ": " << e.what() << std::endl;
+        }
+    }
+    std::cout << numTests - numFailures << " of " << numTests << " tests passed" << std::endl;
+    return numFailures;
+}
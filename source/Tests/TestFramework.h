@@ -0,0 +1,127 @@
+#pragma once
+
+#include <cmath>
+#include <functional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+class TestFailedException : public std::runtime_error
+{
+public:
+    TestFailedException(std::string const& message)
+        : std::runtime_error(message.c_str())
+    {}
+};
+
+/**
+ * Registry of host-side tests. Tests are registered by the TEST macro and executed by alien-tests, which exits with a
+ * non-zero code if a check fails.
+ */
+class TestRegistry
+{
+public:
+    using TestFunction = std::function<void()>;
+
+    static TestRegistry& getInstance();
+
+    void add(std::string const& name, TestFunction const& function);
+    int runAll(std::string const& filter) const;  //returns the number of failed tests
+
+private:
+    std::vector<std::pair<std::string, TestFunction>> _tests;
+};
+
+struct TestRegistration
+{
+    TestRegistration(std::string const& name, TestRegistry::TestFunction const& function)
+    {
+        TestRegistry::getInstance().add(name, function);
+    }
+};
+
+namespace TestDetail
+{
+    template <typename T, typename = void>
+    struct IsPrintable : std::false_type
+    {};
+    template <typename T>
+    struct IsPrintable<T, std::void_t<decltype(std::declval<std::ostream&>() << std::declval<T const&>())>>
+        : std::true_type
+    {};
+
+    template <typename T>
+    std::string toString(T const& value)
+    {
+        if constexpr (IsPrintable<T>::value) {
+            std::ostringstream stream;
+            stream << value;
+            return stream.str();
+        } else {
+            return "?";
+        }
+    }
+
+    inline std::string formatFailure(char const* file, int line, std::string const& message)
+    {
+        return std::string(file) + "(" + std::to_string(line) + "): " + message;
+    }
+
+    template <typename T1, typename T2>
+    void checkEqual(T1 const& expected, T2 const& actual, char const* expression, char const* file, int line)
+    {
+        if (!(expected == actual)) {
+            throw TestFailedException(formatFailure(
+                file,
+                line,
+                std::string("EXPECT_EQ(") + expression + ") failed: expected " + toString(expected) + ", actual "
+                    + toString(actual)));
+        }
+    }
+
+    inline void
+    checkNear(double expected, double actual, double tolerance, char const* expression, char const* file, int line)
+    {
+        if (!(std::abs(expected - actual) <= tolerance)) {
+            throw TestFailedException(formatFailure(
+                file,
+                line,
+                std::string("EXPECT_NEAR(") + expression + ") failed: expected " + toString(expected) + ", actual "
+                    + toString(actual)));
+        }
+    }
+}
+
+#define TEST(suite, name) \
+    static void suite##_##name(); \
+    static TestRegistration suite##_##name##_registration(#suite "." #name, &suite##_##name); \
+    static void suite##_##name()
+
+#define EXPECT_TRUE(condition) \
+    if (!(condition)) { \
+        throw TestFailedException( \
+            TestDetail::formatFailure(__FILE__, __LINE__, "EXPECT_TRUE(" #condition ") failed")); \
+    }
+
+#define EXPECT_EQ(expected, actual) \
+    TestDetail::checkEqual((expected), (actual), #expected ", " #actual, __FILE__, __LINE__)
+
+#define EXPECT_NEAR(expected, actual, tolerance) \
+    TestDetail::checkNear((expected), (actual), (tolerance), #expected ", " #actual, __FILE__, __LINE__)
+
+#define EXPECT_THROW(statement, ExceptionType) \
+    { \
+        auto thrown = false; \
+        try { \
+            statement; \
+        } catch (ExceptionType const&) { \
+            thrown = true; \
+        } \
+        if (!thrown) { \
+            throw TestFailedException( \
+                TestDetail::formatFailure(__FILE__, __LINE__, "EXPECT_THROW(" #statement ") failed")); \
+        } \
+    }